@@ -0,0 +1,77 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _BITSET_H
+#define _BITSET_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint64_t bitset_t;
+
+#define BITSET_WORDS(n) (((size_t)(n) + 63) / 64)
+
+// allocate a cleared set of n bits; free it with free()
+static inline bitset_t *bitsetalloc(unsigned n)
+{
+	return calloc(BITSET_WORDS(n) + 1, sizeof(bitset_t));
+}
+
+static inline void bitsetzero(bitset_t *pset, unsigned n)
+{
+	memset(pset, 0, BITSET_WORDS(n) * sizeof(bitset_t));
+}
+
+static inline int bitsettest(const bitset_t *pset, unsigned i)
+{
+	return (pset[i / 64] >> (i % 64)) & 1;
+}
+
+static inline void bitsetset(bitset_t *pset, unsigned i)
+{
+	pset[i / 64] |= (bitset_t)1 << (i % 64);
+}
+
+// test a bit while other threads may set other bits of the same word
+static inline int bitsettestatomic(const bitset_t *pset, unsigned i)
+{
+	return (__atomic_load_n(&pset[i / 64], __ATOMIC_RELAXED) >> (i % 64)) &
+	       1;
+}
+
+// set a bit while other threads may set other bits of the same word
+static inline void bitsetsetatomic(bitset_t *pset, unsigned i)
+{
+	__atomic_fetch_or(&pset[i / 64], (bitset_t)1 << (i % 64),
+			  __ATOMIC_RELAXED);
+}
+
+static inline void bitsetclear(bitset_t *pset, unsigned i)
+{
+	pset[i / 64] &= ~((bitset_t)1 << (i % 64));
+}
+
+#endif // #ifndef _BITSET_H
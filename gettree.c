@@ -36,12 +36,24 @@
 
 #define MAXLINEF 5000 // maximum length of a line in cscope.out
 
+// extend the lines of a definition to lineno: a function defined more than
+// once in a file (e.g. under #ifdef) spans all its definitions
+static void gettreeextent(ttreenode_t *pnode, unsigned lineno)
+{
+	if (pnode->line == 0 || lineno < pnode->line)
+		pnode->line = lineno;
+	if (lineno > pnode->endline)
+		pnode->endline = lineno;
+}
+
 int gettree(ttree_t *ptree, treeparam_t *pparam)
 {
 	int iErr = 0;
 	FILE *filein, *filedbout;
 	char *sLine, *sfilename, *scaller;
 	ttreenode_t *ncaller, *ncallee;
+	ttreenode_t *ndef = NULL; // definition whose end is still to be found
+	unsigned lineno = 0; // source line of the symbols that follow
 	long lineidx;
 
 	sLine = malloc(3 * MAXLINEF);
@@ -55,6 +67,7 @@ int gettree(ttree_t *ptree, treeparam_t *pparam)
 	filein = fopen(pparam->infile, "r");
 	if (filein == NULL) {
 		printf("\nError while opening input file\n");
+		iErr = -1;
 		goto cleanup_sLine;
 	}
 
@@ -79,6 +92,11 @@ int gettree(ttree_t *ptree, treeparam_t *pparam)
 		if (pparam->verbose)
 			printf("Getting tree nodes... line %ld\r", lineidx);
 
+		// a source line starts with its number; the text after a
+		// symbol can't start with a digit, that would be part of it
+		if (sLine[0] >= '0' && sLine[0] <= '9')
+			lineno = strtoul(sLine, NULL, 10);
+
 		if (sLine[0] != '\t')
 			continue;
 
@@ -94,17 +112,31 @@ int gettree(ttree_t *ptree, treeparam_t *pparam)
 		case '@':
 			// filename where function is defined
 			strcpy(sfilename, &sLine[2]);
+			ndef = NULL;
 			break;
 
 		case '$':
 			// add one node for each function definition
-			if (!ttreeaddnode(ptree, &sLine[2], sfilename))
+			ndef = ttreeaddnode(ptree, &sLine[2], sfilename);
+			if (!ndef)
 				goto cleanup_filein;
+			ndef->defkind |= TTREE_DEFFUNC;
+			gettreeextent(ndef, lineno);
 			break;
 		case '#':
 			// add one node for each macro definition
-			if (!ttreeaddnode(ptree, &sLine[2], sfilename))
+			ndef = ttreeaddnode(ptree, &sLine[2], sfilename);
+			if (!ndef)
 				goto cleanup_filein;
+			ndef->defkind |= TTREE_DEFMACRO;
+			gettreeextent(ndef, lineno);
+			break;
+		case '}':
+		case ')':
+			// end of the function or macro definition
+			if (ndef)
+				gettreeextent(ndef, lineno);
+			ndef = NULL;
 			break;
 		default:
 			break;
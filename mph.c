@@ -0,0 +1,276 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "mph.h"
+#endif // _ALL_IN_ONE
+
+#include <ccan/hash/hash.h>
+#include <ccan/ilog/ilog.h>
+#include <ccan/tal/tal.h>
+
+#define MPH_LAMBDA 5	       // average number of keys per bucket
+#define MPH_MAXPILOT (1 << 24) // pilots to try before changing seed
+#define MPH_MAXSEEDS 16	       // seeds to try before giving up
+
+static uint64_t mphhash(const char *key, uint64_t seed)
+{
+	return hash64_any(key, strlen(key), seed);
+}
+
+// 64 bit finalizer: every input bit affects every output bit
+static uint64_t mphmix(uint64_t v, uint64_t seed)
+{
+	uint64_t z = v + seed + 0x9e3779b97f4a7c15ULL;
+
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+
+	return z ^ (z >> 31);
+}
+
+static uint32_t mphbucket(const mph_t *pmph, uint64_t h)
+{
+	return (uint32_t)(h >> 32) % pmph->bucketno;
+}
+
+static uint32_t mphslot(const mph_t *pmph, uint64_t h, uint64_t pilot)
+{
+	// mixing after the displacement, so that no bit pattern shared by the
+	// keys of a bucket survives into the slot
+	return mphmix(h ^ pilot, pmph->seed) % pmph->keyno;
+}
+
+static uint64_t mphgetpilot(const mph_t *pmph, uint32_t bucket)
+{
+	uint64_t bit = (uint64_t)bucket * pmph->width;
+	unsigned shift = bit % 64;
+	uint64_t v;
+
+	if (pmph->width == 0)
+		return 0;
+
+	v = pmph->pilots[bit / 64] >> shift;
+	if (shift + pmph->width > 64)
+		v |= pmph->pilots[bit / 64 + 1] << (64 - shift);
+
+	return v & ((1ULL << pmph->width) - 1);
+}
+
+static void mphsetpilot(mph_t *pmph, uint32_t bucket, uint64_t pilot)
+{
+	uint64_t bit = (uint64_t)bucket * pmph->width;
+	unsigned shift = bit % 64;
+
+	if (pmph->width == 0)
+		return;
+
+	pmph->pilots[bit / 64] |= pilot << shift;
+	if (shift + pmph->width > 64)
+		pmph->pilots[bit / 64 + 1] |= pilot >> (64 - shift);
+}
+
+// search the pilot of every bucket for the current seed; returns the largest
+// pilot used or -1 if the seed has to be changed
+static int64_t mphsearch(mph_t *pmph, const uint64_t *hashes, uint32_t *pilot)
+{
+	uint32_t *bstart, *bkeys, *border, *sizestart, *slots;
+	uint64_t *taken;
+	uint32_t i, j, k, b, maxsize = 0;
+	int64_t maxpilot = -1;
+
+	bstart = tal_arrz(NULL, uint32_t, pmph->bucketno + 1);
+	bkeys = tal_arr(bstart, uint32_t, pmph->keyno);
+	border = tal_arr(bstart, uint32_t, pmph->bucketno);
+	taken = tal_arrz(bstart, uint64_t, pmph->keyno / 64 + 1);
+	if (!bstart || !bkeys || !border || !taken)
+		goto cleanup_fail;
+
+	// group keys by bucket
+	for (i = 0; i < pmph->keyno; i++)
+		bstart[mphbucket(pmph, hashes[i]) + 1]++;
+	for (b = 0; b < pmph->bucketno; b++) {
+		if (bstart[b + 1] > maxsize)
+			maxsize = bstart[b + 1];
+		bstart[b + 1] += bstart[b];
+	}
+	// pilot[] counts the keys already put in each bucket meanwhile
+	memset(pilot, 0, pmph->bucketno * sizeof(*pilot));
+	for (i = 0; i < pmph->keyno; i++) {
+		b = mphbucket(pmph, hashes[i]);
+		bkeys[bstart[b] + pilot[b]++] = i;
+	}
+
+	// place the biggest buckets first, while the table is still empty
+	sizestart = tal_arrz(bstart, uint32_t, maxsize + 2);
+	slots = tal_arr(bstart, uint32_t, maxsize + 1);
+	if (!sizestart || !slots)
+		goto cleanup_fail;
+	for (b = 0; b < pmph->bucketno; b++)
+		sizestart[maxsize - (bstart[b + 1] - bstart[b]) + 1]++;
+	for (k = 0; k <= maxsize; k++)
+		sizestart[k + 1] += sizestart[k];
+	for (b = 0; b < pmph->bucketno; b++)
+		border[sizestart[maxsize - (bstart[b + 1] - bstart[b])]++] = b;
+
+	for (k = 0; k < pmph->bucketno; k++) {
+		uint32_t *keys;
+		uint32_t size;
+		uint64_t p;
+
+		b = border[k];
+		keys = &bkeys[bstart[b]];
+		size = bstart[b + 1] - bstart[b];
+		if (size == 0)
+			break; // sorted by size, only empty buckets left
+
+		// identical hashes can't be told apart by any pilot
+		for (i = 0; i < size; i++)
+			for (j = 0; j < i; j++)
+				if (hashes[keys[i]] == hashes[keys[j]])
+					goto cleanup_fail;
+
+		for (p = 0; p < MPH_MAXPILOT; p++) {
+			for (i = 0; i < size; i++) {
+				slots[i] = mphslot(pmph, hashes[keys[i]], p);
+				if (taken[slots[i] / 64] &
+				    (1ULL << (slots[i] % 64)))
+					break;
+				for (j = 0; j < i; j++)
+					if (slots[j] == slots[i])
+						break;
+				if (j < i)
+					break;
+			}
+			if (i == size)
+				break;
+		}
+		if (p == MPH_MAXPILOT)
+			goto cleanup_fail;
+
+		for (i = 0; i < size; i++)
+			taken[slots[i] / 64] |= 1ULL << (slots[i] % 64);
+		pilot[b] = p;
+		if ((int64_t)p > maxpilot)
+			maxpilot = p;
+	}
+	if (maxpilot < 0)
+		maxpilot = 0;
+
+	tal_free(bstart);
+
+	return maxpilot;
+
+cleanup_fail:
+	tal_free(bstart);
+
+	return -1;
+}
+
+// build a minimal perfect hash function over keyno distinct keys: every key is
+// mapped to a different value in [0, keyno)
+mph_t *mphbuild(const void *ctx, const char **keys, uint32_t keyno)
+{
+	mph_t *pmph;
+	uint64_t *hashes;
+	uint32_t *pilot;
+	uint32_t i;
+	int64_t maxpilot = -1;
+	int iseed;
+
+	pmph = talz(ctx, mph_t);
+	if (!pmph) {
+		printf("\nMemory allocation error\n");
+		return NULL;
+	}
+
+	pmph->keyno = keyno;
+	pmph->bucketno = keyno / MPH_LAMBDA + 1;
+
+	hashes = tal_arr(pmph, uint64_t, keyno);
+	pilot = tal_arrz(pmph, uint32_t, pmph->bucketno);
+	if (!hashes || !pilot) {
+		printf("\nMemory allocation error\n");
+		goto cleanup_pmph;
+	}
+
+	for (iseed = 0; maxpilot < 0 && iseed < MPH_MAXSEEDS; iseed++) {
+		pmph->seed = mphmix(iseed, 0);
+		for (i = 0; i < keyno; i++)
+			hashes[i] = mphhash(keys[i], pmph->seed);
+		maxpilot = keyno ? mphsearch(pmph, hashes, pilot) : 0;
+	}
+
+	if (maxpilot < 0) {
+		printf("\nCould not build the symbol index\n");
+		goto cleanup_pmph;
+	}
+
+	pmph->width = ilog64(maxpilot);
+	pmph->pilots = tal_arrz(
+	    pmph, uint64_t,
+	    ((uint64_t)pmph->bucketno * pmph->width + 63) / 64 + 1);
+	if (!pmph->pilots) {
+		printf("\nMemory allocation error\n");
+		goto cleanup_pmph;
+	}
+	for (i = 0; i < pmph->bucketno; i++)
+		mphsetpilot(pmph, i, pilot[i]);
+
+	tal_free(hashes);
+	tal_free(pilot);
+
+	return pmph;
+
+cleanup_pmph:
+	tal_free(pmph);
+
+	return NULL;
+}
+
+// map a key to its slot: keys not in the set give an arbitrary slot, so the
+// caller has to check the key stored there
+uint32_t mphlookup(const mph_t *pmph, const char *key)
+{
+	uint64_t h;
+
+	if (pmph->keyno == 0)
+		return 0;
+
+	h = mphhash(key, pmph->seed);
+
+	return mphslot(pmph, h, mphgetpilot(pmph, mphbucket(pmph, h)));
+}
+
+// size of the function in bits, to report the space used per key
+size_t mphbits(const mph_t *pmph)
+{
+	return (size_t)pmph->bucketno * pmph->width;
+}
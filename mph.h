@@ -0,0 +1,48 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _MPH_H
+#define _MPH_H
+
+#include <stdint.h>
+
+// Minimal perfect hash function over a fixed set of strings, built with the
+// "hash and displace" scheme: keys are split into small buckets and each
+// bucket gets the smallest displacement (pilot) that sends all of its keys to
+// free slots. Pilots are bit-packed, so the function costs about 3-4 bits per
+// key and a lookup is one hash plus one displacement.
+typedef struct mph_st {
+	uint64_t seed;	// seed of the key hash
+	uint32_t keyno;	// number of keys = range of mphlookup()
+	uint32_t bucketno; // number of buckets
+	unsigned width;	// bits per packed pilot
+	uint64_t *pilots;  // packed pilots, one per bucket
+} mph_t;
+
+mph_t *mphbuild(const void *ctx, const char **keys, uint32_t keyno);
+uint32_t mphlookup(const mph_t *pmph, const char *key);
+size_t mphbits(const mph_t *pmph);
+
+#endif // #ifndef _MPH_H
@@ -0,0 +1,168 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outbetw.h"
+#include "outtree.h"
+#include "slib.h"
+#include "ttreebetw.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+// function in the table of the top ones
+typedef struct betwrank_st {
+	double score;
+	unsigned id;
+} betwrank_t;
+
+// decreasing score, ties in tree order
+static int betworder(const void *pa, const void *pb)
+{
+	const betwrank_t *a = pa, *b = pb;
+
+	if (a->score != b->score)
+		return a->score > b->score ? -1 : 1;
+
+	return a->id < b->id ? -1 : a->id > b->id;
+}
+
+// one function, the answerno-th
+static void betwrow(ttreetrav_t *ptrav, const ttreebetw_t *pbetw,
+		    ttreenode_t *pnode, treeparam_t *pparam, unsigned answerno)
+{
+	FILE *pfile = ptrav->outfile;
+
+	switch (pparam->outtype) {
+	case TREEOUT_TEXT:
+		fprintf(pfile, "\t%.1f\t%s\t%s\n", pbetw->score[pnode->id],
+			pnode->funname,
+			pnode->filename ? pnode->filename : TT_LIBRARY);
+		break;
+
+	case TREEOUT_JSON:
+		fprintf(pfile, "%s\n\t\t{\"name\": ", answerno ? "," : "");
+		slibjsonstr(pfile, pnode->funname);
+		fprintf(pfile, ", \"file\": ");
+		if (pnode->filename)
+			slibjsonstr(pfile, pnode->filename);
+		else
+			fprintf(pfile, "null");
+		fprintf(pfile, ", \"betweenness\": %.1f}",
+			pbetw->score[pnode->id]);
+		break;
+
+	default:
+		slibcsvstr(pfile, pnode->funname);
+		fputc(',', pfile);
+		if (pnode->filename)
+			slibcsvstr(pfile, pnode->filename);
+		fprintf(pfile, ",%.1f\n", pbetw->score[pnode->id]);
+		break;
+	}
+}
+
+// functions on the most shortest call chains between other functions: a
+// table of the top ones in text, all the functions in CSV or JSON
+int outbetweenness(const ttree_t *ptree, treeparam_t *pparam)
+{
+	ttreetrav_t *ptrav;
+	ttreebetw_t *pbetw = NULL;
+	betwrank_t *pranks = NULL;
+	unsigned i, n = 0;
+	int iErr = 0, iErrC;
+
+	if (pparam->verbose)
+		printf("\nComputing betweenness... ");
+
+	ptrav = ttreetravinit(ptree);
+	if (!ptrav)
+		return -1;
+
+	iErr = outtreeresolve(ptrav, pparam);
+	if (iErr == 0) {
+		pbetw = ttreebetwbuild(ptree, &ptrav->excluded,
+				       pparam->betwsamples,
+				       pparam->threadno);
+		pranks = malloc((ptree->nodeno + 1) * sizeof(*pranks));
+		if (!pranks)
+			printf("\nMemory allocation error\n");
+		if (!pbetw || !pranks)
+			iErr = -1;
+	}
+
+	if (iErr == 0)
+		iErr = outopen(ptrav, pparam);
+	if (iErr == 0) {
+		for (i = 0; i < ptree->nodeno; i++)
+			if (!ttreesetisin(&ptrav->excluded, i) &&
+			    (pparam->outtype != TREEOUT_TEXT ||
+			     pbetw->score[i] > 0)) {
+				pranks[n].score = pbetw->score[i];
+				pranks[n++].id = i;
+			}
+
+		if (pparam->outtype == TREEOUT_TEXT) {
+			qsort(pranks, n, sizeof(*pranks), betworder);
+			if (n > (unsigned)pparam->topno)
+				n = pparam->topno;
+			fprintf(ptrav->outfile,
+				"betweenness: functions on the most shortest "
+				"call chains, from %u of %u functions\n",
+				pbetw->sourceno, pbetw->nodeno);
+		} else if (pparam->outtype == TREEOUT_CSV)
+			fprintf(ptrav->outfile, "function,file,betweenness\n");
+		else
+			fprintf(ptrav->outfile,
+				"{\n\t\"sources\": %u,\n\t\"functions\": %u,"
+				"\n\t\"betweenness\": [",
+				pbetw->sourceno, pbetw->nodeno);
+
+		for (i = 0; i < n; i++)
+			betwrow(ptrav, pbetw, ptree->nodes[pranks[i].id],
+				pparam, i);
+
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "%s]\n}\n", n ? "\n\t" : "");
+
+		iErrC = outclose(ptrav, pparam);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	if (iErr == 0 && pparam->verbose)
+		printf("done\nShortest call chains followed from %u of %u "
+		       "functions\n",
+		       pbetw->sourceno, pbetw->nodeno);
+
+	free(pranks);
+	ttreebetwfree(pbetw);
+	ttreetravfree(ptrav);
+
+	return iErr;
+}
@@ -0,0 +1,537 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outbfs.h"
+#include "ttreesel.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+#define BFS_CHUNK 256 // frontier nodes or node ids taken by a thread at a time
+#define BFS_ALPHA 14  // bottom up when the frontier calls are more than
+		      // 1/BFS_ALPHA of the calls of the nodes not reached
+#define BFS_BETA 24   // top down again when the frontier nodes are less
+		      // than 1/BFS_BETA of all the nodes
+
+#define BFS_NODIST 0xffffffffu // node not reached yet
+#define BFS_NOKEY UINT64_MAX   // node not discovered in this level
+
+// what the threads do on the chunks of a level
+typedef enum bfsphase_e {
+	BFS_OWNER,    // frontier nodes claim their branches
+	BFS_TOPDOWN,  // frontier nodes discover their callees
+	BFS_BOTTOMUP, // nodes not reached look for callers in the frontier
+	BFS_COUNT,    // count the output and the next frontier of each chunk
+	BFS_WRITE,    // write them
+	BFS_INDEX,    // index of each branch among those of its node
+	BFS_QUIT,     // end of the scan
+} bfsphase_t;
+
+typedef struct bfs_st {
+	ttreetrav_t *ptrav;
+	int forward;	       // callees (else callers)
+	const unsigned *off;   // branches of node i in the scan direction:
+	ttreebranch_t **adj;   // adj[off[i]] up to adj[off[i+1]]
+	const unsigned *roff;  // branches of node i in the other direction
+	ttreebranch_t **radj;
+	unsigned *dist;	       // distance from the roots, ptrav->nodedist
+	uint64_t *owner;       // frontier node scanning the branches of a
+			       // node, see bfsadj(): bfskey(level, position)
+	uint64_t *key;	       // first discovery of a node, see bfskey()
+	unsigned *branchk;     // index of a branch in the adj of its node
+	unsigned level;	       // distance of the frontier from the roots
+	unsigned fhead;	       // frontier in ptrav->queue
+	unsigned ftail;
+	unsigned *outcnt;      // output entries of each chunk, then offsets
+	unsigned *newcnt;      // nodes discovered by each chunk, then offsets
+	uint64_t *degcnt;      // their branches in the scan direction
+	uint64_t *rdegcnt;     // their branches in the other direction
+	bfsphase_t phase;      // what the threads are doing
+	unsigned chunkno;      // chunks of the phase
+	unsigned next;	       // next chunk to take, atomic
+	unsigned threadno;     // threads of the scan, the calling one included
+	unsigned waiting;      // threads waiting in bfswait()
+	unsigned round;	       // times all the threads met in bfswait()
+	pthread_mutex_t lock;  // of waiting and round
+	pthread_cond_t met;    // round changed
+} bfs_t;
+
+// the serial scan, outdepth(), enqueues a node when it is first seen from
+// the branch of index k of the node at position i of the queue, so the
+// first discovery of a node is the lowest (i, k) among the frontier nodes
+// calling it; positions are never reused, so a key of a previous level
+// can't match one of the current level
+static inline uint64_t bfskey(unsigned i, unsigned k)
+{
+	return (uint64_t)i << 32 | k;
+}
+
+// the node whose branches are scanned for node x: callers are bound to the
+// first definition of a function name, see ttreecallers(), so all the
+// definitions of a name scan the same callers; only the first one to do it
+// finds branches not output and nodes not reached, hence the owner phase
+static inline unsigned bfsadj(const bfs_t *pbfs, unsigned x)
+{
+	const ttree_t *ptree = pbfs->ptrav->ptree;
+
+	return pbfs->forward ? x : ptree->namenode[ptree->nodes[x]->nameid]->id;
+}
+
+// the node a branch goes to in the scan direction
+static inline unsigned bfsnext(const bfs_t *pbfs, const ttreebranch_t *pbranch)
+{
+	return pbfs->forward ? pbranch->child.node->id :
+			       pbranch->parent.node->id;
+}
+
+// the node a branch comes from in the scan direction, as given by bfsadj()
+static inline unsigned bfsprev(const bfs_t *pbfs, const ttreebranch_t *pbranch)
+{
+	return pbfs->forward ? pbranch->parent.node->id :
+			       pbranch->child.node->id;
+}
+
+// branch output by the scan, as outaddbranch() would
+static inline int bfsbranchout(const bfs_t *pbfs,
+			       const ttreebranch_t *pbranch)
+{
+	const ttreetrav_t *ptrav = pbfs->ptrav;
+
+	return !bitsettestatomic(ptrav->branchout, pbranch->id) &&
+	       !ttreesetisin(&ptrav->excluded, pbranch->parent.node->id) &&
+	       !ttreesetisin(&ptrav->excluded, pbranch->child.node->id);
+}
+
+// lower a key to k, as several frontier nodes may claim it
+static inline void bfsclaim(uint64_t *pkey, uint64_t k)
+{
+	uint64_t old = __atomic_load_n(pkey, __ATOMIC_RELAXED);
+
+	while (k < old &&
+	       !__atomic_compare_exchange_n(pkey, &old, k, 1, __ATOMIC_RELAXED,
+					    __ATOMIC_RELAXED))
+		;
+}
+
+// the node whose branches the frontier node at position i scans, or
+// BFS_NODIST if another one does it, at this level or before
+static inline unsigned bfsowned(const bfs_t *pbfs, unsigned i)
+{
+	unsigned u = bfsadj(pbfs, pbfs->ptrav->queue[i]);
+
+	return pbfs->owner[u] == bfskey(pbfs->level, i) ? u : BFS_NODIST;
+}
+
+// the lowest key wins, and a node scanned before has a lower level
+static void bfsowner(bfs_t *pbfs, unsigned lo, unsigned hi)
+{
+	unsigned i;
+
+	for (i = lo; i < hi; i++)
+		bfsclaim(&pbfs->owner[bfsadj(pbfs, pbfs->ptrav->queue[i])],
+			 bfskey(pbfs->level, i));
+}
+
+static void bfstopdown(bfs_t *pbfs, unsigned lo, unsigned hi)
+{
+	const ttreetrav_t *ptrav = pbfs->ptrav;
+	unsigned i, k, u, v, deg;
+
+	for (i = lo; i < hi; i++) {
+		if ((u = bfsowned(pbfs, i)) == BFS_NODIST)
+			continue;
+		deg = pbfs->off[u + 1] - pbfs->off[u];
+		for (k = 0; k < deg; k++) {
+			v = bfsnext(pbfs, pbfs->adj[pbfs->off[u] + k]);
+			if (pbfs->dist[v] == BFS_NODIST &&
+			    !ttreesetisin(&ptrav->excluded, v))
+				bfsclaim(&pbfs->key[v], bfskey(i, k));
+		}
+	}
+}
+
+// each node is looked at by one thread, so no atomic is needed; all the
+// callers in the frontier are looked at, to find the same key as top down
+static void bfsbottomup(bfs_t *pbfs, unsigned lo, unsigned hi)
+{
+	const ttreetrav_t *ptrav = pbfs->ptrav;
+	const ttreebranch_t *pbranch;
+	unsigned v, u, j;
+	uint64_t k, key, owner;
+
+	for (v = lo; v < hi; v++) {
+		if (pbfs->dist[v] != BFS_NODIST ||
+		    ttreesetisin(&ptrav->excluded, v))
+			continue;
+		key = BFS_NOKEY;
+		for (j = pbfs->roff[v]; j < pbfs->roff[v + 1]; j++) {
+			pbranch = pbfs->radj[j];
+			u = bfsprev(pbfs, pbranch);
+			owner = pbfs->owner[u];
+			if (owner >> 32 != pbfs->level)
+				continue;
+			k = bfskey((unsigned)owner, pbfs->branchk[pbranch->id]);
+			if (k < key)
+				key = k;
+		}
+		pbfs->key[v] = key;
+	}
+}
+
+// output entries and next frontier nodes of chunk c, in the order of the
+// serial scan: each branch, then the node it discovers
+static void bfscount(bfs_t *pbfs, unsigned c, unsigned lo, unsigned hi)
+{
+	const ttreetrav_t *ptrav = pbfs->ptrav;
+	const ttreebranch_t *pbranch;
+	unsigned i, k, u, v, w, deg, outn = 0, newn = 0;
+	uint64_t degn = 0, rdegn = 0;
+
+	for (i = lo; i < hi; i++) {
+		if ((u = bfsowned(pbfs, i)) == BFS_NODIST)
+			continue;
+		deg = pbfs->off[u + 1] - pbfs->off[u];
+		for (k = 0; k < deg; k++) {
+			pbranch = pbfs->adj[pbfs->off[u] + k];
+			outn += bfsbranchout(pbfs, pbranch);
+			v = bfsnext(pbfs, pbranch);
+			if (pbfs->key[v] != bfskey(i, k))
+				continue;
+			newn++;
+			outn += !bitsettestatomic(ptrav->nodeout, v);
+			w = bfsadj(pbfs, v);
+			degn += pbfs->off[w + 1] - pbfs->off[w];
+			rdegn += pbfs->roff[v + 1] - pbfs->roff[v];
+		}
+	}
+
+	pbfs->outcnt[c] = outn;
+	pbfs->newcnt[c] = newn;
+	pbfs->degcnt[c] = degn;
+	pbfs->rdegcnt[c] = rdegn;
+}
+
+// a chunk writes from the offsets of bfscount(); a branch or a node is only
+// tested and marked by the chunk that outputs it, but the marks are bits, so
+// the words they share with other chunks are tested and set atomically
+static void bfswrite(bfs_t *pbfs, unsigned c, unsigned lo, unsigned hi)
+{
+	ttreetrav_t *ptrav = pbfs->ptrav;
+	const ttreebranch_t *pbranch;
+	unsigned i, k, u, v, deg;
+	unsigned o = pbfs->outcnt[c], q = pbfs->newcnt[c];
+
+	for (i = lo; i < hi; i++) {
+		if ((u = bfsowned(pbfs, i)) == BFS_NODIST)
+			continue;
+		deg = pbfs->off[u + 1] - pbfs->off[u];
+		for (k = 0; k < deg; k++) {
+			pbranch = pbfs->adj[pbfs->off[u] + k];
+			if (bfsbranchout(pbfs, pbranch)) {
+				bitsetsetatomic(ptrav->branchout, pbranch->id);
+				ptrav->outlist[o++] =
+				    pbranch->id << 1 | TTREETRAV_BRANCH;
+			}
+			v = bfsnext(pbfs, pbranch);
+			if (pbfs->key[v] != bfskey(i, k))
+				continue;
+			pbfs->dist[v] = pbfs->level + 1;
+			ptrav->queue[q++] = v;
+			if (!bitsettestatomic(ptrav->nodeout, v)) {
+				bitsetsetatomic(ptrav->nodeout, v);
+				ptrav->outlist[o++] = v << 1;
+			}
+		}
+	}
+}
+
+static void bfsindex(bfs_t *pbfs, unsigned lo, unsigned hi)
+{
+	unsigned u, k;
+
+	for (u = lo; u < hi; u++)
+		for (k = 0; k < pbfs->off[u + 1] - pbfs->off[u]; k++)
+			pbfs->branchk[pbfs->adj[pbfs->off[u] + k]->id] = k;
+}
+
+// take chunks of the current phase until there are none left: threads with
+// cheap chunks take more of them, so that the load stays balanced
+static void bfsrun(bfs_t *pbfs)
+{
+	unsigned c, lo, hi, n;
+
+	while ((c = __atomic_fetch_add(&pbfs->next, 1, __ATOMIC_RELAXED)) <
+	       pbfs->chunkno) {
+		if (pbfs->phase == BFS_BOTTOMUP || pbfs->phase == BFS_INDEX) {
+			// node ids
+			n = pbfs->ptrav->ptree->nodeno;
+			lo = c * BFS_CHUNK;
+		} else {
+			// frontier positions
+			n = pbfs->ftail;
+			lo = pbfs->fhead + c * BFS_CHUNK;
+		}
+		hi = lo + BFS_CHUNK < n ? lo + BFS_CHUNK : n;
+
+		switch (pbfs->phase) {
+		case BFS_OWNER:
+			bfsowner(pbfs, lo, hi);
+			break;
+		case BFS_TOPDOWN:
+			bfstopdown(pbfs, lo, hi);
+			break;
+		case BFS_BOTTOMUP:
+			bfsbottomup(pbfs, lo, hi);
+			break;
+		case BFS_COUNT:
+			bfscount(pbfs, c, lo, hi);
+			break;
+		case BFS_WRITE:
+			bfswrite(pbfs, c, lo, hi);
+			break;
+		case BFS_INDEX:
+			bfsindex(pbfs, lo, hi);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+// wait until all the threads get here, before and after each phase
+static void bfswait(bfs_t *pbfs)
+{
+	unsigned round;
+
+	pthread_mutex_lock(&pbfs->lock);
+	round = pbfs->round;
+	if (++pbfs->waiting == pbfs->threadno) {
+		pbfs->waiting = 0;
+		pbfs->round++;
+		pthread_cond_broadcast(&pbfs->met);
+	} else {
+		while (round == pbfs->round)
+			pthread_cond_wait(&pbfs->met, &pbfs->lock);
+	}
+	pthread_mutex_unlock(&pbfs->lock);
+}
+
+static void *bfsworker(void *arg)
+{
+	bfs_t *pbfs = arg;
+
+	for (;;) {
+		bfswait(pbfs);
+		if (pbfs->phase == BFS_QUIT)
+			break;
+		bfsrun(pbfs);
+		bfswait(pbfs);
+	}
+
+	return NULL;
+}
+
+// run a phase on all the threads, the calling one included
+static void bfsphase(bfs_t *pbfs, bfsphase_t phase, unsigned n)
+{
+	pbfs->phase = phase;
+	pbfs->chunkno = (n + BFS_CHUNK - 1) / BFS_CHUNK;
+	pbfs->next = 0;
+
+	bfswait(pbfs);
+	bfsrun(pbfs);
+	bfswait(pbfs);
+}
+
+// the levels of the scan: each level is discovered top down or bottom up,
+// whichever has fewer branches to look at, then counted and written by
+// chunks, so that the output is the same as the serial one
+static void bfslevels(bfs_t *pbfs, int depth, unsigned tail)
+{
+	ttreetrav_t *ptrav = pbfs->ptrav;
+	unsigned nodeno = ptrav->ptree->nodeno;
+	unsigned c, n, outn, newn;
+	uint64_t mf = 0, mu = ptrav->ptree->branchno, deg, rdeg;
+	int bottomup = 0, indexed = 0;
+
+	for (c = pbfs->fhead; c < tail; c++) {
+		n = bfsadj(pbfs, ptrav->queue[c]);
+		mf += pbfs->off[n + 1] - pbfs->off[n];
+		n = ptrav->queue[c];
+		mu -= pbfs->roff[n + 1] - pbfs->roff[n];
+	}
+
+	pbfs->ftail = tail;
+	while (pbfs->fhead < pbfs->ftail &&
+	       (depth < 0 || pbfs->level < (unsigned)depth)) {
+		// Beamer's heuristic
+		n = pbfs->ftail - pbfs->fhead;
+		if (!bottomup && mf > mu / BFS_ALPHA)
+			bottomup = 1;
+		else if (bottomup && n < nodeno / BFS_BETA)
+			bottomup = 0;
+		if (bottomup && !indexed) {
+			bfsphase(pbfs, BFS_INDEX, nodeno);
+			indexed = 1;
+		}
+
+		bfsphase(pbfs, BFS_OWNER, n);
+		if (bottomup)
+			bfsphase(pbfs, BFS_BOTTOMUP, nodeno);
+		else
+			bfsphase(pbfs, BFS_TOPDOWN, n);
+		bfsphase(pbfs, BFS_COUNT, n);
+
+		// offsets of the chunks
+		outn = ptrav->outno;
+		newn = pbfs->ftail;
+		mf = 0;
+		for (c = 0; c < pbfs->chunkno; c++) {
+			n = pbfs->outcnt[c];
+			pbfs->outcnt[c] = outn;
+			outn += n;
+			n = pbfs->newcnt[c];
+			pbfs->newcnt[c] = newn;
+			newn += n;
+			deg = pbfs->degcnt[c];
+			rdeg = pbfs->rdegcnt[c];
+			mf += deg;
+			mu -= rdeg;
+		}
+
+		bfsphase(pbfs, BFS_WRITE, pbfs->ftail - pbfs->fhead);
+
+		ptrav->outno = outn;
+		pbfs->fhead = pbfs->ftail;
+		pbfs->ftail = newn;
+		pbfs->level++;
+	}
+}
+
+// output of the nodes within depth calls from the roots, or from proot alone,
+// as outdepth() but with each level of the breadth first scan spread over
+// threadno threads; the output is the same whatever the number of threads
+int outbfs(ttreetrav_t *ptrav, ttreenode_t *proot, int forward, int depth,
+	   int threadno)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	bfs_t bfs;
+	pthread_t *pthreads;
+	ttreenode_t *pnode;
+	unsigned r, id, i, tail = 0, chunkmax;
+	int t, iErr = 0;
+
+	memset(&bfs, 0, sizeof(bfs));
+	bfs.ptrav = ptrav;
+	bfs.forward = forward;
+	bfs.off = forward ? ptree->calleeoff : ptree->calleroff;
+	bfs.adj = forward ? ptree->calleebranch : ptree->callerbranch;
+	bfs.roff = forward ? ptree->calleroff : ptree->calleeoff;
+	bfs.radj = forward ? ptree->callerbranch : ptree->calleebranch;
+	bfs.dist = ptrav->nodedist;
+
+	chunkmax = ptree->nodeno / BFS_CHUNK + 1;
+	bfs.owner = malloc((ptree->nodeno + 1) * sizeof(uint64_t));
+	bfs.key = malloc((ptree->nodeno + 1) * sizeof(uint64_t));
+	bfs.branchk = malloc((ptree->branchno + 1) * sizeof(unsigned));
+	bfs.outcnt = malloc(chunkmax * sizeof(unsigned));
+	bfs.newcnt = malloc(chunkmax * sizeof(unsigned));
+	bfs.degcnt = malloc(chunkmax * sizeof(uint64_t));
+	bfs.rdegcnt = malloc(chunkmax * sizeof(uint64_t));
+	pthreads = malloc(threadno * sizeof(pthread_t));
+	if (!bfs.owner || !bfs.key || !bfs.branchk || !bfs.outcnt ||
+	    !bfs.newcnt || !bfs.degcnt || !bfs.rdegcnt || !pthreads) {
+		printf("\nMemory allocation error\n");
+		iErr = -1;
+		goto cleanup;
+	}
+	memset(bfs.dist, 0xff, ptree->nodeno * sizeof(unsigned));
+	memset(bfs.key, 0xff, ptree->nodeno * sizeof(uint64_t));
+	memset(bfs.owner, 0xff, ptree->nodeno * sizeof(uint64_t));
+
+	// nodes whose subtree is done are reached already, see outdepth()
+	if (proot)
+		for (i = 0; i < ptree->nodeno; i++)
+			if (bitsettest(ptrav->subtreeout, i))
+				bfs.dist[i] = 0;
+
+	// the roots are the first frontier
+	for (r = 0; r < (proot ? 1 : ptrav->roots.nodeno); r++) {
+		pnode = proot ? proot : ptrav->roots.nodes[r];
+		id = pnode->id;
+		if (ttreesetisin(&ptrav->excluded, id))
+			continue;
+
+		bfs.dist[id] = 0;
+		ptrav->queue[tail++] = id;
+		if (!bitsettest(ptrav->nodeout, id)) {
+			bitsetset(ptrav->nodeout, id);
+			ptrav->outlist[ptrav->outno++] = id << 1;
+		}
+	}
+
+	pthread_mutex_init(&bfs.lock, NULL);
+	pthread_cond_init(&bfs.met, NULL);
+	bfs.threadno = threadno;
+	for (t = 0; t < threadno - 1; t++)
+		if (pthread_create(&pthreads[t], NULL, bfsworker, &bfs) != 0)
+			break;
+	// if some thread couldn't start, the scan goes on with fewer: the
+	// calling thread hasn't waited yet, so no wait can be over
+	pthread_mutex_lock(&bfs.lock);
+	bfs.threadno = t + 1;
+	pthread_mutex_unlock(&bfs.lock);
+
+	bfslevels(&bfs, depth, tail);
+	if (proot)
+		for (i = 0; i < bfs.ftail; i++)
+			bitsetset(ptrav->subtreeout, ptrav->queue[i]);
+
+	bfs.phase = BFS_QUIT;
+	bfswait(&bfs);
+	while (t-- > 0)
+		pthread_join(pthreads[t], NULL);
+	pthread_mutex_destroy(&bfs.lock);
+	pthread_cond_destroy(&bfs.met);
+
+cleanup:
+	free(bfs.owner);
+	free(bfs.key);
+	free(bfs.branchk);
+	free(bfs.outcnt);
+	free(bfs.newcnt);
+	free(bfs.degcnt);
+	free(bfs.rdegcnt);
+	free(pthreads);
+
+	return iErr;
+}
@@ -0,0 +1,234 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outdead.h"
+#include "outgraphviz.h"
+#include "outtree.h"
+#include "slib.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+// mark in ptrav->nodeseen the nodes reached from all the roots at once,
+// without going through the excluded nodes
+static void deadscan(ttreetrav_t *ptrav)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	unsigned r, head = 0, tail = 0;
+	ttreenode_t *pnode;
+	ttreebranch_t *pbranch;
+	ttreeiter_t iter;
+
+	bitsetzero(ptrav->nodeseen, ptree->nodeno);
+	for (r = 0; r < ptrav->roots.nodeno; r++) {
+		pnode = ptrav->roots.nodes[r];
+		if (ttreesetisin(&ptrav->excluded, pnode->id) ||
+		    bitsettest(ptrav->nodeseen, pnode->id))
+			continue;
+		bitsetset(ptrav->nodeseen, pnode->id);
+		ptrav->queue[tail++] = pnode->id;
+	}
+
+	while (head < tail) {
+		pnode = ptree->nodes[ptrav->queue[head++]];
+		ttreecallees(ptree, pnode, &iter);
+		while ((pbranch = ttreeiternext(&iter)) != NULL) {
+			pnode = pbranch->child.node;
+			if (bitsettest(ptrav->nodeseen, pnode->id) ||
+			    ttreesetisin(&ptrav->excluded, pnode->id))
+				continue;
+			bitsetset(ptrav->nodeseen, pnode->id);
+			ptrav->queue[tail++] = pnode->id;
+		}
+	}
+}
+
+// 1 if the node is defined as a function (not only as a macro) and not
+// excluded, so that it is reported if not reached
+static int deaddefined(const ttreetrav_t *ptrav, unsigned id)
+{
+	return (ptrav->ptree->nodes[id]->defkind & TTREE_DEFFUNC) &&
+	       !ttreesetisin(&ptrav->excluded, id);
+}
+
+// output the dead functions of one file, the fileno-th with some
+static int deadfile(ttreetrav_t *ptrav, const unsigned *pdead,
+		    unsigned deadno, treeparam_t *pparam, unsigned fileno)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	FILE *pfile = ptrav->outfile;
+	const char *sfile = ptree->nodes[pdead[0]]->filename;
+	ttreenode_t *pnode;
+	ttreebranch_t *pbranch;
+	ttreeiter_t iter;
+	unsigned i;
+	int iErr = 0;
+
+	switch (pparam->outtype) {
+	case TREEOUT_GRAPHVIZ:
+		// a cluster per file, with the calls between dead functions
+		fprintf(pfile, "\tsubgraph cluster_dead_%u {\n"
+			       "\tlabel=\"%s\"; labeljust=\"l\";\n",
+			fileno, sfile);
+		for (i = 0; iErr == 0 && i < deadno; i++)
+			iErr = outnode_gra(ptrav, ptree->nodes[pdead[i]],
+					   pparam);
+		fprintf(pfile, "\t}\n");
+		for (i = 0; iErr == 0 && i < deadno; i++) {
+			ttreecallees(ptree, ptree->nodes[pdead[i]], &iter);
+			while (iErr == 0 &&
+			       (pbranch = ttreeiternext(&iter)) != NULL) {
+				pnode = pbranch->child.node;
+				if (deaddefined(ptrav, pnode->id) &&
+				    !bitsettest(ptrav->nodeseen, pnode->id))
+					iErr = outbranch_gra(ptrav, pbranch,
+							     pparam);
+			}
+		}
+		break;
+
+	case TREEOUT_TEXT:
+		fprintf(pfile, "%s\n", sfile);
+		for (i = 0; i < deadno; i++)
+			fprintf(pfile, "\t%s\n", ptree->nodes[pdead[i]]->funname);
+		break;
+
+	case TREEOUT_JSON:
+		fprintf(pfile, "%s\n\t\t{\"file\": ", fileno ? "," : "");
+		slibjsonstr(pfile, sfile);
+		fprintf(pfile, ", \"functions\": [");
+		for (i = 0; i < deadno; i++) {
+			fprintf(pfile, "%s", i ? ", " : "");
+			slibjsonstr(pfile, ptree->nodes[pdead[i]]->funname);
+		}
+		fprintf(pfile, "]}");
+		break;
+
+	case TREEOUT_CSV:
+		for (i = 0; i < deadno; i++) {
+			slibcsvstr(pfile, sfile);
+			fputc(',', pfile);
+			slibcsvstr(pfile, ptree->nodes[pdead[i]]->funname);
+			fputc('\n', pfile);
+		}
+		break;
+
+	default:
+		iErr = -1;
+		break;
+	}
+
+	return iErr;
+}
+
+// functions defined in the database ($ marks, macros are left out) and never
+// reached from the roots, grouped by file; excluded functions are neither
+// scanned nor reported
+int outdead(const ttree_t *ptree, treeparam_t *pparam)
+{
+	ttreetrav_t *ptrav;
+	unsigned *pdead = NULL, *pfileoff = NULL;
+	unsigned i, f, deadno = 0, defno = 0, fileno = 0;
+	ttreenode_t *pnode;
+	int iErr = 0, iErrC;
+
+	if (pparam->verbose)
+		printf("\nFinding dead functions... ");
+
+	ptrav = ttreetravinit(ptree);
+	if (!ptrav)
+		return -1;
+
+	iErr = outtreeresolve(ptrav, pparam);
+	if (iErr == 0) {
+		pdead = malloc((ptree->nodeno + 1) * sizeof(unsigned));
+		pfileoff = calloc(ptree->fileno + 2, sizeof(unsigned));
+		if (!pdead || !pfileoff) {
+			printf("\nMemory allocation error\n");
+			iErr = -1;
+		}
+	}
+
+	if (iErr == 0) {
+		deadscan(ptrav);
+
+		// dead functions by file, in file name then definition order
+		for (i = 0; i < ptree->nodeno; i++) {
+			pnode = ptree->nodes[i];
+			if (!deaddefined(ptrav, i))
+				continue;
+			defno++;
+			if (!bitsettest(ptrav->nodeseen, i))
+				pfileoff[pnode->fileid + 2]++;
+		}
+		for (f = 0; f < ptree->fileno; f++)
+			pfileoff[f + 2] += pfileoff[f + 1];
+		for (i = 0; i < ptree->nodeno; i++) {
+			pnode = ptree->nodes[i];
+			if (deaddefined(ptrav, i) &&
+			    !bitsettest(ptrav->nodeseen, i))
+				pdead[pfileoff[pnode->fileid + 1]++] = i;
+		}
+		deadno = pfileoff[ptree->fileno];
+
+		iErr = outopen(ptrav, pparam);
+	}
+	if (iErr == 0) {
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "{\n\t\"dead\": [");
+		else if (pparam->outtype == TREEOUT_CSV)
+			fprintf(ptrav->outfile, "file,function\n");
+
+		// the dead functions of file f are from pfileoff[f] on
+		for (f = 0; iErr == 0 && f < ptree->fileno; f++)
+			if (pfileoff[f + 1] > pfileoff[f])
+				iErr = deadfile(ptrav, &pdead[pfileoff[f]],
+						pfileoff[f + 1] - pfileoff[f],
+						pparam, fileno++);
+
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "%s]\n}\n",
+				fileno ? "\n\t" : "");
+
+		iErrC = outclose(ptrav, pparam);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	if (iErr == 0 && pparam->verbose)
+		printf("done\n%u of %u functions defined are dead, in %u "
+		       "files\n",
+		       deadno, defno, fileno);
+
+	free(pdead);
+	free(pfileoff);
+	ttreetravfree(ptrav);
+
+	return iErr;
+}
@@ -0,0 +1,444 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "gettree.h"
+#include "outdiff.h"
+#include "outtree.h"
+#include "slib.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+#define DIFF_OLD 1 // in the old tree
+#define DIFF_NEW 2 // in the new tree
+
+// one of the two trees compared
+typedef struct diffside_st {
+	const ttree_t *ptree;
+	ttreetrav_t *ptrav; // for the -x functions of this tree
+	ttreenode_t **sorted; // nodes not excluded, by name and file
+	unsigned sortedno;
+	ttreenode_t **names; // first definition of each name, by name
+	unsigned *nodekey;   // joint key of each node
+	unsigned *namekey;   // joint key of each function name
+	uint64_t *calls; // caller node key << 32 | callee name key, sorted
+	unsigned callno; // calls, each pair of caller and callee once
+} diffside_t;
+
+// keys shared by the two trees: equal functions, same name and file, have
+// the same key, and so have equal names
+typedef struct diff_st {
+	diffside_t side[2];	    // old and new
+	const ttreenode_t **nodes;  // node of each key, the new one if both
+	unsigned char *nodein;	    // DIFF_OLD | DIFF_NEW, trees with the node
+	unsigned nodekeyno;
+	const ttreenode_t **names;  // a node with the name of each key
+	unsigned namekeyno;
+} diff_t;
+
+static int diffnameorder(const void *pa, const void *pb)
+{
+	const ttreenode_t *a = *(ttreenode_t *const *)pa;
+	const ttreenode_t *b = *(ttreenode_t *const *)pb;
+
+	return strcmp(a->funname, b->funname);
+}
+
+// by name, then file, library functions first
+static int diffnodeorder(const void *pa, const void *pb)
+{
+	const ttreenode_t *a = *(ttreenode_t *const *)pa;
+	const ttreenode_t *b = *(ttreenode_t *const *)pb;
+	int c = strcmp(a->funname, b->funname);
+
+	if (c != 0)
+		return c;
+	if (!a->filename || !b->filename)
+		return !!a->filename - !!b->filename;
+
+	return strcmp(a->filename, b->filename);
+}
+
+static int diffcallorder(const void *pa, const void *pb)
+{
+	uint64_t a = *(const uint64_t *)pa, b = *(const uint64_t *)pb;
+
+	return a < b ? -1 : a > b;
+}
+
+// merge join of the nodes of the two trees, each sorted by cmp: a node
+// gets the key of an equal one of the other tree, else a key of its own;
+// keys are indexed by name id if byname, else by node id; returns the
+// number of keys
+static unsigned diffjoin(diff_t *pdiff, int byname,
+			 int (*cmp)(const void *, const void *))
+{
+	diffside_t *pold = &pdiff->side[0], *pnew = &pdiff->side[1];
+	ttreenode_t **a = byname ? pold->names : pold->sorted;
+	ttreenode_t **b = byname ? pnew->names : pnew->sorted;
+	unsigned an = byname ? pold->ptree->nameno : pold->sortedno;
+	unsigned bn = byname ? pnew->ptree->nameno : pnew->sortedno;
+	unsigned *akey = byname ? pold->namekey : pold->nodekey;
+	unsigned *bkey = byname ? pnew->namekey : pnew->nodekey;
+	const ttreenode_t **pjoint = byname ? pdiff->names : pdiff->nodes;
+	unsigned i = 0, j = 0, k = 0;
+	unsigned char in;
+	int c;
+
+	while (i < an || j < bn) {
+		if (i == an)
+			c = 1;
+		else if (j == bn)
+			c = -1;
+		else
+			c = cmp(&a[i], &b[j]);
+
+		in = 0;
+		if (c <= 0) {
+			akey[byname ? a[i]->nameid : a[i]->id] = k;
+			pjoint[k] = a[i++];
+			in |= DIFF_OLD;
+		}
+		if (c >= 0) {
+			bkey[byname ? b[j]->nameid : b[j]->id] = k;
+			pjoint[k] = b[j++];
+			in |= DIFF_NEW;
+		}
+		if (!byname)
+			pdiff->nodein[k] = in;
+		k++;
+	}
+
+	return k;
+}
+
+// sorted nodes and names of one tree
+static int diffsort(diffside_t *pside)
+{
+	const ttree_t *ptree = pside->ptree;
+	unsigned i;
+
+	pside->sorted = malloc((ptree->nodeno + 1) * sizeof(ttreenode_t *));
+	pside->names = malloc((ptree->nameno + 1) * sizeof(ttreenode_t *));
+	pside->nodekey = malloc((ptree->nodeno + 1) * sizeof(unsigned));
+	pside->namekey = malloc((ptree->nameno + 1) * sizeof(unsigned));
+	if (!pside->sorted || !pside->names || !pside->nodekey ||
+	    !pside->namekey)
+		return -1;
+
+	for (i = 0; i < ptree->nodeno; i++)
+		if (!ttreesetisin(&pside->ptrav->excluded, i))
+			pside->sorted[pside->sortedno++] = ptree->nodes[i];
+	qsort(pside->sorted, pside->sortedno, sizeof(ttreenode_t *),
+	      diffnodeorder);
+
+	memcpy(pside->names, ptree->namenode,
+	       ptree->nameno * sizeof(ttreenode_t *));
+	qsort(pside->names, ptree->nameno, sizeof(ttreenode_t *),
+	      diffnameorder);
+
+	return 0;
+}
+
+// calls of one tree as keys, once each; a call is to a name, as cscope
+// records it, so the file of the callee doesn't matter
+static int diffcalls(diffside_t *pside)
+{
+	const ttree_t *ptree = pside->ptree;
+	const ttreeset_t *pexcluded = &pside->ptrav->excluded;
+	ttreebranch_t *pbranch;
+	unsigned i, n = 0;
+
+	pside->calls = malloc((ptree->branchno + 1) * sizeof(uint64_t));
+	if (!pside->calls)
+		return -1;
+
+	for (i = 0; i < ptree->branchno; i++) {
+		pbranch = ptree->branches[i];
+		if (ttreesetisin(pexcluded, pbranch->parent.node->id) ||
+		    ttreesetisin(pexcluded, pbranch->child.node->id))
+			continue;
+		pside->calls[n++] =
+		    (uint64_t)pside->nodekey[pbranch->parent.node->id] << 32 |
+		    pside->namekey[pbranch->child.node->nameid];
+	}
+	qsort(pside->calls, n, sizeof(uint64_t), diffcallorder);
+
+	for (i = 0; i < n; i++)
+		if (pside->callno == 0 ||
+		    pside->calls[i] != pside->calls[pside->callno - 1])
+			pside->calls[pside->callno++] = pside->calls[i];
+
+	return 0;
+}
+
+static void diffsidefree(diffside_t *pside)
+{
+	free(pside->sorted);
+	free(pside->names);
+	free(pside->nodekey);
+	free(pside->namekey);
+	free(pside->calls);
+	ttreetravfree(pside->ptrav);
+}
+
+// one function added or removed, the answerno-th of its kind
+static void difffunction(FILE *pfile, const ttreenode_t *pnode, int added,
+			 treeparam_t *pparam, unsigned answerno)
+{
+	switch (pparam->outtype) {
+	case TREEOUT_GRAPHVIZ:
+		fprintf(pfile, "\t%s [color=\"%s\",fontcolor=\"%s\"];\n",
+			pnode->funname, added ? "green" : "red",
+			added ? "green" : "red");
+		break;
+
+	case TREEOUT_TEXT:
+		fprintf(pfile, "%c %s (%s)\n", added ? '+' : '-',
+			pnode->funname,
+			pnode->filename ? pnode->filename : TT_LIBRARY);
+		break;
+
+	case TREEOUT_JSON:
+		fprintf(pfile, "%s\n\t\t\t{\"name\": ", answerno ? "," : "");
+		slibjsonstr(pfile, pnode->funname);
+		fprintf(pfile, ", \"file\": ");
+		if (pnode->filename)
+			slibjsonstr(pfile, pnode->filename);
+		else
+			fprintf(pfile, "null");
+		fprintf(pfile, "}");
+		break;
+
+	default:
+		fprintf(pfile, "%s,function,", added ? "added" : "removed");
+		slibcsvstr(pfile, pnode->funname);
+		fputc(',', pfile);
+		if (pnode->filename)
+			slibcsvstr(pfile, pnode->filename);
+		fprintf(pfile, ",\n");
+		break;
+	}
+}
+
+// one call added or removed, the answerno-th of its kind
+static void diffcall(FILE *pfile, const diff_t *pdiff, uint64_t call,
+		     int added, treeparam_t *pparam, unsigned answerno)
+{
+	const ttreenode_t *pcaller = pdiff->nodes[call >> 32];
+	const char *scallee = pdiff->names[(uint32_t)call]->funname;
+
+	switch (pparam->outtype) {
+	case TREEOUT_GRAPHVIZ:
+		fprintf(pfile, "\t%s->%s [color=\"%s\"];\n", pcaller->funname,
+			scallee, added ? "green" : "red");
+		break;
+
+	case TREEOUT_TEXT:
+		fprintf(pfile, "%c %s (%s) -> %s\n", added ? '+' : '-',
+			pcaller->funname,
+			pcaller->filename ? pcaller->filename : TT_LIBRARY,
+			scallee);
+		break;
+
+	case TREEOUT_JSON:
+		fprintf(pfile, "%s\n\t\t\t{\"caller\": ", answerno ? "," : "");
+		slibjsonstr(pfile, pcaller->funname);
+		fprintf(pfile, ", \"file\": ");
+		if (pcaller->filename)
+			slibjsonstr(pfile, pcaller->filename);
+		else
+			fprintf(pfile, "null");
+		fprintf(pfile, ", \"callee\": ");
+		slibjsonstr(pfile, scallee);
+		fprintf(pfile, "}");
+		break;
+
+	default:
+		fprintf(pfile, "%s,call,", added ? "added" : "removed");
+		slibcsvstr(pfile, pcaller->funname);
+		fputc(',', pfile);
+		if (pcaller->filename)
+			slibcsvstr(pfile, pcaller->filename);
+		fputc(',', pfile);
+		slibcsvstr(pfile, scallee);
+		fputc('\n', pfile);
+		break;
+	}
+}
+
+// the functions added (or removed), in key order; returns how many
+static unsigned difffunctions(FILE *pfile, const diff_t *pdiff, int added,
+			      treeparam_t *pparam)
+{
+	unsigned k, n = 0;
+
+	if (pparam->outtype == TREEOUT_JSON)
+		fprintf(pfile, "\t\t\"%s\": [", added ? "added" : "removed");
+	for (k = 0; k < pdiff->nodekeyno; k++)
+		if (pdiff->nodein[k] == (added ? DIFF_NEW : DIFF_OLD))
+			difffunction(pfile, pdiff->nodes[k], added, pparam,
+				     n++);
+	if (pparam->outtype == TREEOUT_JSON)
+		fprintf(pfile, "%s]", n ? "\n\t\t" : "");
+
+	return n;
+}
+
+// merge join of the calls of the two trees: the calls of one tree only
+// are added (or removed); returns how many
+static unsigned diffchanges(FILE *pfile, const diff_t *pdiff, int added,
+			    treeparam_t *pparam)
+{
+	const diffside_t *pa = &pdiff->side[added ? 1 : 0];
+	const diffside_t *pb = &pdiff->side[added ? 0 : 1];
+	unsigned i, j = 0, n = 0;
+
+	if (pparam->outtype == TREEOUT_JSON)
+		fprintf(pfile, "\t\t\"%s\": [", added ? "added" : "removed");
+	for (i = 0; i < pa->callno; i++) {
+		while (j < pb->callno && pb->calls[j] < pa->calls[i])
+			j++;
+		if (j == pb->callno || pb->calls[j] != pa->calls[i])
+			diffcall(pfile, pdiff, pa->calls[i], added, pparam,
+				 n++);
+	}
+	if (pparam->outtype == TREEOUT_JSON)
+		fprintf(pfile, "%s]", n ? "\n\t\t" : "");
+
+	return n;
+}
+
+// structural diff of the tree of the database given by --diff, the old
+// one, and ptree, the new one: functions matched by name and file, calls by
+// caller and callee name, joined on keys shared by the two trees; -x
+// functions are left out of both
+int outdiff(const ttree_t *ptree, treeparam_t *pparam)
+{
+	diff_t diff;
+	ttree_t *poldtree;
+	treeparam_t oldparam = *pparam;
+	char snoshortdb[] = "";
+	FILE *pfile;
+	unsigned s, nodemax, addno = 0, remno = 0, caddno = 0, cremno = 0;
+	int iErr = 0, iErrC;
+
+	memset(&diff, 0, sizeof(diff));
+
+	// the old database is read as -i is, without a shortened output
+	oldparam.infile = pparam->difffile;
+	oldparam.shortdbfile = snoshortdb;
+	poldtree = ttreeinit();
+	if (!poldtree)
+		return -1;
+	iErr = gettree(poldtree, &oldparam);
+	if (iErr == 0)
+		iErr = ttreefreeze(poldtree);
+
+	if (pparam->verbose)
+		printf("\nComparing call graphs... ");
+
+	diff.side[0].ptree = poldtree;
+	diff.side[1].ptree = ptree;
+	for (s = 0; iErr == 0 && s < 2; s++) {
+		diff.side[s].ptrav = ttreetravinit(diff.side[s].ptree);
+		if (!diff.side[s].ptrav)
+			iErr = -1;
+		else
+			iErr = outtreeresolve(diff.side[s].ptrav, pparam);
+		if (iErr == 0 && diffsort(&diff.side[s]) != 0) {
+			printf("\nMemory allocation error\n");
+			iErr = -1;
+		}
+	}
+
+	if (iErr == 0) {
+		nodemax = poldtree->nodeno + ptree->nodeno + 1;
+		diff.nodes = malloc(nodemax * sizeof(ttreenode_t *));
+		diff.nodein = malloc(nodemax);
+		diff.names = malloc((poldtree->nameno + ptree->nameno + 1) *
+				    sizeof(ttreenode_t *));
+		if (!diff.nodes || !diff.nodein || !diff.names) {
+			printf("\nMemory allocation error\n");
+			iErr = -1;
+		}
+	}
+	if (iErr == 0) {
+		diff.nodekeyno = diffjoin(&diff, 0, diffnodeorder);
+		diff.namekeyno = diffjoin(&diff, 1, diffnameorder);
+		for (s = 0; iErr == 0 && s < 2; s++)
+			if (diffcalls(&diff.side[s]) != 0) {
+				printf("\nMemory allocation error\n");
+				iErr = -1;
+			}
+	}
+
+	if (iErr == 0)
+		iErr = outopen(diff.side[1].ptrav, pparam);
+	if (iErr == 0) {
+		pfile = diff.side[1].ptrav->outfile;
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(pfile, "{\n\t\"functions\": {\n");
+		else if (pparam->outtype == TREEOUT_CSV)
+			fprintf(pfile, "change,kind,function,file,callee\n");
+
+		addno = difffunctions(pfile, &diff, 1, pparam);
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(pfile, ",\n");
+		remno = difffunctions(pfile, &diff, 0, pparam);
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(pfile, "\n\t},\n\t\"calls\": {\n");
+		caddno = diffchanges(pfile, &diff, 1, pparam);
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(pfile, ",\n");
+		cremno = diffchanges(pfile, &diff, 0, pparam);
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(pfile, "\n\t}\n}\n");
+
+		iErrC = outclose(diff.side[1].ptrav, pparam);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	if (iErr == 0 && pparam->verbose)
+		printf("done\nFunctions: %u added, %u removed; calls: %u "
+		       "added, %u removed\n",
+		       addno, remno, caddno, cremno);
+
+	for (s = 0; s < 2; s++)
+		diffsidefree(&diff.side[s]);
+	free(diff.nodes);
+	free(diff.nodein);
+	free(diff.names);
+	ttreedestroy(poldtree);
+
+	return iErr;
+}
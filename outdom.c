@@ -0,0 +1,225 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outdom.h"
+#include "outgraphviz.h"
+#include "outtree.h"
+#include "slib.h"
+#include "ttreedom.h"
+#include "ttreesel.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+// write a node as a JSON object
+static void domjsonnode(FILE *pfile, const ttreenode_t *pnode)
+{
+	fprintf(pfile, "{\"name\": ");
+	slibjsonstr(pfile, pnode->funname);
+	fprintf(pfile, ", \"file\": ");
+	if (pnode->filename)
+		slibjsonstr(pfile, pnode->filename);
+	else
+		fprintf(pfile, "null");
+	fprintf(pfile, "}");
+}
+
+// output the dominator tree edge to a node, in dot format; the nodes are
+// output once, so a chain stops at the first node already there
+static int domwritegra(ttreetrav_t *ptrav, const ttreedom_t *pdom,
+		       ttreenode_t *pnode, treeparam_t *pparam, int chain)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	unsigned i;
+	int iErr = 0;
+
+	do {
+		if (bitsettest(ptrav->nodeout, pnode->id))
+			break;
+		bitsetset(ptrav->nodeout, pnode->id);
+		iErr = outnode_gra(ptrav, pnode, pparam);
+		i = pdom->idom[pnode->id];
+		if (iErr == 0 && i != TTREEDOM_NONE)
+			fprintf(ptrav->outfile, "\t%s->%s;\n",
+				ptree->nodes[i]->funname, pnode->funname);
+		pnode = i != TTREEDOM_NONE ? ptree->nodes[i] : NULL;
+	} while (iErr == 0 && chain && pnode);
+
+	return iErr;
+}
+
+// output the immediate dominator chain of a node, the answerno-th answer
+static void domwritechain(ttreetrav_t *ptrav, const ttreedom_t *pdom,
+			  ttreenode_t *pnode, treeparam_t *pparam,
+			  unsigned answerno)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	FILE *pfile = ptrav->outfile;
+	int reached = bitsettest(pdom->reached, pnode->id);
+	unsigned i;
+
+	if (pparam->outtype == TREEOUT_JSON) {
+		fprintf(pfile, "%s\n\t\t{\"function\": ", answerno ? "," : "");
+		domjsonnode(pfile, pnode);
+		fprintf(pfile, ", \"chain\": ");
+		if (!reached)
+			fprintf(pfile, "null}");
+		else {
+			fprintf(pfile, "[");
+			for (i = pdom->idom[pnode->id]; i != TTREEDOM_NONE;
+			     i = pdom->idom[i]) {
+				domjsonnode(pfile, ptree->nodes[i]);
+				if (pdom->idom[i] != TTREEDOM_NONE)
+					fprintf(pfile, ", ");
+			}
+			fprintf(pfile, "]}");
+		}
+		return;
+	}
+
+	fprintf(pfile, "%s", pnode->funname);
+	if (!reached)
+		fprintf(pfile, " unreachable");
+	for (i = pdom->idom[pnode->id]; reached && i != TTREEDOM_NONE;
+	     i = pdom->idom[i])
+		fprintf(pfile, " <- %s", ptree->nodes[i]->funname);
+	fprintf(pfile, "\n");
+}
+
+// output the immediate dominator of a node, the answerno-th answer
+static void domwriteidom(ttreetrav_t *ptrav, const ttreedom_t *pdom,
+			 ttreenode_t *pnode, treeparam_t *pparam,
+			 unsigned answerno)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	FILE *pfile = ptrav->outfile;
+	unsigned i = pdom->idom[pnode->id];
+
+	if (pparam->outtype == TREEOUT_JSON) {
+		fprintf(pfile, "%s\n\t\t{\"function\": ", answerno ? "," : "");
+		domjsonnode(pfile, pnode);
+		fprintf(pfile, ", \"idom\": ");
+		if (i != TTREEDOM_NONE)
+			domjsonnode(pfile, ptree->nodes[i]);
+		else
+			fprintf(pfile, "null");
+		fprintf(pfile, "}");
+	} else
+		fprintf(pfile, "%s %s\n", pnode->funname,
+			i != TTREEDOM_NONE ? ptree->nodes[i]->funname : "-");
+}
+
+// dominator tree of the functions reached from the roots, without going
+// through the excluded functions: the whole tree, or the chains of immediate
+// dominators of the functions matching pparam->domsel
+int outdominators(const ttree_t *ptree, treeparam_t *pparam)
+{
+	ttreetrav_t *ptrav;
+	ttreedom_t *pdom = NULL;
+	ttreeset_t sel;
+	ttreenode_t *pnode;
+	unsigned i, answerno = 0;
+	int iErr = 0, iErrC;
+
+	if (pparam->verbose)
+		printf("\nMaking dominator tree... ");
+
+	ptrav = ttreetravinit(ptree);
+	if (!ptrav)
+		return -1;
+	if (ttreesetinit(&sel, ptree) != 0) {
+		ttreetravfree(ptrav);
+		return -1;
+	}
+
+	iErr = outtreeresolve(ptrav, pparam);
+	if (iErr == 0 && pparam->domsel) {
+		if (ttreeselect(ptree, pparam->domsel, &sel) < 0)
+			iErr = -1;
+		else if (sel.nodeno == 0 && pparam->verbose)
+			printf("\nNo function matches %s\n", pparam->domsel);
+		ttreesetsort(&sel);
+	}
+	if (iErr == 0) {
+		pdom = ttreedombuild(ptree, &ptrav->roots, &ptrav->excluded);
+		if (!pdom)
+			iErr = -1;
+	}
+
+	if (iErr == 0)
+		iErr = outopen(ptrav, pparam);
+	if (iErr == 0) {
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "{\n\t\"dominators\": [");
+
+		if (pparam->domsel) {
+			for (i = 0; iErr == 0 && i < sel.nodeno; i++) {
+				pnode = sel.nodes[i];
+				if (pparam->outtype == TREEOUT_GRAPHVIZ) {
+					if (bitsettest(pdom->reached,
+						       pnode->id))
+						iErr = domwritegra(
+						    ptrav, pdom, pnode, pparam,
+						    1);
+				} else
+					domwritechain(ptrav, pdom, pnode,
+						      pparam, answerno++);
+			}
+		} else {
+			// the whole tree, in depth first order from the roots
+			for (i = 0; iErr == 0 && i < pdom->reachedno; i++) {
+				pnode = ptree->nodes[pdom->order[i]];
+				if (pparam->outtype == TREEOUT_GRAPHVIZ)
+					iErr = domwritegra(ptrav, pdom, pnode,
+							   pparam, 0);
+				else
+					domwriteidom(ptrav, pdom, pnode,
+						     pparam, answerno++);
+			}
+		}
+
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "%s]\n}\n",
+				answerno ? "\n\t" : "");
+
+		iErrC = outclose(ptrav, pparam);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	if (iErr == 0 && pparam->verbose)
+		printf("done\n%u functions reached from the roots\n",
+		       pdom->reachedno);
+
+	ttreedomfree(pdom);
+	ttreesetfree(&sel);
+	ttreetravfree(ptrav);
+
+	return iErr;
+}
@@ -33,10 +33,9 @@
 #include "slib.h"
 #endif // _ALL_IN_ONE
 
-static FILE *grafile = NULL; // output file pointer
-
 #define HSTYLESNO TT_MAXSTYLES // maximum colors + styles
 #define HSTYLES1 3	     // number of colors
+#define SCCLABELMAX 8	     // functions listed in a condensed group label
 
 // user will specify just a number between 0 and (TT_MAXSTYLES - 1) to choose
 // among some colors OR styles
@@ -49,13 +48,75 @@ char *hlstyles[HSTYLESNO] = {
     "dotted"  // 5
 };
 
+// recursive group of a node if condensed (see --condense), else -1
+static long outscc_gra(const ttreetrav_t *ptrav, const ttreenode_t *pnode)
+{
+	unsigned scc;
+
+	if (ptrav->pscc == NULL)
+		return -1;
+
+	scc = ptrav->pscc->nodescc[pnode->id];
+
+	return ttreesccrecursive(ptrav->pscc, scc) ? (long)scc : -1;
+}
+
+// count samples of a profile, in percent of all of them
+static double outpercent_gra(const ttreeprof_t *pprof, unsigned long count)
+{
+	return pprof->total ? 100.0 * count / pprof->total : 0;
+}
+
+// heat of count samples of a profile: the pen width and the color, from blue
+// for no samples up to red for all of them
+static void outheat_gra(FILE *grafile, const ttreeprof_t *pprof,
+			unsigned long count, const char *sattr)
+{
+	double heat = outpercent_gra(pprof, count) / 100;
+
+	fprintf(grafile, "%spenwidth=%.1f,color=\"%.3f 0.800 0.900\"", sattr,
+		1 + 7 * heat, 0.667 * (1 - heat));
+}
+
+// print the name of a node, which is the one of its group if the group is
+// condensed into a node
+static void outname_gra(FILE *grafile, const ttreetrav_t *ptrav,
+			const ttreenode_t *pnode, treeparam_t *pparam)
+{
+	long scc = outscc_gra(ptrav, pnode);
+
+	if (scc >= 0 && pparam->condense == TREECONDENSE_NODE)
+		fprintf(grafile, "scc_%ld", scc);
+	else
+		fprintf(grafile, "%s", pnode->funname);
+}
+
+// print the label of a group condensed into a node: its first functions and
+// how many more there are
+static void outscclabel_gra(FILE *grafile, const ttreetrav_t *ptrav,
+			    unsigned scc)
+{
+	const ttreescc_t *pscc = ptrav->pscc;
+	unsigned i, n = ttreesccsize(pscc, scc);
+
+	fprintf(grafile, "label=\"");
+	for (i = 0; i < n && i < SCCLABELMAX; i++)
+		fprintf(grafile, "%s%s", i ? "\\n" : "",
+			ptrav->ptree->nodes[pscc->sccnodes[pscc->sccoff[scc] + i]]
+			    ->funname);
+	if (n > SCCLABELMAX)
+		fprintf(grafile, "\\n+%u more", n - SCCLABELMAX);
+	fprintf(grafile, "\",shape=box");
+}
+
 // start graph
-int outopen_gra(ttree_t *ptree __attribute__((unused)), treeparam_t *pparam)
+int outopen_gra(ttreetrav_t *ptrav, treeparam_t *pparam)
 {
 	int iErr = 0, iEbase;
 	char *sbasename = NULL;
+	FILE *grafile;
 
-	grafile = fopen(pparam->outfile, "w");
+	grafile = ptrav->outfile = fopen(pparam->outfile, "w");
 	if (grafile == NULL) {
 		printf("\nError while opening output file\n");
 		iErr = -1;
@@ -74,33 +135,46 @@ int outopen_gra(ttree_t *ptree __attribute__((unused)), treeparam_t *pparam)
 }
 
 // end graph
-int outclose_gra(ttree_t *ptree __attribute__((unused)),
+int outclose_gra(ttreetrav_t *ptrav,
 		 treeparam_t *pparam __attribute__((unused)))
 {
 	int iErr = 0;
 
-	fprintf(grafile, "}\n");
+	fprintf(ptrav->outfile, "}\n");
 
-	if (fclose(grafile) != 0) {
+	if (fclose(ptrav->outfile) != 0) {
 		printf("\nError while closing output file\n");
 		iErr = -1;
 	}
 
-	grafile = NULL;
+	ptrav->outfile = NULL;
 
 	return iErr;
 }
 
 // print one node
-int outnode_gra(ttreenode_t *pnode, treeparam_t *pparam)
+int outnode_gra(ttreetrav_t *ptrav, ttreenode_t *pnode, treeparam_t *pparam)
 {
+	FILE *grafile = ptrav->outfile;
 	int iErr = 0;
 	char *sclustername = NULL;
 	char *sclusterlabel = NULL;
 	int i, n;
+	int hlstyle; // highlight style, -1 = none
+	long scc;    // condensed recursive group, -1 = none
+	unsigned comm = TTREECOMM_NONE; // community cluster
+	const char *sattr = " ["; // before the next attribute
 
 	if (grafile != NULL && pnode != NULL && pnode->funname != NULL) {
+		hlstyle = ptrav->nodecolor[pnode->id] - 1;
+		scc = outscc_gra(ptrav, pnode);
 		fprintf(grafile, "\t");
+		if (scc >= 0 && pparam->condense == TREECONDENSE_CLUSTER)
+			// group the functions calling each other in a cluster
+			fprintf(grafile, "subgraph cluster_scc_%ld { "
+					 "label=\"recursion\"; "
+					 "labeljust=\"l\"; ",
+				scc);
 		if (pparam->doclusters) {
 			// group functions into a cluster for each file
 			// use the filename without path and with extension as
@@ -139,27 +213,90 @@ int outnode_gra(ttreenode_t *pnode, treeparam_t *pparam)
 			free(sclustername);
 			free(sclusterlabel);
 		}
+		if (ptrav->pcomm)
+			comm = ptrav->pcomm->nodecomm[pnode->id];
+		if (comm != TTREECOMM_NONE) {
+			// group functions into a cluster for each community,
+			// labelled after its most called or calling function
+			fprintf(grafile, "subgraph cluster_comm_%u { "
+					 "label=\"%s",
+				comm,
+				ptrav->ptree->nodes[ptrav->pcomm->hub[comm]]
+				    ->funname);
+			if (ptrav->pcomm->size[comm] > 1)
+				fprintf(grafile, " +%u",
+					ptrav->pcomm->size[comm] - 1);
+			fprintf(grafile, "\"; labeljust=\"l\"; ");
+		}
 
 		if (iErr == 0) {
 			// print node
-			fprintf(grafile, "%s", pnode->funname);
-			if (pnode->icolor > 0) {
+			outname_gra(grafile, ptrav, pnode, pparam);
+			if (scc >= 0 && pparam->condense == TREECONDENSE_NODE) {
+				// list the functions of the group
+				fprintf(grafile, "%s", sattr);
+				outscclabel_gra(grafile, ptrav, scc);
+				sattr = ",";
+			}
+			if (hlstyle >= 0) {
 				// add style or color attributes for path
 				// between root and specified
 				// function
-				if (pparam->hlstyle >= HSTYLES1)
-					fprintf(grafile, " [style=\"%s\"]",
-						hlstyles[pparam->hlstyle]);
+				if (hlstyle >= HSTYLES1)
+					fprintf(grafile, "%sstyle=\"%s\"",
+						sattr, hlstyles[hlstyle]);
 				else
-					fprintf(
-					    grafile,
-					    " [color=\"%s\",fontcolor=\"%s\"]",
-					    hlstyles[pparam->hlstyle],
-					    hlstyles[pparam->hlstyle]);
+					fprintf(grafile,
+						"%scolor=\"%s\",fontcolor=\"%s\"",
+						sattr, hlstyles[hlstyle],
+						hlstyles[hlstyle]);
+				sattr = ",";
+			}
+			if (ptrav->psize && ptrav->psize->bytes[pnode->id] &&
+			    !(scc >= 0 &&
+			      pparam->condense == TREECONDENSE_NODE)) {
+				// code size of the function, see --sizes
+				fprintf(grafile, "%slabel=\"%s\\n%lu B\"", sattr,
+					pnode->funname,
+					ptrav->psize->bytes[pnode->id]);
+				sattr = ",";
+			}
+			if (ptrav->pprof) {
+				// samples of the function, see --profile
+				fprintf(grafile,
+					"%slabel=\"%s\\n%.1f%% (%.1f%% self)\"",
+					sattr, pnode->funname,
+					outpercent_gra(ptrav->pprof,
+						       ptrav->pprof->incl[pnode->id]),
+					outpercent_gra(ptrav->pprof,
+						       ptrav->pprof->self[pnode->id]));
+				outheat_gra(grafile, ptrav->pprof,
+					    ptrav->pprof->incl[pnode->id], ",");
+				sattr = ",";
+			}
+			if (ptrav->pmetric) {
+				// metrics of the function, see --metrics
+				fprintf(grafile,
+					"%sfanin=%u,fanout=%u,calleefiles=%u",
+					sattr, ptrav->pmetric->fanin[pnode->id],
+					ptrav->pmetric->fanout[pnode->id],
+					ptrav->pmetric->files[pnode->id]);
+				if (ptrav->pmetric->depth[pnode->id] !=
+				    TTREEMETRIC_NODEPTH)
+					fprintf(grafile, ",depth=%u",
+						ptrav->pmetric->depth[pnode->id]);
+				fprintf(grafile, ",callees=%u,callers=%u",
+					ptrav->pmetric->callees[pnode->id],
+					ptrav->pmetric->callers[pnode->id]);
+				sattr = ",";
 			}
+			if (sattr[0] == ',')
+				fprintf(grafile, "]");
 			fprintf(grafile, ";");
 			// close cluster statement, if cluster enabled
-			if (pparam->doclusters)
+			if (pparam->doclusters || comm != TTREECOMM_NONE ||
+			    (scc >= 0 &&
+			     pparam->condense == TREECONDENSE_CLUSTER))
 				fprintf(grafile, " }");
 			fprintf(grafile, "\n");
 		}
@@ -169,52 +306,59 @@ int outnode_gra(ttreenode_t *pnode, treeparam_t *pparam)
 }
 
 // print one branch
-int outbranch_gra(ttreebranch_t *pbranch, treeparam_t *pparam)
+int outbranch_gra(ttreetrav_t *ptrav, ttreebranch_t *pbranch,
+		  treeparam_t *pparam)
 {
+	FILE *grafile = ptrav->outfile;
 	int iErr = 0;
 	char *sbasename = NULL;
+	int hlstyle; // highlight style, -1 = none
+	const char *sattr = " ["; // before the next attribute
+	int labelled = 0;
 
 	if (grafile && pbranch && pbranch->parent.node && pbranch->child.node &&
 	    pbranch->parent.node->funname && pbranch->child.node->funname) {
+		hlstyle = ptrav->branchcolor[pbranch->id] - 1;
 		// print the branch: caller -> callee;
-		fprintf(grafile, "\t%s->%s", pbranch->parent.node->funname,
-			pbranch->child.node->funname);
+		fprintf(grafile, "\t");
+		outname_gra(grafile, ptrav, pbranch->parent.node, pparam);
+		fprintf(grafile, "->");
+		outname_gra(grafile, ptrav, pbranch->child.node, pparam);
 		if (pparam->printfile && pbranch->parent.filename) {
 			// if enabled, print the filename where the call has
 			// been found
 			iErr = slibbasename(&sbasename, pbranch->parent.filename, 1);
 			if (iErr == 0) {
-				fprintf(grafile, " [label=\"%s\"", sbasename);
-				if (pbranch->icolor > 0) {
-					// if path is to be highlighted, add
-					// color or style attributes
-					if (pparam->hlstyle >= HSTYLES1)
-						fprintf(
-						    grafile, ",style=\"%s\"",
-						    hlstyles[pparam->hlstyle]);
-					else
-						fprintf(
-						    grafile, ",color=\"%s\","
-							     "fontcolor=\"%s\"",
-						    hlstyles[pparam->hlstyle],
-						    hlstyles[pparam->hlstyle]);
-				}
-				fprintf(grafile, "]");
+				fprintf(grafile, "%slabel=\"%s\"", sattr,
+					sbasename);
+				sattr = ",";
+				labelled = 1;
 				free(sbasename);
 			}
-		} else {
-			// filename is not printed near to the arrow
-			if (pbranch->icolor > 0) {
-				// if path is to be highlighted, add color or
-				// style attributes
-				if (pparam->hlstyle >= HSTYLES1)
-					fprintf(grafile, " [style=\"%s\"]",
-						hlstyles[pparam->hlstyle]);
-				else
-					fprintf(grafile, " [color=\"%s\"]",
-						hlstyles[pparam->hlstyle]);
-			}
 		}
+		if (iErr == 0 && hlstyle >= 0) {
+			// if path is to be highlighted, add color or style
+			// attributes, and the label color if there is one
+			if (hlstyle >= HSTYLES1)
+				fprintf(grafile, "%sstyle=\"%s\"", sattr,
+					hlstyles[hlstyle]);
+			else if (labelled)
+				fprintf(grafile, "%scolor=\"%s\",fontcolor=\"%s\"",
+					sattr, hlstyles[hlstyle],
+					hlstyles[hlstyle]);
+			else
+				fprintf(grafile, "%scolor=\"%s\"", sattr,
+					hlstyles[hlstyle]);
+			sattr = ",";
+		}
+		if (iErr == 0 && ptrav->pprof) {
+			// samples of the call, see --profile
+			outheat_gra(grafile, ptrav->pprof,
+				    ptrav->pprof->calls[pbranch->id], sattr);
+			sattr = ",";
+		}
+		if (sattr[0] == ',')
+			fprintf(grafile, "]");
 		fprintf(grafile, ";\n");
 	}
 
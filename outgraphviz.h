@@ -29,11 +29,13 @@
 #ifndef _ALL_IN_ONE
 #include "ttree.h"
 #include "ttreeparam.h"
+#include "ttreetrav.h"
 #endif // _ALL_IN_ONE
 
-int outopen_gra(ttree_t *ptree, treeparam_t *pparam);
-int outclose_gra(ttree_t *ptree, treeparam_t *pparam);
-int outnode_gra(ttreenode_t *pnode, treeparam_t *pparam);
-int outbranch_gra(ttreebranch_t *pbranch, treeparam_t *pparam);
+int outopen_gra(ttreetrav_t *ptrav, treeparam_t *pparam);
+int outclose_gra(ttreetrav_t *ptrav, treeparam_t *pparam);
+int outnode_gra(ttreetrav_t *ptrav, ttreenode_t *pnode, treeparam_t *pparam);
+int outbranch_gra(ttreetrav_t *ptrav, ttreebranch_t *pbranch,
+		  treeparam_t *pparam);
 
 #endif // #ifndef _OUTGRAPHVIZ_H
@@ -0,0 +1,439 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outimpact.h"
+#include "outtree.h"
+#include "slib.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+#define IMPACT_MAXLINE 4096 // longest line of the changes file
+#define IMPACT_NONE UINT_MAX // distance of a function not impacted
+
+typedef struct impact_st {
+	ttreetrav_t *ptrav;
+	unsigned *pfileoff;	 // functions of file f are pfilenodes[pfileoff[f]]
+	unsigned *pfilenodes;	 // ... up to pfilenodes[pfileoff[f + 1]]
+	unsigned char *pfilesel; // files matching the current path
+	char *spath;		 // current path, NULL if none
+	unsigned selno;		 // files matching it
+	unsigned changedno;	 // functions changed, first in ptrav->queue
+	unsigned rangeno;	 // line ranges read
+	unsigned outsideno;	 // line ranges out of any function
+} impact_t;
+
+// make spath the current path, NULL for none (a deleted file)
+static int impactselect(impact_t *pimpact, const char *spath)
+{
+	const ttree_t *ptree = pimpact->ptrav->ptree;
+	unsigned f;
+
+	if (spath && pimpact->spath && strcmp(spath, pimpact->spath) == 0)
+		return 0;
+
+	free(pimpact->spath);
+	pimpact->spath = NULL;
+	pimpact->selno = 0;
+	memset(pimpact->pfilesel, 0, ptree->fileno + 1);
+	if (!spath)
+		return 0;
+
+	pimpact->spath = strdup(spath);
+	if (!pimpact->spath) {
+		printf("\nMemory allocation error\n");
+		return -1;
+	}
+	for (f = 0; f < ptree->fileno; f++)
+		if (slibpathmatch(ptree->files[f], spath)) {
+			pimpact->pfilesel[f] = 1;
+			pimpact->selno++;
+		}
+
+	return 0;
+}
+
+// lines first to last of the current path changed: the functions defined
+// there are changed, unless excluded
+static void impactrange(impact_t *pimpact, unsigned first, unsigned last)
+{
+	ttreetrav_t *ptrav = pimpact->ptrav;
+	const ttree_t *ptree = ptrav->ptree;
+	ttreenode_t *pnode;
+	unsigned f, i, endline;
+	int inside = 0;
+
+	pimpact->rangeno++;
+	for (f = 0; pimpact->selno && f < ptree->fileno; f++) {
+		if (!pimpact->pfilesel[f])
+			continue;
+		for (i = pimpact->pfileoff[f]; i < pimpact->pfileoff[f + 1];
+		     i++) {
+			pnode = ptree->nodes[pimpact->pfilenodes[i]];
+			endline = pnode->endline ? pnode->endline : pnode->line;
+			if (pnode->line == 0 || pnode->line > last ||
+			    endline < first)
+				continue;
+			inside = 1;
+			if (bitsettest(ptrav->nodeseen, pnode->id) ||
+			    ttreesetisin(&ptrav->excluded, pnode->id))
+				continue;
+			bitsetset(ptrav->nodeseen, pnode->id);
+			ptrav->nodedist[pnode->id] = 0;
+			ptrav->queue[pimpact->changedno++] = pnode->id;
+		}
+	}
+	if (!inside)
+		pimpact->outsideno++;
+}
+
+// "<file>:<line>" or "<file>:<first>-<last>": 1 if sline is such a range,
+// cut at the colon
+static int impactparserange(char *sline, unsigned *pfirst, unsigned *plast)
+{
+	char *scolon = strrchr(sline, ':'), *send;
+
+	if (!scolon || scolon == sline || scolon[1] < '0' || scolon[1] > '9')
+		return 0;
+	*pfirst = *plast = strtoul(&scolon[1], &send, 10);
+	if (send[0] == '-' && send[1] >= '0' && send[1] <= '9')
+		*plast = strtoul(&send[1], &send, 10);
+	if (send[0] != '\0' || *plast < *pfirst)
+		return 0;
+
+	*scolon = '\0';
+
+	return 1;
+}
+
+// read the changed lines: a unified diff, whose hunks give the lines added
+// and the lines around those removed in the new files, or lines of
+// "<file>:<first>[-<last>]"; any other line, such as the headers of a diff,
+// is skipped
+static int impactread(impact_t *pimpact, FILE *pfile)
+{
+	char sline[IMPACT_MAXLINE], *spath, *s;
+	unsigned newline = 0, oldrem = 0, newrem = 0, first, last;
+	int iErr = 0;
+
+	while (iErr == 0 && fgets(sline, sizeof(sline), pfile)) {
+		sline[strcspn(sline, "\r\n")] = '\0';
+
+		if (oldrem || newrem) {
+			// inside a hunk, counting the lines of each side
+			switch (sline[0]) {
+			case '+':
+				impactrange(pimpact, newline, newline);
+				newline++;
+				if (newrem)
+					newrem--;
+				break;
+			case '-':
+				impactrange(pimpact,
+					    newline > 1 ? newline - 1 : 1,
+					    newline);
+				if (oldrem)
+					oldrem--;
+				break;
+			case '\\':
+				// no newline at end of file
+				break;
+			default:
+				newline++;
+				if (oldrem)
+					oldrem--;
+				if (newrem)
+					newrem--;
+				break;
+			}
+		} else if (strncmp(sline, "+++ ", 4) == 0) {
+			spath = &sline[4];
+			spath[strcspn(spath, "\t")] = '\0';
+			if (strcmp(spath, "/dev/null") == 0)
+				spath = NULL;
+			else if (strncmp(spath, "b/", 2) == 0)
+				spath += 2;
+			iErr = impactselect(pimpact, spath);
+		} else if (strncmp(sline, "@@ -", 4) == 0) {
+			// @@ -<old>[,<oldno>] +<new>[,<newno>] @@
+			s = &sline[4];
+			strtoul(s, &s, 10);
+			oldrem = *s == ',' ? strtoul(s + 1, &s, 10) : 1;
+			if (strncmp(s, " +", 2) == 0) {
+				newline = strtoul(s + 2, &s, 10);
+				newrem = *s == ',' ? strtoul(s + 1, &s, 10) : 1;
+			} else
+				oldrem = 0;
+		} else if (sline[0] != '#' &&
+			   impactparserange(sline, &first, &last)) {
+			iErr = impactselect(pimpact, sline);
+			if (iErr == 0)
+				impactrange(pimpact, first, last);
+		}
+	}
+
+	return iErr;
+}
+
+static int impactidorder(const void *pa, const void *pb)
+{
+	unsigned a = *(const unsigned *)pa, b = *(const unsigned *)pb;
+
+	return a < b ? -1 : a > b;
+}
+
+// breadth first scan of the callers of the changed functions, queued in
+// ptrav->queue after them; a call reaches any definition of its callee
+// name, which is bound to the first one. Returns the functions queued
+static unsigned impactscan(impact_t *pimpact)
+{
+	ttreetrav_t *ptrav = pimpact->ptrav;
+	const ttree_t *ptree = ptrav->ptree;
+	unsigned head = 0, tail = pimpact->changedno;
+	ttreenode_t *pnode, *pcaller;
+	ttreebranch_t *pbranch;
+	ttreeiter_t iter;
+
+	while (head < tail) {
+		pnode = ptree->nodes[ptrav->queue[head++]];
+		ttreecallers(ptree, ptree->namenode[pnode->nameid], &iter);
+		while ((pbranch = ttreeiternext(&iter)) != NULL) {
+			pcaller = pbranch->parent.node;
+			if (bitsettest(ptrav->nodeseen, pcaller->id) ||
+			    ttreesetisin(&ptrav->excluded, pcaller->id))
+				continue;
+			bitsetset(ptrav->nodeseen, pcaller->id);
+			ptrav->nodedist[pcaller->id] =
+			    ptrav->nodedist[pnode->id] + 1;
+			ptrav->queue[tail++] = pcaller->id;
+		}
+	}
+
+	return tail;
+}
+
+// output one impacted function, the answerno-th of its section
+static void impactwrite(ttreetrav_t *ptrav, treeparam_t *pparam,
+			const ttreenode_t *pnode, unsigned answerno)
+{
+	FILE *pfile = ptrav->outfile;
+	unsigned dist = ptrav->nodedist[pnode->id];
+
+	switch (pparam->outtype) {
+	case TREEOUT_TEXT:
+		if (dist)
+			fprintf(pfile, "\t%u", dist);
+		fprintf(pfile, "\t%s (%s", pnode->funname, pnode->filename);
+		if (pnode->line)
+			fprintf(pfile, ":%u-%u", pnode->line,
+				pnode->endline ? pnode->endline : pnode->line);
+		fprintf(pfile, ")\n");
+		break;
+
+	case TREEOUT_JSON:
+		fprintf(pfile, "%s\n\t\t{\"name\": ", answerno ? "," : "");
+		slibjsonstr(pfile, pnode->funname);
+		fprintf(pfile, ", \"file\": ");
+		slibjsonstr(pfile, pnode->filename);
+		fprintf(pfile, ", \"line\": %u, \"endline\": %u", pnode->line,
+			pnode->endline);
+		if (dist)
+			fprintf(pfile, ", \"distance\": %u", dist);
+		fprintf(pfile, "}");
+		break;
+
+	default:
+		slibcsvstr(pfile, pnode->funname);
+		fputc(',', pfile);
+		slibcsvstr(pfile, pnode->filename);
+		fprintf(pfile, ",%u,%u,%u,%d\n", pnode->line, pnode->endline,
+			dist, ttreesetisin(&ptrav->roots, pnode->id));
+		break;
+	}
+}
+
+// output the roots reached by the changes, with their distance
+static void impactroots(ttreetrav_t *ptrav, treeparam_t *pparam)
+{
+	FILE *pfile = ptrav->outfile;
+	ttreenode_t *pnode;
+	unsigned r, answerno = 0;
+
+	for (r = 0; r < ptrav->roots.nodeno; r++) {
+		pnode = ptrav->roots.nodes[r];
+		if (!bitsettest(ptrav->nodeseen, pnode->id))
+			continue;
+		if (pparam->outtype == TREEOUT_JSON) {
+			fprintf(pfile, "%s\n\t\t{\"name\": ",
+				answerno ? "," : "");
+			slibjsonstr(pfile, pnode->funname);
+			fprintf(pfile, ", \"file\": ");
+			slibjsonstr(pfile, pnode->filename);
+			fprintf(pfile, ", \"distance\": %u}",
+				ptrav->nodedist[pnode->id]);
+		} else
+			fprintf(pfile, "\t%u\t%s\n", ptrav->nodedist[pnode->id],
+				pnode->funname);
+		answerno++;
+	}
+	if (pparam->outtype == TREEOUT_JSON)
+		fprintf(pfile, "%s]\n}\n", answerno ? "\n\t" : "");
+}
+
+// functions whose definition overlaps the changed lines of a file, or of the
+// standard input for "-", and all their callers, directly or not, with the
+// roots they reach; excluded functions are neither changed nor scanned
+int outimpact(const ttree_t *ptree, treeparam_t *pparam)
+{
+	impact_t impact;
+	ttreetrav_t *ptrav;
+	ttreenode_t *pnode;
+	FILE *pchanges = NULL;
+	unsigned i, f, impactno = 0, rootno = 0;
+	int iErr = 0, iErrC;
+
+	if (pparam->verbose)
+		printf("\nFinding the impact of the changes... ");
+
+	memset(&impact, 0, sizeof(impact));
+	ptrav = ttreetravinit(ptree);
+	if (!ptrav)
+		return -1;
+	impact.ptrav = ptrav;
+
+	iErr = outtreeresolve(ptrav, pparam);
+	if (iErr == 0) {
+		impact.pfileoff = calloc(ptree->fileno + 2, sizeof(unsigned));
+		impact.pfilenodes = malloc((ptree->nodeno + 1) *
+					   sizeof(unsigned));
+		impact.pfilesel = malloc(ptree->fileno + 1);
+		if (!impact.pfileoff || !impact.pfilenodes ||
+		    !impact.pfilesel) {
+			printf("\nMemory allocation error\n");
+			iErr = -1;
+		}
+	}
+
+	if (iErr == 0) {
+		// functions by file, in definition order
+		for (i = 0; i < ptree->nodeno; i++)
+			if (ptree->nodes[i]->fileid != TTREE_NOFILE)
+				impact.pfileoff[ptree->nodes[i]->fileid + 2]++;
+		for (f = 0; f < ptree->fileno; f++)
+			impact.pfileoff[f + 2] += impact.pfileoff[f + 1];
+		for (i = 0; i < ptree->nodeno; i++) {
+			pnode = ptree->nodes[i];
+			if (pnode->fileid != TTREE_NOFILE)
+				impact.pfilenodes
+				    [impact.pfileoff[pnode->fileid + 1]++] = i;
+		}
+
+		bitsetzero(ptrav->nodeseen, ptree->nodeno);
+		for (i = 0; i < ptree->nodeno; i++)
+			ptrav->nodedist[i] = IMPACT_NONE;
+
+		pchanges = strcmp(pparam->impactfile, "-") == 0 ?
+			       stdin :
+			       fopen(pparam->impactfile, "r");
+		if (!pchanges) {
+			printf("\nCannot open file %s\n", pparam->impactfile);
+			iErr = -1;
+		}
+	}
+
+	if (iErr == 0)
+		iErr = impactread(&impact, pchanges);
+	if (iErr == 0) {
+		qsort(ptrav->queue, impact.changedno, sizeof(unsigned),
+		      impactidorder);
+		impactno = impactscan(&impact);
+		for (i = 0; i < ptrav->roots.nodeno; i++)
+			rootno += bitsettest(ptrav->nodeseen,
+					     ptrav->roots.nodes[i]->id);
+
+		iErr = outopen(ptrav, pparam);
+	}
+	if (iErr == 0) {
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "{\n\t\"changed\": [");
+		else if (pparam->outtype == TREEOUT_CSV)
+			fprintf(ptrav->outfile,
+				"function,file,line,endline,distance,root\n");
+		else
+			fprintf(ptrav->outfile, "changed:\n");
+
+		// the queue holds the changed functions, then their callers
+		// by distance
+		for (i = 0; i < impact.changedno; i++)
+			impactwrite(ptrav, pparam, ptree->nodes[ptrav->queue[i]],
+				    i);
+
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "%s],\n\t\"callers\": [",
+				impact.changedno ? "\n\t" : "");
+		else if (pparam->outtype == TREEOUT_TEXT)
+			fprintf(ptrav->outfile, "callers:\n");
+		for (i = impact.changedno; i < impactno; i++)
+			impactwrite(ptrav, pparam, ptree->nodes[ptrav->queue[i]],
+				    i - impact.changedno);
+
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "%s],\n\t\"roots\": [",
+				impactno > impact.changedno ? "\n\t" : "");
+		else if (pparam->outtype == TREEOUT_TEXT)
+			fprintf(ptrav->outfile, "roots:\n");
+		if (pparam->outtype != TREEOUT_CSV)
+			impactroots(ptrav, pparam);
+
+		iErrC = outclose(ptrav, pparam);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	if (pchanges && pchanges != stdin)
+		fclose(pchanges);
+
+	if (iErr == 0 && pparam->verbose)
+		printf("done\n%u line ranges, %u out of any function\n"
+		       "%u functions changed, %u callers, %u of %u roots "
+		       "reached\n",
+		       impact.rangeno, impact.outsideno, impact.changedno,
+		       impactno - impact.changedno, rootno,
+		       ptrav->roots.nodeno);
+
+	free(impact.pfileoff);
+	free(impact.pfilenodes);
+	free(impact.pfilesel);
+	free(impact.spath);
+	ttreetravfree(ptrav);
+
+	return iErr;
+}
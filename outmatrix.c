@@ -0,0 +1,318 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outmatrix.h"
+#include "outtree.h"
+#include "slib.h"
+#include "ttreescc.h"
+#include "ttreesel.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+#define MATRIX_MAGIC "TTRM" // first bytes of the binary output
+
+// monotonic clock in milliseconds, for the verbose statistics
+static double matrixclock(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// name of a function in the matrix, file:name when more than one function
+// has its name, so that no two roots or rows have the same one
+static char *matrixname(const ttree_t *ptree, const ttreenode_t *pnode)
+{
+	size_t len = strlen(pnode->funname) + 1;
+	char *sname;
+	int dup;
+
+	dup = pnode->filename && ptree->namenode[pnode->nameid]->nextdef;
+	if (dup)
+		len += strlen(pnode->filename) + 1;
+
+	sname = malloc(len);
+	if (!sname) {
+		printf("\nMemory allocation error\n");
+		return NULL;
+	}
+	if (dup)
+		sprintf(sname, "%s:%s", pnode->filename, pnode->funname);
+	else
+		strcpy(sname, pnode->funname);
+
+	return sname;
+}
+
+// little endian unsigned integer of the binary output
+static void matrixputint(FILE *pfile, uint64_t v, unsigned bytes)
+{
+	unsigned i;
+
+	for (i = 0; i < bytes; i++)
+		fputc((int)(v >> (8 * i)) & 0xff, pfile);
+}
+
+// output the header: the roots, which are the columns
+static void matrixhead(FILE *pfile, treeparam_t *pparam, char **pcols,
+		       unsigned colno, unsigned rowno)
+{
+	unsigned j;
+
+	switch (pparam->outtype) {
+	case TREEOUT_JSON:
+		fprintf(pfile, "{\n\t\"roots\": [");
+		for (j = 0; j < colno; j++) {
+			fprintf(pfile, "%s", j ? ", " : "");
+			slibjsonstr(pfile, pcols[j]);
+		}
+		fprintf(pfile, "],\n\t\"functions\": [");
+		break;
+
+	case TREEOUT_CSV:
+		fprintf(pfile, "function,file");
+		for (j = 0; j < colno; j++) {
+			fputc(',', pfile);
+			slibcsvstr(pfile, pcols[j]);
+		}
+		fputc('\n', pfile);
+		break;
+
+	case TREEOUT_BINARY:
+		fwrite(MATRIX_MAGIC, 1, 4, pfile);
+		matrixputint(pfile, rowno, 4);
+		matrixputint(pfile, colno, 4);
+		for (j = 0; j < colno; j++)
+			fwrite(pcols[j], 1, strlen(pcols[j]) + 1, pfile);
+		break;
+
+	default:
+		break;
+	}
+}
+
+// output the row of a function, the rowid-th, given the mask of its
+// component
+static int matrixrow(FILE *pfile, treeparam_t *pparam, const ttree_t *ptree,
+		     const ttreenode_t *pnode, char **pcols, unsigned colno,
+		     const uint64_t *pmask, unsigned rowid)
+{
+	char *sname;
+	unsigned j, n = 0;
+
+	switch (pparam->outtype) {
+	case TREEOUT_TEXT:
+		sname = matrixname(ptree, pnode);
+		if (!sname)
+			return -1;
+		fprintf(pfile, "%s:", sname);
+		for (j = 0; j < colno; j++)
+			if (pmask[j / 64] & (1ULL << (j % 64)))
+				fprintf(pfile, " %s", pcols[j]);
+		fputc('\n', pfile);
+		free(sname);
+		break;
+
+	case TREEOUT_JSON:
+		fprintf(pfile, "%s\n\t\t{\"function\": ", rowid ? "," : "");
+		slibjsonstr(pfile, pnode->funname);
+		fprintf(pfile, ", \"file\": ");
+		if (pnode->filename)
+			slibjsonstr(pfile, pnode->filename);
+		else
+			fprintf(pfile, "null");
+		fprintf(pfile, ", \"roots\": [");
+		for (j = 0; j < colno; j++) {
+			if (!(pmask[j / 64] & (1ULL << (j % 64))))
+				continue;
+			fprintf(pfile, "%s", n++ ? ", " : "");
+			slibjsonstr(pfile, pcols[j]);
+		}
+		fprintf(pfile, "]}");
+		break;
+
+	case TREEOUT_CSV:
+		slibcsvstr(pfile, pnode->funname);
+		fputc(',', pfile);
+		if (pnode->filename)
+			slibcsvstr(pfile, pnode->filename);
+		for (j = 0; j < colno; j++) {
+			fputc(',', pfile);
+			fputc(pmask[j / 64] & (1ULL << (j % 64)) ? '1' : '0',
+			      pfile);
+		}
+		fputc('\n', pfile);
+		break;
+
+	case TREEOUT_BINARY:
+		// the names first, see outmatrix()
+		if (pmask == NULL) {
+			sname = matrixname(ptree, pnode);
+			if (!sname)
+				return -1;
+			fwrite(sname, 1, strlen(sname) + 1, pfile);
+			free(sname);
+		} else {
+			for (j = 0; j < (colno + 63) / 64; j++)
+				matrixputint(pfile, pmask[j], 8);
+		}
+		break;
+
+	default:
+		return -1;
+	}
+
+	return 0;
+}
+
+// matrix of the roots (columns) reaching each function (rows): the -p
+// functions or else all the functions not excluded; the calls of excluded
+// functions are dropped, so an excluded root reaches nothing
+//
+// the binary output is MATRIX_MAGIC, the number of rows and of columns as
+// 32 bit integers, the names of the columns then of the rows terminated by
+// NUL, and each row as (columns + 63) / 64 64 bit words, bit j of word
+// j / 64 set if column j reaches the row; integers are little endian
+int outmatrix(const ttree_t *ptree, treeparam_t *pparam)
+{
+	ttreetrav_t *ptrav;
+	ttreescc_t *pscc = NULL;
+	uint64_t *pmasks = NULL;
+	const uint64_t *pmask;
+	char **pcols = NULL;
+	unsigned i, j, colno = 0, rowno = 0, wordno = 0, pass;
+	ttreenode_t *pnode;
+	int iErr = 0, iErrC;
+	double tstart, tsweep = 0;
+
+	if (pparam->verbose)
+		printf("\nComputing reachability matrix... ");
+
+	ptrav = ttreetravinit(ptree);
+	if (!ptrav)
+		return -1;
+
+	iErr = outtreeresolve(ptrav, pparam);
+	for (i = 0; iErr == 0 && i < (unsigned)pparam->callpno; i++)
+		if (ttreeselect(ptree, pparam->callp[i], &ptrav->targets) < 0)
+			iErr = -1;
+	ttreesetsort(&ptrav->targets);
+
+	if (iErr == 0) {
+		colno = ptrav->roots.nodeno;
+		wordno = (colno + 63) / 64;
+		pscc = ttreesccbuild(ptree, &ptrav->excluded);
+		pcols = calloc(colno + 1, sizeof(char *));
+		if (!pscc || !pcols) {
+			printf("\nMemory allocation error\n");
+			iErr = -1;
+		}
+	}
+	if (iErr == 0) {
+		pmasks = calloc((size_t)pscc->sccno * wordno + 1,
+				sizeof(uint64_t));
+		if (!pmasks) {
+			printf("\nMemory allocation error\n");
+			iErr = -1;
+		}
+	}
+	for (j = 0; iErr == 0 && j < colno; j++) {
+		pnode = ptrav->roots.nodes[j];
+		pcols[j] = matrixname(ptree, pnode);
+		if (!pcols[j])
+			iErr = -1;
+		else if (!ttreesetisin(&ptrav->excluded, pnode->id))
+			pmasks[(size_t)pscc->nodescc[pnode->id] * wordno +
+			       j / 64] |= 1ULL << (j % 64);
+	}
+
+	if (iErr == 0) {
+		tstart = matrixclock();
+		ttreesccsweep(pscc, pmasks, wordno);
+		tsweep = matrixclock() - tstart;
+
+		if (pparam->callpno > 0)
+			rowno = ptrav->targets.nodeno;
+		else
+			for (i = 0; i < ptree->nodeno; i++)
+				rowno += !ttreesetisin(&ptrav->excluded, i);
+
+		iErr = outopen(ptrav, pparam);
+	}
+	if (iErr == 0) {
+		matrixhead(ptrav->outfile, pparam, pcols, colno, rowno);
+
+		// the binary output has all the names before the words
+		for (pass = pparam->outtype == TREEOUT_BINARY ? 0 : 1;
+		     iErr == 0 && pass < 2; pass++) {
+			for (i = j = 0; iErr == 0 && j < rowno; i++) {
+				if (pparam->callpno > 0)
+					pnode = ptrav->targets.nodes[i];
+				else if (!ttreesetisin(&ptrav->excluded, i))
+					pnode = ptree->nodes[i];
+				else
+					continue;
+				pmask = &pmasks[(size_t)pscc->nodescc[pnode->id] *
+						wordno];
+				iErr = matrixrow(ptrav->outfile, pparam, ptree,
+						 pnode, pcols, colno,
+						 pass ? pmask : NULL, j++);
+			}
+		}
+
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "%s]\n}\n", rowno ? "\n\t" : "");
+
+		iErrC = outclose(ptrav, pparam);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	if (iErr == 0 && pparam->verbose) {
+		printf("done\n");
+		printf("Reachability matrix: %u functions x %u roots, %u "
+		       "components, %.3f ms\n",
+		       rowno, colno, pscc->sccno, tsweep);
+	}
+
+	for (j = 0; pcols && j < colno; j++)
+		free(pcols[j]);
+	free(pcols);
+	free(pmasks);
+	ttreesccfree(pscc);
+	ttreetravfree(ptrav);
+
+	return iErr;
+}
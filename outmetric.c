@@ -0,0 +1,224 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outmetric.h"
+#include "outtree.h"
+#include "slib.h"
+#include "ttreemetric.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+// the metrics, in table and column order
+typedef enum metric_e {
+	METRIC_FANIN,
+	METRIC_FANOUT,
+	METRIC_FILES,
+	METRIC_DEPTH,
+	METRIC_CALLEES,
+	METRIC_CALLERS,
+	METRIC_MAXNUM
+} metric_t;
+
+static const char *smetricnames[METRIC_MAXNUM] = {
+    "fanin", "fanout", "calleefiles", "depth", "callees", "callers"};
+
+static const char *smetrictitles[METRIC_MAXNUM] = {
+    "called by the most functions",
+    "calling the most functions",
+    "calling functions of the most files",
+    "deepest from the roots",
+    "calling the most functions directly or not (estimated)",
+    "called by the most functions directly or not (estimated)"};
+
+static unsigned *metricvalues(const ttreemetric_t *pmetric, metric_t metric)
+{
+	switch (metric) {
+	case METRIC_FANIN:
+		return pmetric->fanin;
+	case METRIC_FANOUT:
+		return pmetric->fanout;
+	case METRIC_FILES:
+		return pmetric->files;
+	case METRIC_CALLEES:
+		return pmetric->callees;
+	case METRIC_CALLERS:
+		return pmetric->callers;
+	default:
+		return pmetric->depth;
+	}
+}
+
+static int metricorder(const void *pa, const void *pb)
+{
+	uint64_t a = *(const uint64_t *)pa, b = *(const uint64_t *)pb;
+
+	return a > b ? -1 : a < b;
+}
+
+// table of the topno nodes with the highest value of a metric, ties in tree
+// order; the keys are sorted in decreasing order
+static void metrictop(ttreetrav_t *ptrav, const ttreemetric_t *pmetric,
+		      metric_t metric, unsigned topno, uint64_t *pkeys)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	const unsigned *pvalues = metricvalues(pmetric, metric);
+	FILE *pfile = ptrav->outfile;
+	ttreenode_t *pnode;
+	unsigned i, n = 0;
+
+	for (i = 0; i < ptree->nodeno; i++)
+		if (!ttreesetisin(&ptrav->excluded, i) &&
+		    pvalues[i] != TTREEMETRIC_NODEPTH && pvalues[i] != 0)
+			pkeys[n++] =
+			    (uint64_t)pvalues[i] << 32 | (UINT32_MAX - i);
+	qsort(pkeys, n, sizeof(*pkeys), metricorder);
+
+	fprintf(pfile, "%s%s: functions %s\n", metric ? "\n" : "",
+		smetricnames[metric], smetrictitles[metric]);
+	for (i = 0; i < n && i < topno; i++) {
+		pnode = ptree->nodes[UINT32_MAX - (uint32_t)pkeys[i]];
+		fprintf(pfile, "\t%u\t%s\t%s\n", (unsigned)(pkeys[i] >> 32),
+			pnode->funname,
+			pnode->filename ? pnode->filename : TT_LIBRARY);
+	}
+}
+
+// all the metrics of one node, the answerno-th
+static void metricrow(ttreetrav_t *ptrav, const ttreemetric_t *pmetric,
+		      ttreenode_t *pnode, treeparam_t *pparam,
+		      unsigned answerno)
+{
+	FILE *pfile = ptrav->outfile;
+	unsigned id = pnode->id;
+
+	if (pparam->outtype == TREEOUT_JSON) {
+		fprintf(pfile, "%s\n\t\t{\"name\": ", answerno ? "," : "");
+		slibjsonstr(pfile, pnode->funname);
+		fprintf(pfile, ", \"file\": ");
+		if (pnode->filename)
+			slibjsonstr(pfile, pnode->filename);
+		else
+			fprintf(pfile, "null");
+		fprintf(pfile,
+			", \"fanin\": %u, \"fanout\": %u, \"calleefiles\": %u, "
+			"\"depth\": ",
+			pmetric->fanin[id], pmetric->fanout[id],
+			pmetric->files[id]);
+		if (pmetric->depth[id] != TTREEMETRIC_NODEPTH)
+			fprintf(pfile, "%u", pmetric->depth[id]);
+		else
+			fprintf(pfile, "null");
+		fprintf(pfile, ", \"callees\": %u, \"callers\": %u}",
+			pmetric->callees[id], pmetric->callers[id]);
+		return;
+	}
+
+	// CSV: an empty depth for the nodes not reached
+	slibcsvstr(pfile, pnode->funname);
+	fputc(',', pfile);
+	if (pnode->filename)
+		slibcsvstr(pfile, pnode->filename);
+	fprintf(pfile, ",%u,%u,%u,", pmetric->fanin[id], pmetric->fanout[id],
+		pmetric->files[id]);
+	if (pmetric->depth[id] != TTREEMETRIC_NODEPTH)
+		fprintf(pfile, "%u", pmetric->depth[id]);
+	fprintf(pfile, ",%u,%u\n", pmetric->callees[id], pmetric->callers[id]);
+}
+
+// metrics of every function: top tables in text, all the functions in CSV
+// or JSON; the dot output is the tree, see outtree()
+int outmetrics(const ttree_t *ptree, treeparam_t *pparam)
+{
+	ttreetrav_t *ptrav;
+	ttreemetric_t *pmetric = NULL;
+	uint64_t *pkeys = NULL;
+	ttreenode_t *pnode;
+	unsigned i, answerno = 0;
+	int m, iErr = 0, iErrC;
+
+	if (pparam->verbose)
+		printf("\nComputing metrics... ");
+
+	ptrav = ttreetravinit(ptree);
+	if (!ptrav)
+		return -1;
+
+	iErr = outtreeresolve(ptrav, pparam);
+	if (iErr == 0) {
+		pmetric = ttreemetricbuild(ptree, &ptrav->roots,
+					   &ptrav->excluded);
+		pkeys = malloc((ptree->nodeno + 1) * sizeof(*pkeys));
+		if (!pkeys)
+			printf("\nMemory allocation error\n");
+		if (!pmetric || !pkeys)
+			iErr = -1;
+	}
+
+	if (iErr == 0)
+		iErr = outopen(ptrav, pparam);
+	if (iErr == 0) {
+		if (pparam->outtype == TREEOUT_TEXT) {
+			for (m = 0; m < METRIC_MAXNUM; m++)
+				metrictop(ptrav, pmetric, m, pparam->topno,
+					  pkeys);
+		} else {
+			if (pparam->outtype == TREEOUT_CSV)
+				fprintf(ptrav->outfile,
+					"function,file,fanin,fanout,"
+					"calleefiles,depth,callees,callers\n");
+			else
+				fprintf(ptrav->outfile,
+					"{\n\t\"metrics\": [");
+			for (i = 0; i < ptree->nodeno; i++) {
+				pnode = ptree->nodes[i];
+				if (!ttreesetisin(&ptrav->excluded, i))
+					metricrow(ptrav, pmetric, pnode,
+						  pparam, answerno++);
+			}
+			if (pparam->outtype == TREEOUT_JSON)
+				fprintf(ptrav->outfile, "%s]\n}\n",
+					answerno ? "\n\t" : "");
+		}
+
+		iErrC = outclose(ptrav, pparam);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	if (iErr == 0 && pparam->verbose)
+		printf("done\n");
+
+	free(pkeys);
+	ttreemetricfree(pmetric);
+	ttreetravfree(ptrav);
+
+	return iErr;
+}
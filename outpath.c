@@ -0,0 +1,668 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outgraphviz.h"
+#include "outpath.h"
+#include "outtree.h"
+#include "slib.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+#define PATH_START UINT_MAX // parent of the start nodes of a search
+
+// a call path: nodes[i] calls nodes[i + 1] through branches[i]
+typedef struct path_st {
+	unsigned *nodes;    // node ids, len + 1 of them
+	unsigned *branches; // branch ids, len of them
+	unsigned len;	    // number of calls
+} path_t;
+
+// entry of the bucket queue of pathsearch()
+typedef struct pathentry_st {
+	unsigned node; // node id
+	unsigned dist; // calls from the starts when queued
+	unsigned next; // next entry in the same bucket
+} pathentry_t;
+
+// state of a call path query; the roots are the starts and the highlighted
+// call path functions (-p) the ends of the paths
+typedef struct pathquery_st {
+	ttreetrav_t *ptrav;  // node sets and scan arrays
+	treeparam_t *pparam; // query parameters
+	unsigned *parent;    // branch reaching each node in the last search
+	unsigned *dist;	     // calls from the starts in the last search
+	bitset_t *closed;    // node expanded in the last search
+	bitset_t *blocked;   // nodes a search can't go through
+	bitset_t *blocknext; // nodes a search can't start with (see below)
+	pathentry_t *entries; // bucket queue entries
+	unsigned entryno;     // number of entries
+	unsigned entrysize;   // allocated entries
+	unsigned *bucket;     // first entry of each bucket or UINT_MAX
+	unsigned fmax;	      // last bucket used
+	unsigned pathno;     // number of paths output
+} pathquery_t;
+
+static void pathfree(path_t *ppath)
+{
+	free(ppath->nodes);
+	free(ppath->branches);
+	memset(ppath, 0, sizeof(*ppath));
+}
+
+static int pathalloc(path_t *ppath, unsigned len)
+{
+	ppath->len = len;
+	ppath->nodes = malloc((len + 1) * sizeof(unsigned));
+	ppath->branches = malloc((len + 1) * sizeof(unsigned));
+	if (!ppath->nodes || !ppath->branches) {
+		printf("\nMemory allocation error\n");
+		pathfree(ppath);
+		return -1;
+	}
+
+	return 0;
+}
+
+static int pathsame(const path_t *pa, const path_t *pb)
+{
+	return pa->len == pb->len &&
+	       memcmp(pa->nodes, pb->nodes,
+		      (pa->len + 1) * sizeof(unsigned)) == 0;
+}
+
+// start paths output
+static int pathopen(pathquery_t *pq)
+{
+	ttreetrav_t *ptrav = pq->ptrav;
+	treeparam_t *pparam = pq->pparam;
+
+	if (outopen(ptrav, pparam) != 0)
+		return -1;
+
+	if (pparam->outtype == TREEOUT_JSON)
+		fprintf(ptrav->outfile, "{\n\t\"paths\": [");
+
+	return 0;
+}
+
+// end paths output
+static int pathclose(pathquery_t *pq)
+{
+	ttreetrav_t *ptrav = pq->ptrav;
+	treeparam_t *pparam = pq->pparam;
+
+	if (pparam->outtype == TREEOUT_JSON)
+		fprintf(ptrav->outfile, "%s]\n}\n", pq->pathno ? "\n\t" : "");
+
+	return outclose(ptrav, pparam);
+}
+
+// output one path; in dot format, the output is the graph of all the calls of
+// the paths
+static int pathwrite(pathquery_t *pq, const path_t *ppath)
+{
+	ttreetrav_t *ptrav = pq->ptrav;
+	const ttree_t *ptree = ptrav->ptree;
+	FILE *pfile = ptrav->outfile;
+	ttreenode_t *pnode;
+	unsigned i;
+	int iErr = 0;
+
+	switch (pq->pparam->outtype) {
+	case TREEOUT_GRAPHVIZ:
+		for (i = 0; iErr == 0 && i <= ppath->len; i++) {
+			pnode = ptree->nodes[ppath->nodes[i]];
+			if (!bitsettest(ptrav->nodeout, pnode->id)) {
+				bitsetset(ptrav->nodeout, pnode->id);
+				iErr = outnode_gra(ptrav, pnode, pq->pparam);
+			}
+			if (iErr == 0 && i < ppath->len &&
+			    !bitsettest(ptrav->branchout, ppath->branches[i])) {
+				bitsetset(ptrav->branchout, ppath->branches[i]);
+				iErr = outbranch_gra(
+				    ptrav, ptree->branches[ppath->branches[i]],
+				    pq->pparam);
+			}
+		}
+		break;
+
+	case TREEOUT_TEXT:
+		for (i = 0; i <= ppath->len; i++)
+			fprintf(pfile, "%s%s", i ? " -> " : "",
+				ptree->nodes[ppath->nodes[i]]->funname);
+		fprintf(pfile, "\n");
+		break;
+
+	case TREEOUT_JSON:
+		fprintf(pfile, "%s\n\t\t{\"length\": %u, \"functions\": [",
+			pq->pathno ? "," : "", ppath->len);
+		for (i = 0; i <= ppath->len; i++) {
+			pnode = ptree->nodes[ppath->nodes[i]];
+			fprintf(pfile, "%s{\"name\": ", i ? ", " : "");
+			slibjsonstr(pfile, pnode->funname);
+			fprintf(pfile, ", \"file\": ");
+			if (pnode->filename)
+				slibjsonstr(pfile, pnode->filename);
+			else
+				fprintf(pfile, "null");
+			fprintf(pfile, "}");
+		}
+		fprintf(pfile, "]}");
+		break;
+
+	default:
+		iErr = -1;
+		break;
+	}
+
+	pq->pathno++;
+
+	return iErr;
+}
+
+// distance of every node from the nearest path end, scanning the callers
+// backward from the ends; only the nodes reaching an end (ptrav->totarget)
+// are searched afterwards
+static void pathdistance(pathquery_t *pq)
+{
+	ttreetrav_t *ptrav = pq->ptrav;
+	const ttree_t *ptree = ptrav->ptree;
+	unsigned head = 0, tail = 0;
+	unsigned i;
+	ttreenode_t *pnode, *pnext;
+	ttreebranch_t *pbranch;
+	ttreeiter_t iter;
+
+	bitsetzero(ptrav->totarget, ptree->nodeno);
+
+	for (i = 0; i < ptrav->targets.nodeno; i++) {
+		pnode = ptrav->targets.nodes[i];
+		if (ttreesetisin(&ptrav->excluded, pnode->id))
+			continue;
+
+		bitsetset(ptrav->totarget, pnode->id);
+		ptrav->nodedist[pnode->id] = 0;
+		ptrav->queue[tail++] = pnode->id;
+	}
+
+	while (head < tail) {
+		pnode = ptree->nodes[ptrav->queue[head++]];
+
+		ttreecallers(ptree, pnode, &iter);
+		while ((pbranch = ttreeiternext(&iter)) != NULL) {
+			pnext = pbranch->parent.node;
+			if (bitsettest(ptrav->totarget, pnext->id) ||
+			    ttreesetisin(&ptrav->excluded, pnext->id))
+				continue;
+
+			bitsetset(ptrav->totarget, pnext->id);
+			ptrav->nodedist[pnext->id] =
+			    ptrav->nodedist[pnode->id] + 1;
+			ptrav->queue[tail++] = pnext->id;
+		}
+	}
+}
+
+// push a node reached at dist calls from the starts in the bucket queue of
+// pathsearch(), ordered by dist + distance to the nearest end
+static int pathpush(pathquery_t *pq, unsigned node, unsigned dist)
+{
+	pathentry_t *pentry;
+	unsigned f = dist + pq->ptrav->nodedist[node];
+
+	if (pq->entryno == pq->entrysize) {
+		pentry = realloc(pq->entries,
+				 2 * pq->entrysize * sizeof(*pentry));
+		if (!pentry) {
+			printf("\nMemory allocation error\n");
+			return -1;
+		}
+		pq->entries = pentry;
+		pq->entrysize *= 2;
+	}
+
+	pentry = &pq->entries[pq->entryno];
+	pentry->node = node;
+	pentry->dist = dist;
+	pentry->next = pq->bucket[f];
+	pq->bucket[f] = pq->entryno++;
+	if (f > pq->fmax)
+		pq->fmax = f;
+
+	return 0;
+}
+
+// search the shortest path from the start nodes to an end, avoiding the
+// blocked nodes; the blocknext nodes are excluded from the starts if
+// startblock, else from the callees of the starts; returns 1 if a path is
+// found, 0 if not and -1 on error
+//
+// the search is A*: the distance from the nearest end, computed once by
+// pathdistance() without blocked nodes, never overestimates the calls left,
+// so the nodes are expanded by increasing length of the whole path and the
+// search stops at the first end, usually after a small part of the graph
+static int pathsearch(pathquery_t *pq, ttreenode_t *const *pstarts,
+		      unsigned startno, int startblock, path_t *ppath)
+{
+	ttreetrav_t *ptrav = pq->ptrav;
+	const ttree_t *ptree = ptrav->ptree;
+	unsigned i, len, f, e, fmin = UINT_MAX;
+	ttreenode_t *pnode, *pnext, *pend = NULL;
+	ttreebranch_t *pbranch;
+	ttreeiter_t iter;
+	pathentry_t entry;
+	int iErr = 0;
+
+	// nodeseen: dist[] is valid, pq->closed: node expanded
+	bitsetzero(ptrav->nodeseen, ptree->nodeno);
+	bitsetzero(pq->closed, ptree->nodeno);
+	pq->entryno = 0;
+	pq->fmax = 0;
+
+	for (i = 0; iErr == 0 && i < startno; i++) {
+		pnode = pstarts[i];
+		if (!bitsettest(ptrav->totarget, pnode->id) ||
+		    bitsettest(pq->blocked, pnode->id) ||
+		    bitsettest(ptrav->nodeseen, pnode->id) ||
+		    (startblock && bitsettest(pq->blocknext, pnode->id)))
+			continue;
+
+		bitsetset(ptrav->nodeseen, pnode->id);
+		pq->dist[pnode->id] = 0;
+		pq->parent[pnode->id] = PATH_START;
+		if (ptrav->nodedist[pnode->id] < fmin)
+			fmin = ptrav->nodedist[pnode->id];
+		iErr = pathpush(pq, pnode->id, 0);
+	}
+
+	for (f = fmin; iErr == 0 && pend == NULL && f <= pq->fmax; f++) {
+		while (pend == NULL && pq->bucket[f] != UINT_MAX) {
+			e = pq->bucket[f];
+			entry = pq->entries[e];
+			pq->bucket[f] = entry.next;
+
+			// skip stale entries of nodes reached again by a
+			// shorter path
+			if (bitsettest(pq->closed, entry.node) ||
+			    entry.dist != pq->dist[entry.node])
+				continue;
+			bitsetset(pq->closed, entry.node);
+
+			pnode = ptree->nodes[entry.node];
+			if (ttreesetisin(&ptrav->targets, pnode->id)) {
+				pend = pnode;
+				break;
+			}
+
+			ttreecallees(ptree, pnode, &iter);
+			while (iErr == 0 &&
+			       (pbranch = ttreeiternext(&iter)) != NULL) {
+				pnext = pbranch->child.node;
+				if (!bitsettest(ptrav->totarget, pnext->id) ||
+				    bitsettest(pq->blocked, pnext->id) ||
+				    bitsettest(pq->closed, pnext->id))
+					continue;
+				if (bitsettest(ptrav->nodeseen, pnext->id) &&
+				    pq->dist[pnext->id] <= entry.dist + 1)
+					continue;
+				if (!startblock &&
+				    pq->parent[pnode->id] == PATH_START &&
+				    bitsettest(pq->blocknext, pnext->id))
+					continue;
+
+				bitsetset(ptrav->nodeseen, pnext->id);
+				pq->dist[pnext->id] = entry.dist + 1;
+				pq->parent[pnext->id] = pbranch->id;
+				iErr = pathpush(pq, pnext->id, entry.dist + 1);
+			}
+		}
+	}
+
+	// leave the bucket queue empty for the next search
+	for (f = fmin; fmin != UINT_MAX && f <= pq->fmax; f++)
+		pq->bucket[f] = UINT_MAX;
+
+	if (iErr != 0)
+		return iErr;
+	if (pend == NULL)
+		return 0;
+
+	// walk back from the end to the start
+	for (len = 0, i = pend->id; pq->parent[i] != PATH_START; len++)
+		i = ptree->branches[pq->parent[i]]->parent.node->id;
+
+	if (pathalloc(ppath, len) != 0)
+		return -1;
+
+	for (i = pend->id; len > 0; len--) {
+		ppath->nodes[len] = i;
+		ppath->branches[len - 1] = pq->parent[i];
+		i = ptree->branches[pq->parent[i]]->parent.node->id;
+	}
+	ppath->nodes[0] = i;
+
+	return 1;
+}
+
+// the pathno shortest simple paths, with Yen's algorithm: each new path
+// deviates from the previous one at some node (the spur), after the same
+// first calls (the root), and then goes on along the shortest path that
+// avoids the root nodes and the calls already taken after that root
+static int pathkshortest(pathquery_t *pq, unsigned pathno)
+{
+	ttreetrav_t *ptrav = pq->ptrav;
+	const ttree_t *ptree = ptrav->ptree;
+	path_t *paths, *cands = NULL, spur, *pprev;
+	unsigned candno = 0, candsize = 0;
+	unsigned n, j, best;
+	int i, found, iErr = 0;
+	ttreenode_t *pspur;
+
+	paths = calloc(pathno, sizeof(*paths));
+	if (!paths) {
+		printf("\nMemory allocation error\n");
+		return -1;
+	}
+
+	found = pathsearch(pq, ptrav->roots.nodes, ptrav->roots.nodeno, 1,
+			   &paths[0]);
+	if (found <= 0) {
+		free(paths);
+		return found;
+	}
+	iErr = pathwrite(pq, &paths[0]);
+
+	for (n = 1; iErr == 0 && n < pathno; n++) {
+		pprev = &paths[n - 1];
+
+		// spur at each node of the previous path but the end; -1 is
+		// before the start, where paths deviate by their start node
+		for (i = -1; iErr == 0 && i < (int)pprev->len; i++) {
+			for (j = 0; j < n; j++) {
+				if (i < 0)
+					bitsetset(pq->blocknext,
+						  paths[j].nodes[0]);
+				else if (paths[j].len > (unsigned)i &&
+					 memcmp(paths[j].nodes, pprev->nodes,
+						(i + 1) * sizeof(unsigned)) ==
+					     0)
+					bitsetset(pq->blocknext,
+						  paths[j].nodes[i + 1]);
+			}
+			for (j = 0; i > 0 && j < (unsigned)i; j++)
+				bitsetset(pq->blocked, pprev->nodes[j]);
+
+			if (i < 0)
+				found = pathsearch(pq, ptrav->roots.nodes,
+						   ptrav->roots.nodeno, 1,
+						   &spur);
+			else {
+				pspur = ptree->nodes[pprev->nodes[i]];
+				found = pathsearch(pq, &pspur, 1, 0, &spur);
+			}
+
+			bitsetzero(pq->blocknext, ptree->nodeno);
+			bitsetzero(pq->blocked, ptree->nodeno);
+
+			if (found < 0) {
+				iErr = -1;
+				break;
+			}
+			if (found == 0)
+				continue;
+
+			// root + spur is a candidate, if new
+			if (i > 0) {
+				path_t cand;
+
+				if (pathalloc(&cand, i + spur.len) != 0) {
+					pathfree(&spur);
+					iErr = -1;
+					break;
+				}
+				memcpy(cand.nodes, pprev->nodes,
+				       i * sizeof(unsigned));
+				memcpy(cand.branches, pprev->branches,
+				       i * sizeof(unsigned));
+				memcpy(cand.nodes + i, spur.nodes,
+				       (spur.len + 1) * sizeof(unsigned));
+				memcpy(cand.branches + i, spur.branches,
+				       spur.len * sizeof(unsigned));
+				pathfree(&spur);
+				spur = cand;
+			}
+
+			for (j = 0; j < candno; j++)
+				if (pathsame(&cands[j], &spur))
+					break;
+			if (j < candno) {
+				pathfree(&spur);
+				continue;
+			}
+
+			if (candno == candsize) {
+				path_t *pnew;
+
+				candsize = candsize ? 2 * candsize : 16;
+				pnew = realloc(cands,
+					       candsize * sizeof(*cands));
+				if (!pnew) {
+					printf("\nMemory allocation error\n");
+					pathfree(&spur);
+					iErr = -1;
+					break;
+				}
+				cands = pnew;
+			}
+			cands[candno++] = spur;
+		}
+
+		if (iErr != 0 || candno == 0)
+			break;
+
+		// the shortest candidate, the first one found among equals
+		for (best = 0, j = 1; j < candno; j++)
+			if (cands[j].len < cands[best].len)
+				best = j;
+		paths[n] = cands[best];
+		memmove(&cands[best], &cands[best + 1],
+			(candno - best - 1) * sizeof(*cands));
+		candno--;
+
+		iErr = pathwrite(pq, &paths[n]);
+	}
+
+	for (j = 0; j < pathno; j++)
+		pathfree(&paths[j]);
+	for (j = 0; j < candno; j++)
+		pathfree(&cands[j]);
+	free(paths);
+	free(cands);
+
+	return iErr;
+}
+
+// all the simple paths of at most pathlen calls, depth first from each root;
+// a branch is only taken if an end can still be reached within pathlen calls
+// from its callee
+static int pathall(pathquery_t *pq, unsigned pathlen)
+{
+	ttreetrav_t *ptrav = pq->ptrav;
+	const ttree_t *ptree = ptrav->ptree;
+	ttreeiter_t *iters;
+	ttreenode_t *pnode, *pnext;
+	ttreebranch_t *pbranch;
+	path_t path;
+	unsigned r, depth;
+	int iErr = 0;
+
+	// the stack is at most pathlen + 1 deep
+	iters = malloc((pathlen + 1) * sizeof(*iters));
+	if (!iters || pathalloc(&path, pathlen) != 0) {
+		printf("\nMemory allocation error\n");
+		free(iters);
+		return -1;
+	}
+
+	for (r = 0; iErr == 0 && r < ptrav->roots.nodeno; r++) {
+		pnode = ptrav->roots.nodes[r];
+		if (!bitsettest(ptrav->totarget, pnode->id) ||
+		    ptrav->nodedist[pnode->id] > pathlen)
+			continue;
+
+		path.nodes[0] = pnode->id;
+		if (ttreesetisin(&ptrav->targets, pnode->id)) {
+			path.len = 0;
+			iErr = pathwrite(pq, &path);
+			continue;
+		}
+
+		// pq->blocked holds the nodes on the current path
+		bitsetset(pq->blocked, pnode->id);
+		ttreecallees(ptree, pnode, &iters[0]);
+		depth = 1;
+
+		while (iErr == 0 && depth > 0) {
+			pbranch = ttreeiternext(&iters[depth - 1]);
+			if (pbranch == NULL) {
+				bitsetclear(pq->blocked,
+					    path.nodes[depth - 1]);
+				depth--;
+				continue;
+			}
+
+			pnext = pbranch->child.node;
+			if (!bitsettest(ptrav->totarget, pnext->id) ||
+			    bitsettest(pq->blocked, pnext->id) ||
+			    depth + ptrav->nodedist[pnext->id] > pathlen)
+				continue;
+
+			path.nodes[depth] = pnext->id;
+			path.branches[depth - 1] = pbranch->id;
+			if (ttreesetisin(&ptrav->targets, pnext->id)) {
+				path.len = depth;
+				iErr = pathwrite(pq, &path);
+				continue;
+			}
+
+			bitsetset(pq->blocked, pnext->id);
+			ttreecallees(ptree, pnext, &iters[depth]);
+			depth++;
+		}
+	}
+
+	pathfree(&path);
+	free(iters);
+
+	return iErr;
+}
+
+// list the call paths from the roots to the highlighted call path functions
+// (-p), according to pparam->paths
+int outpaths(const ttree_t *ptree, treeparam_t *pparam)
+{
+	pathquery_t pq;
+	int i, iErr = 0, iErrC;
+
+	if (pparam->verbose)
+		printf("\nListing call paths... ");
+
+	memset(&pq, 0, sizeof(pq));
+	pq.pparam = pparam;
+	pq.ptrav = ttreetravinit(ptree);
+	if (!pq.ptrav)
+		return -1;
+
+	pq.parent = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	pq.dist = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	pq.closed = bitsetalloc(ptree->nodeno);
+	pq.blocked = bitsetalloc(ptree->nodeno);
+	pq.blocknext = bitsetalloc(ptree->nodeno);
+	pq.entrysize = 64;
+	pq.entries = malloc(pq.entrysize * sizeof(*pq.entries));
+	// a path end is at most nodeno calls from a node, so it is the same
+	// for the whole path length
+	pq.bucket = malloc((2 * ptree->nodeno + 2) * sizeof(unsigned));
+	if (pq.bucket)
+		memset(pq.bucket, 0xff, (2 * ptree->nodeno + 2) * sizeof(unsigned));
+	if (!pq.parent || !pq.dist || !pq.closed || !pq.blocked ||
+	    !pq.blocknext || !pq.entries || !pq.bucket) {
+		printf("\nMemory allocation error\n");
+		iErr = -1;
+	}
+
+	if (iErr == 0)
+		iErr = outtreeresolve(pq.ptrav, pparam);
+	for (i = 0; iErr == 0 && i < pparam->callpno; i++)
+		if (ttreeselect(ptree, pparam->callp[i], &pq.ptrav->targets) <
+		    0)
+			iErr = -1;
+
+	if (iErr == 0) {
+		ttreesetsort(&pq.ptrav->targets);
+		pathdistance(&pq);
+		iErr = pathopen(&pq);
+	}
+	if (iErr == 0) {
+		switch (pparam->paths) {
+		case TREEPATHS_SHORTEST:
+			iErr = pathkshortest(&pq, 1);
+			break;
+
+		case TREEPATHS_KSHORTEST:
+			iErr = pathkshortest(&pq, pparam->pathno);
+			break;
+
+		case TREEPATHS_ALL:
+			iErr = pathall(&pq, pparam->pathlen);
+			break;
+		}
+
+		iErrC = pathclose(&pq);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	if (pparam->verbose)
+		printf("done\n%u call paths\n", pq.pathno);
+
+	free(pq.parent);
+	free(pq.dist);
+	free(pq.closed);
+	free(pq.entries);
+	free(pq.bucket);
+	free(pq.blocked);
+	free(pq.blocknext);
+	ttreetravfree(pq.ptrav);
+
+	return iErr;
+}
@@ -0,0 +1,236 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outgraphviz.h"
+#include "outprofile.h"
+#include "outtree.h"
+#include "ttreeprof.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+#define PROF_MAXLINE 65536 // longest stack of a folded stacks file
+
+// the function of a sampled frame, by the name of its first definition: the
+// frame may be annotated as stackcollapse-perf.pl does (foo_[k]), prefixed
+// by its module (libc.so.6`foo) or suffixed by an offset (foo+0x1a), by the
+// arguments of a C++ function or by the name of a part split by the
+// compiler (foo.cold); NULL if none
+static ttreenode_t *proframe(const ttree_t *ptree, char *sframe)
+{
+	char *s;
+	size_t len;
+	int nameid;
+
+	s = strrchr(sframe, '`');
+	if (s)
+		sframe = s + 1;
+	len = strlen(sframe);
+	if (len > 4 && sframe[len - 4] == '_' && sframe[len - 3] == '[' &&
+	    sframe[len - 1] == ']')
+		sframe[len - 4] = '\0';
+	sframe[strcspn(sframe, "+(.")] = '\0';
+	for (s = sframe + strlen(sframe);
+	     s > sframe && (isalnum((unsigned char)s[-1]) || s[-1] == '_'); s--)
+		;
+
+	nameid = ttreefindname(ptree, s);
+
+	return nameid < 0 ? NULL : ptree->namenode[nameid];
+}
+
+// read the sampled stacks of a file, or of the standard input for "-", in
+// the folded format of stackcollapse: one stack per line, its frames from
+// the outermost one separated by ;, then a space and the samples; empty
+// lines and lines starting with # are skipped
+static int profread(ttreeprof_t *pprof, const ttree_t *ptree,
+		    const char *sname, unsigned *pframeno, unsigned *pmatchno)
+{
+	FILE *pfile;
+	char *sline, *scount, *send, *sframe, *ssave;
+	ttreenode_t **pframes;
+	unsigned frameno, maxframeno = PROF_MAXLINE / 2 + 1;
+	unsigned long count;
+	int iErr = 0;
+
+	sline = malloc(PROF_MAXLINE);
+	pframes = malloc(maxframeno * sizeof(ttreenode_t *));
+	if (!sline || !pframes) {
+		printf("\nMemory allocation error\n");
+		free(sline);
+		free(pframes);
+		return -1;
+	}
+
+	pfile = strcmp(sname, "-") == 0 ? stdin : fopen(sname, "r");
+	if (!pfile) {
+		printf("\nCannot open file %s\n", sname);
+		iErr = -1;
+	}
+
+	while (iErr == 0 && fgets(sline, PROF_MAXLINE, pfile)) {
+		sline[strcspn(sline, "\r\n")] = '\0';
+		if (sline[0] == '\0' || sline[0] == '#')
+			continue;
+		scount = strrchr(sline, ' ');
+		if (scount)
+			count = strtoul(scount + 1, &send, 10);
+		if (!scount || send == scount + 1 || *send != '\0') {
+			printf("\nFolded stack with no samples: %s\n", sline);
+			iErr = -1;
+			break;
+		}
+		*scount = '\0';
+
+		frameno = 0;
+		for (sframe = strtok_r(sline, ";", &ssave); sframe;
+		     sframe = strtok_r(NULL, ";", &ssave)) {
+			pframes[frameno] = proframe(ptree, sframe);
+			*pmatchno += pframes[frameno] != NULL;
+			frameno++;
+		}
+		*pframeno += frameno;
+		ttreeprofstack(pprof, ptree, pframes, frameno, count);
+	}
+
+	if (pfile && pfile != stdin)
+		fclose(pfile);
+	free(sline);
+	free(pframes);
+
+	return iErr;
+}
+
+// 1 if count samples are hot, at least the threshold percent of all of them
+static int profhot(const ttreeprof_t *pprof, unsigned long count,
+		   double threshold)
+{
+	return count > 0 && 100.0 * count >= threshold * pprof->total;
+}
+
+// 1 if the branch is a hot call between functions not excluded
+static int profhotcall(const ttreetrav_t *ptrav, const ttreeprof_t *pprof,
+		       unsigned id, double threshold)
+{
+	const ttreebranch_t *pbranch = ptrav->ptree->branches[id];
+
+	return profhot(pprof, pprof->calls[id], threshold) &&
+	       !ttreesetisin(&ptrav->excluded, pbranch->parent.node->id) &&
+	       !ttreesetisin(&ptrav->excluded, pbranch->child.node->id);
+}
+
+// the hot call graph of a runtime profile: the calls on at least the
+// threshold percent of the sampled stacks, with their functions, and the hot
+// functions, colored and sized by their samples.
+// Excluded functions and their calls are left out
+int outprofile(const ttree_t *ptree, treeparam_t *pparam)
+{
+	ttreetrav_t *ptrav;
+	ttreeprof_t *pprof = NULL;
+	ttreebranch_t *pbranch;
+	unsigned i, id, frameno = 0, matchno = 0, nodeno = 0, branchno = 0;
+	int iErr = 0, iErrC;
+
+	if (pparam->verbose)
+		printf("\nMaking the hot call graph... ");
+
+	ptrav = ttreetravinit(ptree);
+	if (!ptrav)
+		return -1;
+
+	iErr = outtreeresolve(ptrav, pparam);
+	if (iErr == 0) {
+		pprof = ttreeprofinit(ptree);
+		if (!pprof)
+			iErr = -1;
+	}
+	if (iErr == 0)
+		iErr = profread(pprof, ptree, pparam->proffile, &frameno,
+				&matchno);
+	ptrav->pprof = pprof;
+
+	if (iErr == 0) {
+		// the hot functions and the functions of the hot calls, even
+		// if colder, then the hot calls
+		bitsetzero(ptrav->nodeseen, ptree->nodeno);
+		for (i = 0; i < ptree->nodeno; i++)
+			if (profhot(pprof, pprof->incl[i], pparam->profpct) &&
+			    !ttreesetisin(&ptrav->excluded, i))
+				bitsetset(ptrav->nodeseen, i);
+		for (i = 0; i < ptree->branchno; i++)
+			if (profhotcall(ptrav, pprof, i, pparam->profpct)) {
+				pbranch = ptree->branches[i];
+				bitsetset(ptrav->nodeseen,
+					  pbranch->parent.node->id);
+				bitsetset(ptrav->nodeseen,
+					  pbranch->child.node->id);
+			}
+		for (i = 0; i < ptree->nodeno; i++)
+			if (bitsettest(ptrav->nodeseen, i))
+				ptrav->outlist[ptrav->outno++] = i << 1;
+		nodeno = ptrav->outno;
+		for (i = 0; i < ptree->branchno; i++)
+			if (profhotcall(ptrav, pprof, i, pparam->profpct))
+				ptrav->outlist[ptrav->outno++] =
+				    i << 1 | TTREETRAV_BRANCH;
+		branchno = ptrav->outno - nodeno;
+
+		iErr = outopen(ptrav, pparam);
+	}
+	if (iErr == 0) {
+		for (i = 0; iErr == 0 && i < ptrav->outno; i++) {
+			id = ptrav->outlist[i] >> 1;
+			if (ptrav->outlist[i] & TTREETRAV_BRANCH)
+				iErr = outbranch_gra(ptrav, ptree->branches[id],
+						     pparam);
+			else
+				iErr = outnode_gra(ptrav, ptree->nodes[id],
+						   pparam);
+		}
+
+		iErrC = outclose(ptrav, pparam);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	if (iErr == 0 && pparam->verbose)
+		printf("done\n%lu samples in %u stacks, %u of %u frames "
+		       "matched\n%lu samples with calls not in the database\n"
+		       "%u functions and %u calls of at least %g%% of the "
+		       "samples\n",
+		       pprof->total, pprof->stackno, matchno, frameno,
+		       pprof->missed, nodeno, branchno, pparam->profpct);
+
+	ttreeproffree(pprof);
+	ttreetravfree(ptrav);
+
+	return iErr;
+}
@@ -0,0 +1,206 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outreach.h"
+#include "outtree.h"
+#include "slib.h"
+#include "ttreereach.h"
+#include "ttreescc.h"
+#include "ttreesel.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+#define REACH_MAXLINE 4096 // longest query line
+
+// answer to a query: 1 if a function of pfrom reaches a function of pto,
+// 0 if not, -1 if one of them is empty
+static int reachsets(ttreereach_t *preach, const ttreeset_t *pfrom,
+		     const ttreeset_t *pto)
+{
+	unsigned i, j;
+
+	if (pfrom->nodeno == 0 || pto->nodeno == 0)
+		return -1;
+
+	for (i = 0; i < pfrom->nodeno; i++)
+		for (j = 0; j < pto->nodeno; j++)
+			if (ttreereach(preach, pfrom->nodes[i]->id,
+				       pto->nodes[j]->id))
+				return 1;
+
+	return 0;
+}
+
+// output one answer, the answerno-th
+static void reachwrite(FILE *pfile, treeparam_t *pparam, const char *sfrom,
+		       const char *sto, int reach, unsigned answerno)
+{
+	static const char *stext[] = {"unknown", "no", "yes"};
+	static const char *sjson[] = {"null", "false", "true"};
+
+	if (pparam->outtype == TREEOUT_JSON) {
+		fprintf(pfile, "%s\n\t\t{\"from\": ", answerno ? "," : "");
+		slibjsonstr(pfile, sfrom);
+		fprintf(pfile, ", \"to\": ");
+		slibjsonstr(pfile, sto);
+		fprintf(pfile, ", \"reachable\": %s}", sjson[reach + 1]);
+	} else
+		fprintf(pfile, "%s %s %s\n", sfrom, sto, stext[reach + 1]);
+}
+
+// monotonic clock in milliseconds, for the verbose statistics
+static double reachclock(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// answer the reachability queries of a file, or of the standard input for
+// "-": one query per line, "<from> <to>" with two selectors, asking whether
+// any function of from calls any function of to, directly or not; empty
+// lines and lines starting with # are skipped
+int outreachfile(const ttree_t *ptree, treeparam_t *pparam)
+{
+	ttreetrav_t *ptrav;
+	ttreescc_t *pscc = NULL;
+	ttreereach_t *preach = NULL;
+	ttreeset_t from, to;
+	FILE *pquery = NULL;
+	char sline[REACH_MAXLINE], *sfrom, *sto, *ssave;
+	unsigned answerno = 0;
+	int iErr = 0, iErrC, reach;
+	double tstart, tbuild, tquery = 0;
+
+	if (pparam->verbose)
+		printf("\nAnswering reachability queries... ");
+
+	ptrav = ttreetravinit(ptree);
+	if (!ptrav)
+		return -1;
+	if (ttreesetinit(&from, ptree) != 0) {
+		ttreetravfree(ptrav);
+		return -1;
+	}
+	if (ttreesetinit(&to, ptree) != 0) {
+		ttreesetfree(&from);
+		ttreetravfree(ptrav);
+		return -1;
+	}
+
+	// the index is built once for all the queries
+	tstart = reachclock();
+	pscc = ttreesccbuild(ptree, NULL);
+	if (pscc)
+		preach = ttreereachbuild(ptree, pscc);
+	if (!preach)
+		iErr = -1;
+	tbuild = reachclock() - tstart;
+
+	if (iErr == 0) {
+		pquery = strcmp(pparam->reachfile, "-") == 0 ?
+			     stdin :
+			     fopen(pparam->reachfile, "r");
+		if (!pquery) {
+			printf("\nCannot open file %s\n", pparam->reachfile);
+			iErr = -1;
+		}
+	}
+
+	if (iErr == 0)
+		iErr = outopen(ptrav, pparam);
+	if (iErr == 0) {
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "{\n\t\"reach\": [");
+
+		while (iErr == 0 && fgets(sline, sizeof(sline), pquery)) {
+			sline[strcspn(sline, "\r\n")] = '\0';
+			sfrom = strtok_r(sline, " \t", &ssave);
+			if (!sfrom || sfrom[0] == '#')
+				continue;
+			sto = strtok_r(NULL, " \t", &ssave);
+			if (!sto) {
+				printf("\nReachability query with no "
+				       "destination: %s\n",
+				       sfrom);
+				iErr = -1;
+				break;
+			}
+
+			ttreesetclear(&from);
+			ttreesetclear(&to);
+			if (ttreeselect(ptree, sfrom, &from) < 0 ||
+			    ttreeselect(ptree, sto, &to) < 0) {
+				iErr = -1;
+				break;
+			}
+
+			tstart = reachclock();
+			reach = reachsets(preach, &from, &to);
+			tquery += reachclock() - tstart;
+
+			reachwrite(ptrav->outfile, pparam, sfrom, sto, reach,
+				   answerno++);
+		}
+
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "%s]\n}\n",
+				answerno ? "\n\t" : "");
+
+		iErrC = outclose(ptrav, pparam);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	if (pquery && pquery != stdin)
+		fclose(pquery);
+
+	if (iErr == 0 && pparam->verbose) {
+		printf("done\n");
+		printf("Reachability index: %u components, %u calls between "
+		       "them, %.3f ms\n",
+		       pscc->sccno, pscc->succoff[pscc->sccno], tbuild);
+		printf("Queries: %u, %lu function pairs, %lu searched, %.3f "
+		       "ms\n",
+		       answerno, preach->queryno, preach->searchno, tquery);
+	}
+
+	ttreereachfree(preach);
+	ttreesccfree(pscc);
+	ttreesetfree(&from);
+	ttreesetfree(&to);
+	ttreetravfree(ptrav);
+
+	return iErr;
+}
@@ -0,0 +1,184 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outgraphviz.h"
+#include "outscc.h"
+#include "outtree.h"
+#include "slib.h"
+#include "ttreescc.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+static int outsccorder(const void *pa, const void *pb)
+{
+	uint64_t a = *(const uint64_t *)pa, b = *(const uint64_t *)pb;
+
+	return a < b ? -1 : a > b;
+}
+
+// output one recursive group, the group-th of the report
+static int outsccgroup(ttreetrav_t *ptrav, const ttreescc_t *pscc,
+		       unsigned scc, unsigned group, treeparam_t *pparam)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	FILE *pfile = ptrav->outfile;
+	ttreenode_t *pnode;
+	ttreebranch_t *pbranch;
+	ttreeiter_t iter;
+	unsigned i, n = ttreesccsize(pscc, scc);
+	int iErr = 0;
+
+	switch (pparam->outtype) {
+	case TREEOUT_GRAPHVIZ:
+		// a cluster with the functions and the calls among them
+		fprintf(pfile, "\tsubgraph cluster_scc_%u {\n"
+			       "\tlabel=\"recursion %u\"; labeljust=\"l\";\n",
+			group, group);
+		for (i = 0; iErr == 0 && i < n; i++)
+			iErr = outnode_gra(
+			    ptrav, ptree->nodes[pscc->sccnodes[pscc->sccoff[scc] + i]],
+			    pparam);
+		for (i = 0; iErr == 0 && i < n; i++) {
+			pnode = ptree->nodes[pscc->sccnodes[pscc->sccoff[scc] + i]];
+			ttreecallees(ptree, pnode, &iter);
+			while (iErr == 0 && (pbranch = ttreeiternext(&iter)))
+				if (pscc->nodescc[pbranch->child.node->id] ==
+				    scc)
+					iErr = outbranch_gra(ptrav, pbranch,
+							     pparam);
+		}
+		fprintf(pfile, "\t}\n");
+		break;
+
+	case TREEOUT_TEXT:
+		fprintf(pfile, "recursion %u: %u function%s\n", group, n,
+			n > 1 ? "s" : "");
+		for (i = 0; i < n; i++) {
+			pnode = ptree->nodes[pscc->sccnodes[pscc->sccoff[scc] + i]];
+			fprintf(pfile, "\t%s", pnode->funname);
+			if (pnode->filename)
+				fprintf(pfile, " %s", pnode->filename);
+			fprintf(pfile, "\n");
+		}
+		break;
+
+	case TREEOUT_JSON:
+		fprintf(pfile, "%s\n\t\t{\"size\": %u, \"functions\": [",
+			group > 1 ? "," : "", n);
+		for (i = 0; i < n; i++) {
+			pnode = ptree->nodes[pscc->sccnodes[pscc->sccoff[scc] + i]];
+			fprintf(pfile, "%s{\"name\": ", i ? ", " : "");
+			slibjsonstr(pfile, pnode->funname);
+			fprintf(pfile, ", \"file\": ");
+			if (pnode->filename)
+				slibjsonstr(pfile, pnode->filename);
+			else
+				fprintf(pfile, "null");
+			fprintf(pfile, "}");
+		}
+		fprintf(pfile, "]}");
+		break;
+
+	default:
+		iErr = -1;
+		break;
+	}
+
+	return iErr;
+}
+
+// report of the recursive groups of the whole database, i.e. the strongly
+// connected components with more than one function or a function calling
+// itself, from the largest one
+int outrecursion(const ttree_t *ptree, treeparam_t *pparam)
+{
+	ttreetrav_t *ptrav;
+	ttreescc_t *pscc;
+	uint64_t *porder = NULL;
+	unsigned c, i, groupno = 0;
+	int iErr = 0, iErrC;
+
+	if (pparam->verbose)
+		printf("\nMaking recursion report... ");
+
+	ptrav = ttreetravinit(ptree);
+	if (!ptrav)
+		return -1;
+
+	pscc = ttreesccbuild(ptree, NULL);
+	if (pscc)
+		porder = malloc((pscc->sccno + 1) * sizeof(*porder));
+	if (!pscc || !porder) {
+		printf("\nMemory allocation error\n");
+		iErr = -1;
+	}
+
+	// largest groups first, then in order of their first function; the
+	// component is found again from its first function
+	for (c = 0; iErr == 0 && c < pscc->sccno; c++)
+		if (ttreesccrecursive(pscc, c))
+			porder[groupno++] =
+			    (uint64_t)(UINT32_MAX - ttreesccsize(pscc, c))
+				<< 32 |
+			    pscc->sccnodes[pscc->sccoff[c]];
+	if (iErr == 0)
+		qsort(porder, groupno, sizeof(*porder), outsccorder);
+
+	if (iErr == 0)
+		iErr = outopen(ptrav, pparam);
+	if (iErr == 0) {
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "{\n\t\"recursion\": [");
+
+		for (i = 0; iErr == 0 && i < groupno; i++) {
+			c = pscc->nodescc[(uint32_t)porder[i]];
+			iErr = outsccgroup(ptrav, pscc, c, i + 1, pparam);
+		}
+
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "%s]\n}\n",
+				groupno ? "\n\t" : "");
+
+		iErrC = outclose(ptrav, pparam);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	if (iErr == 0 && pparam->verbose)
+		printf("done\n%u recursive groups among %u components\n",
+		       groupno, pscc->sccno);
+
+	free(porder);
+	ttreesccfree(pscc);
+	ttreetravfree(ptrav);
+
+	return iErr;
+}
@@ -0,0 +1,245 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outsize.h"
+#include "outtree.h"
+#include "slib.h"
+#include "ttreesize.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+#define SIZE_MAXLINE 4096 // longest line of a symbol size file
+
+// the node of a code symbol: the name of a part of a function split by the
+// compiler, e.g. foo.cold or foo.constprop.0, is cut at the dot. Without a
+// file, a name defined more than once goes to its first definition with no
+// size yet, so that the total stays right
+static ttreenode_t *sizenode(const ttree_t *ptree, const ttreesize_t *psize,
+			     char *sname, const char *sfile, unsigned line)
+{
+	ttreenode_t *pnode;
+	int nameid;
+
+	sname[strcspn(sname, ".")] = '\0';
+	if (sfile)
+		return ttreefinddef(ptree, sname, sfile, line);
+
+	nameid = ttreefindname(ptree, sname);
+	if (nameid < 0)
+		return NULL;
+	for (pnode = ptree->namenode[nameid]; pnode; pnode = pnode->nextdef)
+		if (pnode->filename && psize->bytes[pnode->id] == 0)
+			return pnode;
+
+	return ttreefinddef(ptree, sname, NULL, 0);
+}
+
+// read the code sizes of a file, or of the standard input for "-", as
+// written by nm -S: "<value> <size> <type> <name>", maybe followed by a tab
+// and "<file>:<line>" with nm -l. Only the code symbols, of type T, t, W or
+// w, are kept; any other line, such as symbols with no size or the object
+// names of an archive, is skipped
+static int sizeread(ttreesize_t *psize, const ttree_t *ptree,
+		    const char *sname, unsigned *psymno, unsigned *pmatchno)
+{
+	FILE *pfile;
+	char sline[SIZE_MAXLINE], *sfield[4], *sfile, *send, *ssave;
+	unsigned f, line;
+	unsigned long bytes;
+	ttreenode_t *pnode;
+
+	pfile = strcmp(sname, "-") == 0 ? stdin : fopen(sname, "r");
+	if (!pfile) {
+		printf("\nCannot open file %s\n", sname);
+		return -1;
+	}
+
+	while (fgets(sline, sizeof(sline), pfile)) {
+		sline[strcspn(sline, "\r\n")] = '\0';
+
+		sfile = strchr(sline, '\t');
+		line = 0;
+		if (sfile) {
+			*sfile++ = '\0';
+			send = strrchr(sfile, ':');
+			if (send) {
+				*send = '\0';
+				line = strtoul(send + 1, NULL, 10);
+			}
+		}
+
+		for (f = 0; f < 4; f++)
+			sfield[f] = strtok_r(f ? NULL : sline, " ", &ssave);
+		if (!sfield[0] || !sfield[3] || strtok_r(NULL, " ", &ssave) ||
+		    strlen(sfield[2]) != 1 || !strchr("TtWw", sfield[2][0]))
+			continue;
+		bytes = strtoul(sfield[1], &send, 16);
+		if (*send != '\0')
+			continue;
+
+		(*psymno)++;
+		pnode = sizenode(ptree, psize, sfield[3], sfile, line);
+		if (pnode) {
+			ttreesizeadd(psize, pnode, bytes);
+			(*pmatchno)++;
+		}
+	}
+
+	if (pfile != stdin)
+		fclose(pfile);
+
+	return 0;
+}
+
+// code sizes of the nodes and of what the roots reach, from the symbol size
+// file; NULL on errors
+ttreesize_t *outsizeload(const ttreetrav_t *ptrav, treeparam_t *pparam)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	ttreesize_t *psize;
+	unsigned symno = 0, matchno = 0;
+
+	psize = ttreesizeinit(ptree);
+	if (!psize)
+		return NULL;
+
+	if (sizeread(psize, ptree, pparam->sizefile, &symno, &matchno) != 0 ||
+	    ttreesizebuild(psize, ptree, &ptrav->roots, &ptrav->excluded) !=
+		0) {
+		ttreesizefree(psize);
+		return NULL;
+	}
+
+	if (pparam->verbose)
+		printf("\nCode sizes: %u of %u code symbols matched, %u of %u "
+		       "functions sized\n",
+		       matchno, symno, psize->sizedno, ptree->nodeno);
+
+	return psize;
+}
+
+// output the sizes of one root, the r-th
+static void sizerow(ttreetrav_t *ptrav, const ttreesize_t *psize,
+		    const ttreenode_t *proot, unsigned r, treeparam_t *pparam,
+		    unsigned answerno)
+{
+	FILE *pfile = ptrav->outfile;
+
+	switch (pparam->outtype) {
+	case TREEOUT_TEXT:
+		fprintf(pfile, "\t%lu\t%lu\t%u\t%s\t%s\n", psize->total[r],
+			psize->exclusive[r], psize->functions[r],
+			proot->funname,
+			proot->filename ? proot->filename : TT_LIBRARY);
+		break;
+
+	case TREEOUT_JSON:
+		fprintf(pfile, "%s\n\t\t{\"name\": ", answerno ? "," : "");
+		slibjsonstr(pfile, proot->funname);
+		fprintf(pfile, ", \"file\": ");
+		if (proot->filename)
+			slibjsonstr(pfile, proot->filename);
+		else
+			fprintf(pfile, "null");
+		fprintf(pfile,
+			", \"bytes\": %lu, \"total\": %lu, \"exclusive\": %lu, "
+			"\"functions\": %u}",
+			psize->bytes[proot->id], psize->total[r],
+			psize->exclusive[r], psize->functions[r]);
+		break;
+
+	default:
+		slibcsvstr(pfile, proot->funname);
+		fputc(',', pfile);
+		if (proot->filename)
+			slibcsvstr(pfile, proot->filename);
+		fprintf(pfile, ",%lu,%lu,%lu,%u\n", psize->bytes[proot->id],
+			psize->total[r], psize->exclusive[r],
+			psize->functions[r]);
+		break;
+	}
+}
+
+// code size reached from each root: in total, and only from that root
+// among all the roots, i.e. what leaving the root out would save
+int outsizes(const ttree_t *ptree, treeparam_t *pparam)
+{
+	ttreetrav_t *ptrav;
+	ttreesize_t *psize = NULL;
+	ttreenode_t *proot;
+	unsigned r, answerno = 0;
+	int iErr = 0, iErrC;
+
+	ptrav = ttreetravinit(ptree);
+	if (!ptrav)
+		return -1;
+
+	iErr = outtreeresolve(ptrav, pparam);
+	if (iErr == 0) {
+		psize = outsizeload(ptrav, pparam);
+		if (!psize)
+			iErr = -1;
+	}
+
+	if (iErr == 0)
+		iErr = outopen(ptrav, pparam);
+	if (iErr == 0) {
+		if (pparam->outtype == TREEOUT_TEXT)
+			fprintf(ptrav->outfile,
+				"sizes: bytes of code reached from each root, "
+				"from it only, functions reached\n");
+		else if (pparam->outtype == TREEOUT_CSV)
+			fprintf(ptrav->outfile,
+				"root,file,bytes,total,exclusive,functions\n");
+		else
+			fprintf(ptrav->outfile, "{\n\t\"sizes\": [");
+
+		for (r = 0; r < ptrav->roots.nodeno; r++) {
+			proot = ptrav->roots.nodes[r];
+			if (!ttreesetisin(&ptrav->excluded, proot->id))
+				sizerow(ptrav, psize, proot, r, pparam,
+					answerno++);
+		}
+
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "%s]\n}\n",
+				answerno ? "\n\t" : "");
+
+		iErrC = outclose(ptrav, pparam);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	ttreesizefree(psize);
+	ttreetravfree(ptrav);
+
+	return iErr;
+}
@@ -0,0 +1,300 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "outstack.h"
+#include "outtree.h"
+#include "slib.h"
+#include "ttreestack.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+#define STACK_MAXLINE 4096 // longest line of a stack usage file
+
+// split a line written by gcc -fstack-usage,
+// "<file>:<line>:<column>:<function>\t<bytes>\t<qualifiers>": the column is
+// missing with old versions and a C++ function is its declaration, e.g.
+// "int ns::foo(int)", of which only the name is kept. Returns 0 if the line
+// is not such a line
+static int stackparse(char *sline, char **psfile, unsigned *pline,
+		      char **psname, unsigned long *pbytes, int *pdynamic)
+{
+	char *stab, *send, *s, *sname = NULL;
+
+	stab = strchr(sline, '\t');
+	if (!stab)
+		return 0;
+	*stab++ = '\0';
+	*pbytes = strtoul(stab, &send, 10);
+	if (send == stab)
+		return 0;
+	s = send + strspn(send, "\t");
+	*pdynamic = strncmp(s, "dynamic", 7) == 0 && !strstr(s, "bounded");
+
+	// the file name may have colons too, up to :<line>:
+	for (s = strchr(sline, ':'); s; s = strchr(s + 1, ':')) {
+		if (!isdigit((unsigned char)s[1]))
+			continue;
+		*pline = strtoul(&s[1], &send, 10);
+		if (*send != ':')
+			continue;
+		if (isdigit((unsigned char)send[1])) {
+			strtoul(&send[1], &send, 10);
+			if (*send != ':')
+				continue;
+		}
+		*s = '\0';
+		sname = send + 1;
+		break;
+	}
+	if (!sname)
+		return 0;
+
+	send = sname + strcspn(sname, "(");
+	*send = '\0';
+	while (send > sname &&
+	       (isalnum((unsigned char)send[-1]) || send[-1] == '_'))
+		send--;
+	*psfile = sline;
+	*psname = send;
+
+	return **psname != '\0';
+}
+
+// read the frames of a stack usage file, or of the standard input for "-";
+// empty lines and lines starting with # are skipped
+static int stackread(ttreestack_t *pstack, const ttree_t *ptree,
+		     const char *sname, unsigned *plineno, unsigned *pmatchno)
+{
+	FILE *pfile;
+	char sline[STACK_MAXLINE], *sfile, *sfun;
+	unsigned line;
+	unsigned long bytes;
+	ttreenode_t *pnode;
+	int dynamic, iErr = 0;
+
+	pfile = strcmp(sname, "-") == 0 ? stdin : fopen(sname, "r");
+	if (!pfile) {
+		printf("\nCannot open file %s\n", sname);
+		return -1;
+	}
+
+	while (fgets(sline, sizeof(sline), pfile)) {
+		sline[strcspn(sline, "\r\n")] = '\0';
+		if (sline[0] == '\0' || sline[0] == '#')
+			continue;
+		if (!stackparse(sline, &sfile, &line, &sfun, &bytes,
+				&dynamic)) {
+			printf("\nNot a stack usage line: %s\n", sline);
+			iErr = -1;
+			break;
+		}
+
+		(*plineno)++;
+		pnode = ttreefinddef(ptree, sfun, sfile, line);
+		if (pnode) {
+			ttreestackframe(pstack, pnode, bytes, dynamic);
+			(*pmatchno)++;
+		}
+	}
+
+	if (pfile != stdin)
+		fclose(pfile);
+
+	return iErr;
+}
+
+// output the worst path of a root, the answerno-th
+static void stackroot(ttreetrav_t *ptrav, const ttreestack_t *pstack,
+		      const ttreenode_t *proot, treeparam_t *pparam,
+		      unsigned answerno)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	FILE *pfile = ptrav->outfile;
+	const ttreenode_t *pnode;
+	const char *sunbounded = NULL;
+	unsigned n, stepno = 0;
+
+	// the path ends where the stack stops being bounded
+	if (pstack->flags[proot->id] & TTREESTACK_UNBOUNDED) {
+		for (n = proot->id; pstack->next[n] != TTREESTACK_END;
+		     n = pstack->next[n])
+			;
+		sunbounded = pstack->flags[n] & TTREESTACK_RECURSIVE ?
+				     "recursion" :
+				     "dynamic";
+	}
+
+	switch (pparam->outtype) {
+	case TREEOUT_TEXT:
+		if (sunbounded)
+			fprintf(pfile, "%s: unbounded, %s in %s\n",
+				proot->funname, sunbounded,
+				ptree->nodes[n]->funname);
+		else
+			fprintf(pfile, "%s: %lu bytes\n", proot->funname,
+				pstack->worst[proot->id]);
+		break;
+
+	case TREEOUT_JSON:
+		fprintf(pfile, "%s\n\t\t{\"root\": ", answerno ? "," : "");
+		slibjsonstr(pfile, proot->funname);
+		if (sunbounded)
+			fprintf(pfile, ", \"bytes\": null, \"unbounded\": \"%s\"",
+				sunbounded);
+		else
+			fprintf(pfile, ", \"bytes\": %lu, \"unbounded\": null",
+				pstack->worst[proot->id]);
+		fprintf(pfile, ", \"path\": [");
+		break;
+
+	default:
+		break;
+	}
+
+	for (n = proot->id; n != TTREESTACK_END; n = pstack->next[n]) {
+		pnode = ptree->nodes[n];
+		switch (pparam->outtype) {
+		case TREEOUT_TEXT:
+			if (pstack->flags[n] & TTREESTACK_FRAME)
+				fprintf(pfile, "\t%lu", pstack->frame[n]);
+			else
+				fprintf(pfile, "\t?");
+			fprintf(pfile, "\t%s (%s)\n", pnode->funname,
+				pnode->filename ? pnode->filename : TT_LIBRARY);
+			break;
+
+		case TREEOUT_JSON:
+			fprintf(pfile, "%s\n\t\t\t{\"name\": ",
+				stepno ? "," : "");
+			slibjsonstr(pfile, pnode->funname);
+			fprintf(pfile, ", \"file\": ");
+			if (pnode->filename)
+				slibjsonstr(pfile, pnode->filename);
+			else
+				fprintf(pfile, "null");
+			if (pstack->flags[n] & TTREESTACK_FRAME)
+				fprintf(pfile, ", \"frame\": %lu}",
+					pstack->frame[n]);
+			else
+				fprintf(pfile, ", \"frame\": null}");
+			break;
+
+		default:
+			slibcsvstr(pfile, proot->funname);
+			if (sunbounded)
+				fprintf(pfile, ",,%s,", sunbounded);
+			else
+				fprintf(pfile, ",%lu,,",
+					pstack->worst[proot->id]);
+			slibcsvstr(pfile, pnode->funname);
+			fputc(',', pfile);
+			if (pnode->filename)
+				slibcsvstr(pfile, pnode->filename);
+			fputc(',', pfile);
+			if (pstack->flags[n] & TTREESTACK_FRAME)
+				fprintf(pfile, "%lu", pstack->frame[n]);
+			fputc('\n', pfile);
+			break;
+		}
+		stepno++;
+	}
+
+	if (pparam->outtype == TREEOUT_JSON)
+		fprintf(pfile, "\n\t\t]}");
+}
+
+// worst case stack usage from each root, with the call chain giving it:
+// frame sizes come from the .su files of gcc -fstack-usage, concatenated;
+// a chain reaching a recursive group or a dynamic frame is unbounded.
+// Excluded functions are neither roots nor scanned
+int outstack(const ttree_t *ptree, treeparam_t *pparam)
+{
+	ttreetrav_t *ptrav;
+	ttreestack_t *pstack = NULL;
+	ttreenode_t *proot;
+	unsigned r, lineno = 0, matchno = 0, answerno = 0;
+	int iErr = 0, iErrC;
+
+	if (pparam->verbose)
+		printf("\nComputing the worst stack usage... ");
+
+	ptrav = ttreetravinit(ptree);
+	if (!ptrav)
+		return -1;
+
+	iErr = outtreeresolve(ptrav, pparam);
+	if (iErr == 0) {
+		pstack = ttreestackinit(ptree);
+		if (!pstack)
+			iErr = -1;
+	}
+	if (iErr == 0)
+		iErr = stackread(pstack, ptree, pparam->stackfile, &lineno,
+				 &matchno);
+	if (iErr == 0)
+		iErr = ttreestackbuild(pstack, ptree, &ptrav->excluded);
+
+	if (iErr == 0)
+		iErr = outopen(ptrav, pparam);
+	if (iErr == 0) {
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "{\n\t\"stack\": [");
+		else if (pparam->outtype == TREEOUT_CSV)
+			fprintf(ptrav->outfile,
+				"root,stack,unbounded,function,file,frame\n");
+
+		for (r = 0; r < ptrav->roots.nodeno; r++) {
+			proot = ptrav->roots.nodes[r];
+			if (!ttreesetisin(&ptrav->excluded, proot->id))
+				stackroot(ptrav, pstack, proot, pparam,
+					  answerno++);
+		}
+
+		if (pparam->outtype == TREEOUT_JSON)
+			fprintf(ptrav->outfile, "%s]\n}\n",
+				answerno ? "\n\t" : "");
+
+		iErrC = outclose(ptrav, pparam);
+		if (iErr == 0)
+			iErr = iErrC;
+	}
+
+	if (iErr == 0 && pparam->verbose)
+		printf("done\n%u of %u stack usage lines matched, %u of %u "
+		       "functions with a frame\n",
+		       matchno, lineno, pstack->frameno, ptree->nodeno);
+
+	ttreestackfree(pstack);
+	ttreetravfree(ptrav);
+
+	return iErr;
+}
@@ -23,27 +23,46 @@
  * THE SOFTWARE.
  */
 
+#include <limits.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #ifndef _ALL_IN_ONE
 #include "defines.h"
+#include "outbfs.h"
 #include "outgraphviz.h"
+#include "outsize.h"
 #include "outtree.h"
+#include "ttreecomm.h"
+#include "ttreemetric.h"
+#include "ttreescc.h"
+#include "ttreetrav.h"
 #endif // _ALL_IN_ONE
-
-#define ROOTMARK                                                               \
-	0x100 // special value used to find the path to be highlighted (-p
-	      // option)
-
 // start output
-int outopen(ttree_t *ptree, treeparam_t *pparam)
+int outopen(ttreetrav_t *ptrav, treeparam_t *pparam)
 {
 	int iErr = 0;
 
 	switch (pparam->outtype) {
 	case TREEOUT_GRAPHVIZ:
-		iErr = outopen_gra(ptree, pparam);
+		iErr = outopen_gra(ptrav, pparam);
+		break;
+
+	case TREEOUT_TEXT:
+	case TREEOUT_JSON:
+	case TREEOUT_CSV:
+	case TREEOUT_BINARY:
+		// queries and reports: the caller writes the file
+		ptrav->outfile =
+		    fopen(pparam->outfile,
+			  pparam->outtype == TREEOUT_BINARY ? "wb" : "w");
+		if (ptrav->outfile == NULL) {
+			printf("\nError while opening output file\n");
+			iErr = -1;
+		}
 		break;
 
 	default:
@@ -55,13 +74,24 @@ int outopen(ttree_t *ptree, treeparam_t *pparam)
 }
 
 // end output
-int outclose(ttree_t *ptree, treeparam_t *pparam)
+int outclose(ttreetrav_t *ptrav, treeparam_t *pparam)
 {
 	int iErr = 0;
 
 	switch (pparam->outtype) {
 	case TREEOUT_GRAPHVIZ:
-		iErr = outclose_gra(ptree, pparam);
+		iErr = outclose_gra(ptrav, pparam);
+		break;
+
+	case TREEOUT_TEXT:
+	case TREEOUT_JSON:
+	case TREEOUT_CSV:
+	case TREEOUT_BINARY:
+		if (fclose(ptrav->outfile) != 0) {
+			printf("\nError while closing output file\n");
+			iErr = -1;
+		}
+		ptrav->outfile = NULL;
 		break;
 
 	default:
@@ -73,346 +103,711 @@ int outclose(ttree_t *ptree, treeparam_t *pparam)
 }
 
 // output one node
-int outnode(ttreenode_t *pnode, treeparam_t *pparam, int colr)
+int outnode(ttreetrav_t *ptrav, ttreenode_t *pnode, treeparam_t *pparam)
 {
 	int iErr = 0;
 
-	if (pnode && pnode->outdone)
-		return iErr;
-
-	if (colr >= 0) {
-		if (colr == ROOTMARK || pnode->icolor == ROOTMARK) {
-			// assign color only while "rootmarking" or if node was
-			// previously
-			// "rootmarked"
-			pnode->icolor = colr;
-		}
-	} else {
-		if (pnode->icolor == ROOTMARK)
-			pnode->icolor =
-			    0; // Only "rootmarked", use default color/style
-
-		// output node
-		switch (pparam->outtype) {
-		case TREEOUT_GRAPHVIZ:
-			iErr = outnode_gra(pnode, pparam);
-			break;
+	switch (pparam->outtype) {
+	case TREEOUT_GRAPHVIZ:
+		iErr = outnode_gra(ptrav, pnode, pparam);
+		break;
 
-		default:
-			iErr = -1;
-			break;
-		}
+	default:
+		iErr = -1;
+		break;
 	}
 
-	pnode->outdone = 1;
-
 	return iErr;
 }
 
 // output one branch
-int outbranch(ttreebranch_t *pbranch, treeparam_t *pparam, int colr)
+int outbranch(ttreetrav_t *ptrav, ttreebranch_t *pbranch, treeparam_t *pparam)
 {
 	int iErr = 0;
-	int i;
 
-	if (!pbranch)
-		return -1;
+	switch (pparam->outtype) {
+	case TREEOUT_GRAPHVIZ:
+		iErr = outbranch_gra(ptrav, pbranch, pparam);
+		break;
+
+	default:
+		iErr = -1;
+		break;
+	}
+
+	return iErr;
+}
 
-	if (pbranch && pbranch->outdone)
-		return iErr;
+// add one node to the output, if not already there
+static void outaddnode(ttreetrav_t *ptrav, ttreenode_t *pnode)
+{
+	if (bitsettest(ptrav->nodeout, pnode->id))
+		return;
+
+	bitsetset(ptrav->nodeout, pnode->id);
+	ptrav->outlist[ptrav->outno++] = pnode->id << 1;
+}
+
+// add one branch to the output, if not already there and not excluded
+static void outaddbranch(ttreetrav_t *ptrav, ttreebranch_t *pbranch)
+{
+	if (bitsettest(ptrav->branchout, pbranch->id))
+		return;
 
 	// check if branch should be excluded
-	for (i = 0; i < pparam->excludfno; i++) {
-		// check if library excluded
-		if (strcmp(pparam->excludf[i], TT_LIBRARY) == 0 &&
-		    pbranch->child.node->filename == NULL)
-			return iErr;
-
-		// check if caller or callee function name matches one of those
-		// in the
-		// exclusion list
-		if (strcmp(pbranch->parent.node->funname, pparam->excludf[i]) == 0 ||
-		    strcmp(pbranch->child.node->funname, pparam->excludf[i]) == 0)
-			return iErr;
-	}
+	if (ttreesetisin(&ptrav->excluded, pbranch->parent.node->id) ||
+	    ttreesetisin(&ptrav->excluded, pbranch->child.node->id))
+		return;
+
+	bitsetset(ptrav->branchout, pbranch->id);
+	ptrav->outlist[ptrav->outno++] = pbranch->id << 1 | TTREETRAV_BRANCH;
+}
+
+// frame of the explicit stack used by outsubtree() instead of recursion
+typedef struct outframe_st {
+	ttreenode_t *node; // node whose subtree is being scanned
+	int fdepth;	   // depth left for callees, already decreased
+	int bdepth;	   // depth left for callers, already decreased
+	int phase;	   // OUTPHASE_xxx
+	ttreeiter_t iter;  // branches still to scan in this phase
+} outframe_t;
+
+#define OUTPHASE_FORWARD 0  // start scanning callees
+#define OUTPHASE_CALLEES 1  // scanning callees
+#define OUTPHASE_BACKWARD 2 // start scanning callers
+#define OUTPHASE_CALLERS 3  // scanning callers
+#define OUTPHASE_END 4	    // subtree done
+
+typedef struct outstack_st {
+	outframe_t *frames;
+	unsigned frameno;
+	unsigned size;
+} outstack_t;
+
+// enter the subtree of pnode: add the node to the output and push a frame for
+// scanning its branches, unless the subtree has already been scanned
+static int outsubtreeenter(ttreetrav_t *ptrav, outstack_t *pstack,
+			   ttreenode_t *pnode, int fdepth, int bdepth)
+{
+	outframe_t *pframe;
+
+	if (pnode == NULL)
+		return 0;
 
-	if (colr >= 0) {
-		if (colr == ROOTMARK || pbranch->icolor == ROOTMARK) {
-			// assign color only while "rootmarking" or if branch
-			// was previously
-			// "rootmarked"
-			pbranch->icolor = colr;
+	if (bitsettest(ptrav->subtreeout, pnode->id))
+		return 0;
+
+	if (ttreesetisin(&ptrav->excluded, pnode->id))
+		return 0;
+
+	// before scanning subtree, output the node itself
+	outaddnode(ptrav, pnode);
+
+	if (pstack->frameno == pstack->size) {
+		pframe = realloc(pstack->frames,
+				 2 * pstack->size * sizeof(*pframe));
+		if (!pframe) {
+			printf("\nMemory allocation error\n");
+			return -1;
 		}
-	} else {
-		if (pbranch->icolor == ROOTMARK)
-			pbranch->icolor =
-			    0; // Only "rootmarked", use default color/style
-
-		// output branch
-		switch (pparam->outtype) {
-		case TREEOUT_GRAPHVIZ:
-			iErr = outbranch_gra(pbranch, pparam);
+		pstack->frames = pframe;
+		pstack->size *= 2;
+	}
+
+	pframe = &pstack->frames[pstack->frameno++];
+	pframe->node = pnode;
+	pframe->fdepth = fdepth;
+	pframe->bdepth = bdepth;
+	pframe->phase = OUTPHASE_FORWARD;
+
+	return 0;
+}
+
+// output of a subtree (forward and backward) starting from pnode; the scan is
+// depth first as if each subtree was a recursive call, but the pending
+// subtrees are kept on a heap allocated stack, so any depth can be scanned
+int outsubtree(ttreetrav_t *ptrav, ttreenode_t *pnode, int fdepth, int bdepth)
+{
+	int iErr = 0;
+	outstack_t stack;
+	outframe_t *pframe;
+	ttreebranch_t *pbranch;
+	ttreenode_t *pnext;
+
+	stack.size = 64;
+	stack.frameno = 0;
+	stack.frames = malloc(stack.size * sizeof(*stack.frames));
+	if (!stack.frames) {
+		printf("\nMemory allocation error\n");
+		return -1;
+	}
+
+	iErr = outsubtreeenter(ptrav, &stack, pnode, fdepth, bdepth);
+
+	while (iErr == 0 && stack.frameno > 0) {
+		pframe = &stack.frames[stack.frameno - 1];
+		pnode = pframe->node;
+
+		switch (pframe->phase) {
+		case OUTPHASE_FORWARD:
+			pframe->phase = OUTPHASE_BACKWARD;
+			if (pframe->fdepth != 0) {
+				// forward (children) scanning
+				if (pframe->fdepth > 0)
+					pframe->fdepth--;
+
+				// find all branches starting from this node
+				ttreecallees(ptrav->ptree, pnode,
+					     &pframe->iter);
+				pframe->phase = OUTPHASE_CALLEES;
+			}
+			break;
+
+		case OUTPHASE_BACKWARD:
+			pframe->phase = OUTPHASE_END;
+			if (pframe->bdepth != 0) {
+				if (pframe->bdepth > 0)
+					pframe->bdepth--;
+
+				// find all branches with this node as
+				// destination
+				ttreecallers(ptrav->ptree, pnode,
+					     &pframe->iter);
+				pframe->phase = OUTPHASE_CALLERS;
+			}
+			break;
+
+		case OUTPHASE_CALLEES:
+		case OUTPHASE_CALLERS:
+			pbranch = ttreeiternext(&pframe->iter);
+			if (pbranch == NULL) {
+				pframe->phase++;
+				break;
+			}
+
+			if (bitsettest(ptrav->branchout, pbranch->id))
+				break;
+
+			// if branch not done, output branch
+			outaddbranch(ptrav, pbranch);
+
+			pnext = pframe->phase == OUTPHASE_CALLEES ?
+				    pbranch->child.node :
+				    pbranch->parent.node;
+
+			// do subtree, avoiding to involve recursion in depth
+			// decrease; pframe is not valid after this
+			if (pnext == pnode)
+				break;
+			if (pframe->phase == OUTPHASE_CALLEES)
+				iErr = outsubtreeenter(ptrav, &stack, pnext,
+						       pframe->fdepth, 0);
+			else
+				iErr = outsubtreeenter(ptrav, &stack, pnext, 0,
+						       pframe->bdepth);
 			break;
 
 		default:
-			iErr = -1;
+			bitsetset(ptrav->subtreeout, pnode->id);
+			stack.frameno--;
 			break;
 		}
 	}
 
-	pbranch->outdone = 1;
+	free(stack.frames);
 
 	return iErr;
 }
 
-// output of a subtree (forward and backward) starting from pnode
-int outsubtree(ttree_t *ptree, treeparam_t *pparam, ttreenode_t *pnode,
-	       int fdepth, int bdepth, int colr)
+// output of the nodes within depth calls from the roots, forward (callees)
+// or backward (callers); the scan is breadth first, so every node is reached
+// first by one of its shortest paths and expanded only if its distance from
+// the roots is below depth (-1 = maximum), whatever the order of the branches;
+// with more than one thread, see outbfs()
+//
+// from proot alone, if not NULL, the scan goes as the one of outsubtree()
+// with no depth limits: the nodes whose subtree is done are reached but not
+// gone through, and the subtree of each node queued is done at the end
+static int outdepth(ttreetrav_t *ptrav, ttreenode_t *proot, int forward,
+		    int depth, int threadno)
 {
-	int iErr = 0;
+	const ttree_t *ptree = ptrav->ptree;
+	unsigned head = 0, tail = 0;
+	unsigned r, dist;
+	ttreenode_t *pnode, *pnext;
 	ttreebranch_t *pbranch;
-	int i, prevcol;
+	ttreeiter_t iter;
+
+	if (threadno > 1)
+		return outbfs(ptrav, proot, forward, depth, threadno);
+
+	if (proot)
+		memcpy(ptrav->nodeseen, ptrav->subtreeout,
+		       BITSET_WORDS(ptree->nodeno) * sizeof(bitset_t));
+	else
+		bitsetzero(ptrav->nodeseen, ptree->nodeno);
+
+	for (r = 0; r < (proot ? 1 : ptrav->roots.nodeno); r++) {
+		pnode = proot ? proot : ptrav->roots.nodes[r];
+		if (ttreesetisin(&ptrav->excluded, pnode->id))
+			continue;
+
+		bitsetset(ptrav->nodeseen, pnode->id);
+		ptrav->nodedist[pnode->id] = 0;
+		ptrav->queue[tail++] = pnode->id;
+		outaddnode(ptrav, pnode);
+	}
 
-	if (pnode == NULL)
-		return iErr;
+	while (head < tail) {
+		pnode = ptree->nodes[ptrav->queue[head++]];
+		dist = ptrav->nodedist[pnode->id];
+		if (depth >= 0 && dist >= (unsigned)depth)
+			continue;
+
+		if (forward)
+			ttreecallees(ptree, pnode, &iter);
+		else
+			ttreecallers(ptree, pnode, &iter);
+		while ((pbranch = ttreeiternext(&iter)) != NULL) {
+			outaddbranch(ptrav, pbranch);
+
+			pnext = forward ? pbranch->child.node :
+					  pbranch->parent.node;
+			if (bitsettest(ptrav->nodeseen, pnext->id) ||
+			    ttreesetisin(&ptrav->excluded, pnext->id))
+				continue;
+
+			bitsetset(ptrav->nodeseen, pnext->id);
+			ptrav->nodedist[pnext->id] = dist + 1;
+			ptrav->queue[tail++] = pnext->id;
+			outaddnode(ptrav, pnext);
+		}
+	}
 
-	if (pnode->subtreeoutdone)
-		return iErr;
+	if (proot)
+		for (r = 0; r < tail; r++)
+			bitsetset(ptrav->subtreeout, ptrav->queue[r]);
 
-	for (i = 0; i < pparam->excludfno; i++) {
-		// check if library excluded
-		if (strcmp(pparam->excludf[i], TT_LIBRARY) == 0 &&
-		    pnode->filename == NULL)
-			return iErr;
-
-		// check if node function name matches one of those in the
-		// exclusion list
-		if (strcmp(pnode->funname, pparam->excludf[i]) == 0)
-			return iErr;
+	return 0;
+}
+
+// find the nodes reached from a set of nodes, forward (callees) or backward
+// (callers), only through the branches in the output; the nodes of the stop
+// set are reached but not gone through
+static void outreach(ttreetrav_t *ptrav, const ttreeset_t *pfrom,
+		     const ttreeset_t *pstop, int forward, bitset_t *preached)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	unsigned head = 0, tail = 0;
+	unsigned i;
+	ttreenode_t *pnode, *pnext;
+	ttreebranch_t *pbranch;
+	ttreeiter_t iter;
+
+	bitsetzero(preached, ptree->nodeno);
+
+	for (i = 0; i < pfrom->nodeno; i++) {
+		pnode = pfrom->nodes[i];
+		if (!bitsettest(ptrav->nodeout, pnode->id))
+			continue;
+
+		bitsetset(preached, pnode->id);
+		ptrav->queue[tail++] = pnode->id;
 	}
 
-	// before scanning subtree, output the node itself
-	iErr = outnode(pnode, pparam, colr);
-
-	if (colr > 0) {
-		if (colr == ROOTMARK) {
-			// if "rootmarking" (colr == ROOTMARK) and the last
-			// function of the path
-			// to be highlighted from roots has been found, then
-			// stop scanning tree
-			if (pparam->callp)
-				if (strcmp(pnode->funname, pparam->callp) == 0)
-					return iErr;
-		} else {
-			// if coloring and this is a root, then stop scanning
-			// tree
-			if (pnode->isroot)
-				return iErr;
+	while (head < tail) {
+		pnode = ptree->nodes[ptrav->queue[head++]];
+		if (ttreesetisin(pstop, pnode->id))
+			continue;
+
+		if (forward)
+			ttreecallees(ptree, pnode, &iter);
+		else
+			ttreecallers(ptree, pnode, &iter);
+		while ((pbranch = ttreeiternext(&iter)) != NULL) {
+			if (!bitsettest(ptrav->branchout, pbranch->id))
+				continue;
+
+			pnext = forward ? pbranch->child.node :
+					  pbranch->parent.node;
+			if (bitsettest(preached, pnext->id))
+				continue;
+
+			bitsetset(preached, pnext->id);
+			ptrav->queue[tail++] = pnext->id;
 		}
 	}
+}
 
-	if (iErr == 0 && fdepth != 0) {
-		// forward (children) scanning
-		if (fdepth > 0)
-			fdepth--;
-
-		pbranch = NULL;
-		do {
-			// find all branches starting from this node
-			pbranch = ttreefindbranch(ptree, pnode, NULL,
-						  pnode->filename, pbranch);
-
-			if (pbranch) {
-				if (!pbranch->outdone) {
-					// if branch not done
-					prevcol = pbranch->icolor;
-					// output branch
-					iErr = outbranch(pbranch, pparam, colr);
-					if (iErr != 0)
-						break;
-
-					// do subtree
-					if (pbranch->child.node !=
-					    pnode) // avoid involving recursion
-						   // in depth decrease
-						if (colr <= 0 ||
-						    colr == ROOTMARK ||
-						    prevcol == ROOTMARK)
-							iErr = outsubtree(
-							    ptree, pparam,
-							    pbranch->child.node,
-							    fdepth, 0, colr);
-				}
-			}
-		} while (pbranch != NULL);
+// color the call paths to be highlighted: a node or a branch is on the path
+// from the roots to a call path end if it is reached from the roots and
+// reaches that end, or the other way round if the end calls the roots; only
+// the calls in the output are followed and a path stops at its first root or
+// end, so each call path costs four linear scans
+static int outhighlight(ttreetrav_t *ptrav, treeparam_t *pparam)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	ttreebranch_t *pbranch;
+	unsigned i, u, v, id;
+	int p, style = 0;
+
+	if (pparam->callpno == 0)
+		return 0;
+
+	for (p = 0; p < pparam->callpno; p++) {
+		// the n-th style goes with the n-th call path, the following
+		// ones take the next style
+		if (p < pparam->hlstyleno)
+			style = pparam->hlstyle[p];
+		else if (p > 0)
+			style = (style + 1) % TT_MAXSTYLES;
+
+		ttreesetclear(&ptrav->targets);
+		if (ttreeselect(ptree, pparam->callp[p], &ptrav->targets) < 0)
+			return -1;
+
+		outreach(ptrav, &ptrav->roots, &ptrav->targets, 1,
+			 ptrav->fromroots);
+		outreach(ptrav, &ptrav->targets, &ptrav->roots, 0,
+			 ptrav->totarget);
+		outreach(ptrav, &ptrav->targets, &ptrav->roots, 1,
+			 ptrav->fromtarget);
+		outreach(ptrav, &ptrav->roots, &ptrav->targets, 0,
+			 ptrav->toroots);
+
+		// the first call path including a node or a branch colors it
+		for (i = 0; i < ptrav->outno; i++) {
+			id = ptrav->outlist[i] >> 1;
+			if (ptrav->outlist[i] & TTREETRAV_BRANCH) {
+				pbranch = ptree->branches[id];
+				u = pbranch->parent.node->id;
+				v = pbranch->child.node->id;
+				// a path goes on from the caller only if it
+				// is not an end, and to the callee only if
+				// it is not a start
+				if (ptrav->branchcolor[id] == 0 &&
+				    ((bitsettest(ptrav->fromroots, u) &&
+				      !ttreesetisin(&ptrav->targets, u) &&
+				      bitsettest(ptrav->totarget, v) &&
+				      !ttreesetisin(&ptrav->roots, v)) ||
+				     (bitsettest(ptrav->fromtarget, u) &&
+				      !ttreesetisin(&ptrav->roots, u) &&
+				      bitsettest(ptrav->toroots, v) &&
+				      !ttreesetisin(&ptrav->targets, v))))
+					ptrav->branchcolor[id] = style + 1;
+			} else if (ptrav->nodecolor[id] == 0 &&
+				   ((bitsettest(ptrav->fromroots, id) &&
+				     bitsettest(ptrav->totarget, id)) ||
+				    (bitsettest(ptrav->fromtarget, id) &&
+				     bitsettest(ptrav->toroots, id))))
+				ptrav->nodecolor[id] = style + 1;
+		}
 	}
 
-	if (iErr == 0 && bdepth != 0) {
-		if (bdepth > 0)
-			bdepth--;
-
-		pbranch = NULL;
-		do {
-			// find all branches with this node as destination
-			pbranch =
-			    ttreefindbranch(ptree, NULL, pnode, NULL, pbranch);
-
-			if (pbranch) {
-				if (!pbranch->outdone) {
-					// if branch not done
-					prevcol = pbranch->icolor;
-					// output branch
-					iErr = outbranch(pbranch, pparam, colr);
-					if (iErr != 0)
-						break;
-
-					// do subtree
-					if (pbranch->parent.node !=
-					    pnode) // avoid involving recursion
-						   // in depth decrease
-						if (colr <= 0 ||
-						    colr == ROOTMARK ||
-						    prevcol == ROOTMARK)
-							iErr = outsubtree(
-							    ptree, pparam,
-							    pbranch->parent.node,
-							    0, bdepth, colr);
-				}
-			}
-		} while (pbranch != NULL);
+	return 0;
+}
+
+// resolve the root and excluded function selectors to sets of nodes, so that
+// the tree scan only tests bits; the call path selectors are resolved one at a
+// time by outhighlight()
+int outtreeresolve(ttreetrav_t *ptrav, treeparam_t *pparam)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	unsigned n;
+	int i, iRes;
+
+	for (i = 0; i < pparam->rootno; i++) {
+		iRes = ttreeselect(ptree, pparam->root[i], &ptrav->roots);
+		if (iRes < 0)
+			return iRes;
+		if (iRes == 0 && pparam->verbose)
+			printf("\nNo function matches root %s\n",
+			       pparam->root[i]);
 	}
+	ttreesetsort(&ptrav->roots);
 
-	pnode->subtreeoutdone = 1;
+	for (i = 0; i < pparam->excludfno; i++) {
+		if (strcmp(pparam->excludf[i], TT_LIBRARY) == 0) {
+			// library functions have no file where they are
+			// defined
+			for (n = 0; n < ptree->nodeno; n++)
+				if (ptree->nodes[n]->filename == NULL &&
+				    ttreesetadd(&ptrav->excluded,
+						ptree->nodes[n]) < 0)
+					return -1;
+		} else if (ttreeselect(ptree, pparam->excludf[i],
+				       &ptrav->excluded) < 0)
+			return -1;
+	}
 
-	return iErr;
+	return 0;
 }
 
-// tree output init
-void outtreeinit(ttree_t *ptree, int color, int resetroot)
+// call between condensed groups, by groups and then position in outlist
+typedef struct outcall_st {
+	uint64_t groups; // caller group << 32 | callee group
+	unsigned pos;	 // position in outlist
+} outcall_t;
+
+static int outcallorder(const void *pa, const void *pb)
 {
-	ttreenode_t *pnode;
+	const outcall_t *a = pa, *b = pb;
+
+	if (a->groups != b->groups)
+		return a->groups < b->groups ? -1 : 1;
+
+	return a->pos < b->pos ? -1 : a->pos > b->pos;
+}
+
+// merge the output of each recursive group condensed into a node: its first
+// node stands for the group, the calls within the group are dropped and the
+// calls between the same two groups are output once; the group or call
+// output takes the first highlight among the merged ones, so the entries of
+// outlist not output are set in pskip
+static int outcondense(ttreetrav_t *ptrav, bitset_t *pskip)
+{
+	const ttree_t *ptree = ptrav->ptree;
+	const ttreescc_t *pscc = ptrav->pscc;
+	unsigned *sccnode;
+	outcall_t *pcalls;
+	unsigned i, j, id, callno = 0, cu, cv;
 	ttreebranch_t *pbranch;
 
-	pnode = ptree->firstnode;
-	while (pnode != NULL) {
-		pnode->outdone = 0;
-		pnode->subtreeoutdone = 0;
-		if (resetroot)
-			pnode->isroot = 0;
-		if (color >= 0)
-			pnode->icolor = color;
-		pnode = pnode->next;
+	sccnode = malloc((pscc->sccno + 1) * sizeof(unsigned));
+	pcalls = malloc((ptrav->outno + 1) * sizeof(*pcalls));
+	if (!sccnode || !pcalls) {
+		printf("\nMemory allocation error\n");
+		free(sccnode);
+		free(pcalls);
+		return -1;
+	}
+	memset(sccnode, 0xff, pscc->sccno * sizeof(unsigned));
+
+	for (i = 0; i < ptrav->outno; i++) {
+		id = ptrav->outlist[i] >> 1;
+		if (ptrav->outlist[i] & TTREETRAV_BRANCH) {
+			pbranch = ptree->branches[id];
+			cu = pscc->nodescc[pbranch->parent.node->id];
+			cv = pscc->nodescc[pbranch->child.node->id];
+			if (cu == cv && ttreesccrecursive(pscc, cu))
+				bitsetset(pskip, i);
+			else if (ttreesccrecursive(pscc, cu) ||
+				 ttreesccrecursive(pscc, cv)) {
+				pcalls[callno].groups = (uint64_t)cu << 32 | cv;
+				pcalls[callno++].pos = i;
+			}
+			continue;
+		}
+
+		cu = pscc->nodescc[id];
+		if (!ttreesccrecursive(pscc, cu))
+			continue;
+		if (sccnode[cu] == UINT_MAX)
+			sccnode[cu] = id;
+		else {
+			bitsetset(pskip, i);
+			if (ptrav->nodecolor[sccnode[cu]] == 0)
+				ptrav->nodecolor[sccnode[cu]] =
+				    ptrav->nodecolor[id];
+		}
+	}
+
+	qsort(pcalls, callno, sizeof(*pcalls), outcallorder);
+	for (i = 0; i < callno; i = j) {
+		id = ptrav->outlist[pcalls[i].pos] >> 1;
+		for (j = i + 1;
+		     j < callno && pcalls[j].groups == pcalls[i].groups; j++) {
+			bitsetset(pskip, pcalls[j].pos);
+			if (ptrav->branchcolor[id] == 0)
+				ptrav->branchcolor[id] =
+				    ptrav->branchcolor[ptrav->outlist[pcalls[j].pos] >> 1];
+		}
 	}
 
-	pbranch = ptree->firstbranch;
-	while (pbranch != NULL) {
-		pbranch->outdone = 0;
-		if (color >= 0)
-			pbranch->icolor = color;
-		pbranch = pbranch->next;
+	free(sccnode);
+	free(pcalls);
+
+	return 0;
+}
+
+// monotonic clock in milliseconds, for the verbose timing breakdown
+static double outtreeclock(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// communities of the functions of the tree, found on its calls only
+static ttreecomm_t *outcommunities(const ttreetrav_t *ptrav,
+				   treeparam_t *pparam)
+{
+	ttreecomm_t *pcomm = NULL;
+	unsigned *pnodes, *pbranches;
+	unsigned i, nodeno = 0, branchno = 0;
+
+	pnodes = malloc((ptrav->outno + 1) * sizeof(unsigned));
+	pbranches = malloc((ptrav->outno + 1) * sizeof(unsigned));
+	if (!pnodes || !pbranches) {
+		printf("\nMemory allocation error\n");
+	} else {
+		for (i = 0; i < ptrav->outno; i++)
+			if (ptrav->outlist[i] & TTREETRAV_BRANCH)
+				pbranches[branchno++] = ptrav->outlist[i] >> 1;
+			else
+				pnodes[nodeno++] = ptrav->outlist[i] >> 1;
+		pcomm = ttreecommbuild(ptrav->ptree, pnodes, nodeno, pbranches,
+				       branchno, pparam->clusterno);
+		if (pcomm && pparam->verbose)
+			printf("\n%u communities of %u functions, modularity "
+			       "%.3f\n",
+			       pcomm->commno, nodeno, pcomm->modularity);
 	}
+
+	free(pnodes);
+	free(pbranches);
+
+	return pcomm;
 }
 
-// make tree output
-int outtree(ttree_t *ptree, treeparam_t *pparam)
+// make tree output; the tree is only read, so several outputs can be made
+// from the same frozen tree at the same time, each with its own parameters
+int outtree(const ttree_t *ptree, treeparam_t *pparam)
 {
 	int iErr = 0, iErrC;
+	ttreetrav_t *ptrav;
+	ttreescc_t *pscc = NULL;
+	ttreemetric_t *pmetric = NULL;
+	ttreecomm_t *pcomm = NULL;
+	ttreesize_t *psize = NULL;
+	bitset_t *pskip = NULL;
 	ttreenode_t *pnode;
-	int i = 0;
+	unsigned r, i, id;
+	double tstart, tscan = 0, tpath = 0, tout = 0;
 
 	if (pparam->verbose)
 		printf("\nMaking output... ");
 
-	// start output
-	iErr = outopen(ptree, pparam);
-	if (iErr == 0) {
-		// init, color = 0, reset root flags
-		outtreeinit(ptree, 0, 1);
-
-		// find all roots and set corresponding isroot flag
-		for (i = 0; i < pparam->rootno; i++) {
-			pnode = ptree->firstnode;
-			while (pnode != NULL) {
-				if (strcmp(pnode->funname, pparam->root[i]) ==
-				    0) {
-					pnode->isroot = 1;
-					// break; break missing because the same
-					// function can have multiple
-					// definitions in different files
-				}
-
-				pnode = pnode->next;
-			}
-		}
-
-		// mark all nodes found scanning the tree starting from the
-		// specified root
-		// functions
-		pnode = ptree->firstnode;
-		while (iErr == 0 && pnode != NULL) {
-			if (pnode->isroot) {
-				// init, don't set color, don't reset isroot
-				// flags
-				outtreeinit(ptree, -1, 0);
-				iErr = outsubtree(ptree, pparam, pnode,
-						  pparam->fdepth,
-						  pparam->bdepth, ROOTMARK);
-			}
+	// a new context has no done marks, no roots and default colors
+	ptrav = ttreetravinit(ptree);
+	if (!ptrav)
+		return -1;
 
-			pnode = pnode->next;
+	iErr = outtreeresolve(ptrav, pparam);
+
+	// find the nodes and branches of the tree
+	tstart = outtreeclock();
+	if (iErr == 0 && (pparam->fdepth >= 0 || pparam->bdepth > 0 ||
+			  (pparam->threadno > 0 && pparam->bdepth == 0))) {
+		// depth limited or on threads: callees, then callers of the
+		// roots
+		iErr = outdepth(ptrav, NULL, 1, pparam->fdepth,
+				pparam->threadno);
+		if (iErr == 0 && pparam->bdepth != 0)
+			iErr = outdepth(ptrav, NULL, 0, pparam->bdepth,
+					pparam->threadno);
+	} else if (iErr == 0 && pparam->threadno > 0) {
+		// -c max -C max on threads: callees, then callers of each root
+		// in turn, stopping at the subtrees done, as outsubtree() does
+		for (r = 0; iErr == 0 && r < ptrav->roots.nodeno; r++) {
+			pnode = ptrav->roots.nodes[r];
+			if (bitsettest(ptrav->subtreeout, pnode->id) ||
+			    ttreesetisin(&ptrav->excluded, pnode->id))
+				continue;
+			iErr = outdepth(ptrav, pnode, 1, -1, pparam->threadno);
+			if (iErr == 0)
+				iErr = outdepth(ptrav, pnode, 0, -1,
+						pparam->threadno);
 		}
+	} else {
+		for (r = 0; iErr == 0 && r < ptrav->roots.nodeno; r++)
+			iErr = outsubtree(ptrav, ptrav->roots.nodes[r],
+					  pparam->fdepth, pparam->bdepth);
+	}
+	tscan = outtreeclock() - tstart;
+
+	// color the highlighted call paths
+	tstart = outtreeclock();
+	if (iErr == 0)
+		iErr = outhighlight(ptrav, pparam);
+	tpath = outtreeclock() - tstart;
+
+	// show the recursive groups as such, see outgraphviz.c
+	if (iErr == 0 && pparam->condense != TREECONDENSE_NONE) {
+		pscc = ttreesccbuild(ptree, NULL);
+		ptrav->pscc = pscc;
+		pskip = bitsetalloc(ptrav->outno);
+		if (!pskip)
+			printf("\nMemory allocation error\n");
+		if (!pscc || !pskip)
+			iErr = -1;
+		else if (pparam->condense == TREECONDENSE_NODE)
+			iErr = outcondense(ptrav, pskip);
+	}
 
-		if (pparam->callp) {
-			// if an highlight path has been specified
-			pnode = ptree->firstnode;
-			while (iErr == 0 && pnode != NULL) {
-				if (strcmp(pnode->funname, pparam->callp) ==
-				    0) {
-					// found the last function of path
-					// init, don't set color, don't reset
-					// isroot flags
-					outtreeinit(ptree, -1, 0);
-					// bdepth and fdepth are inverted on
-					// purpose, because we are scanning
-					// toward roots
-					// in the opposite direction
-					// last parameter = 1 because we are
-					// coloring the path
-					iErr = outsubtree(ptree, pparam, pnode,
-							  pparam->bdepth,
-							  pparam->fdepth, 1);
-					// break; break missing because the same
-					// function can have multiple
-					// defintions in different files
-				}
-
-				pnode = pnode->next;
-			}
-		}
+	// metrics as node attributes, see outgraphviz.c
+	if (iErr == 0 && pparam->mode == TREEMODE_METRICS) {
+		pmetric = ttreemetricbuild(ptree, &ptrav->roots,
+					   &ptrav->excluded);
+		ptrav->pmetric = pmetric;
+		if (!pmetric)
+			iErr = -1;
+	}
 
-		// init, don't set color, don't reset isroot flags
-		outtreeinit(ptree, -1, 0);
+	// communities as clusters, see outgraphviz.c
+	if (iErr == 0 && pparam->autoclusters) {
+		pcomm = outcommunities(ptrav, pparam);
+		ptrav->pcomm = pcomm;
+		if (!pcomm)
+			iErr = -1;
+	}
 
+	// code sizes as node labels, see outgraphviz.c
+	if (iErr == 0 && pparam->mode == TREEMODE_SIZES) {
+		psize = outsizeload(ptrav, pparam);
+		ptrav->psize = psize;
+		if (!psize)
+			iErr = -1;
+	}
+
+	// start output
+	if (iErr == 0)
+		iErr = outopen(ptrav, pparam);
+	if (iErr == 0) {
 		// this is the actual output production
-		pnode = ptree->firstnode;
-		while (iErr == 0 && pnode != NULL) {
-			// find all roots and start scanning from those nodes
-			if (pnode->isroot)
-				iErr = outsubtree(ptree, pparam, pnode,
-						  pparam->fdepth,
-						  pparam->bdepth, -1);
-
-			pnode = pnode->next;
+		tstart = outtreeclock();
+		for (i = 0; iErr == 0 && i < ptrav->outno; i++) {
+			if (pskip && bitsettest(pskip, i))
+				continue;
+			id = ptrav->outlist[i] >> 1;
+			if (ptrav->outlist[i] & TTREETRAV_BRANCH)
+				iErr = outbranch(ptrav, ptree->branches[id],
+						 pparam);
+			else
+				iErr = outnode(ptrav, ptree->nodes[id], pparam);
 		}
+		tout = outtreeclock() - tstart;
 
 		// terminate the tree output
-		iErrC = outclose(ptree, pparam);
+		iErrC = outclose(ptrav, pparam);
 		if (iErr == 0)
 			iErr = iErrC;
 	}
 
-	if (pparam->verbose)
+	free(pskip);
+	ttreesccfree(pscc);
+	ttreemetricfree(pmetric);
+	ttreecommfree(pcomm);
+	ttreesizefree(psize);
+	ttreetravfree(ptrav);
+
+	if (pparam->verbose) {
 		printf("done\n");
+		printf("Timing: scan %.3f ms, path %.3f ms, output %.3f ms\n",
+		       tscan, tpath, tout);
+	}
 
 	return iErr;
 }
@@ -29,8 +29,12 @@
 #ifndef _ALL_IN_ONE
 #include "ttree.h"
 #include "ttreeparam.h"
+#include "ttreetrav.h"
 #endif // _ALL_IN_ONE
 
-int outtree(ttree_t *ptree, treeparam_t *pparam);
+int outopen(ttreetrav_t *ptrav, treeparam_t *pparam);
+int outclose(ttreetrav_t *ptrav, treeparam_t *pparam);
+int outtreeresolve(ttreetrav_t *ptrav, treeparam_t *pparam);
+int outtree(const ttree_t *ptree, treeparam_t *pparam);
 
 #endif // #ifndef _OUTTREE_H
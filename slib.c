@@ -78,7 +78,64 @@ int slibbasename(char **sbase, char *spath, int withext)
 			*dot = '\0';
 	}
 
-	*sbase = bname;
+	// basename() may point anywhere inside bpath, so copy its result
+	*sbase = strdup(bname);
+	free(bpath);
 
-	return 0;
+	return *sbase ? 0 : -1;
+}
+
+// print a string as a JSON string literal, with quotes and escapes
+void slibjsonstr(FILE *pfile, const char *s)
+{
+	fputc('"', pfile);
+	for (; *s; s++) {
+		if (*s == '"' || *s == '\\')
+			fprintf(pfile, "\\%c", *s);
+		else if ((unsigned char)*s < 0x20)
+			fprintf(pfile, "\\u%04x", *s);
+		else
+			fputc(*s, pfile);
+	}
+	fputc('"', pfile);
+}
+
+// print a string as a CSV field, quoted only if needed
+void slibcsvstr(FILE *pfile, const char *s)
+{
+	if (strpbrk(s, ",\"\r\n") == NULL) {
+		fputs(s, pfile);
+		return;
+	}
+
+	fputc('"', pfile);
+	for (; *s; s++) {
+		if (*s == '"')
+			fputc('"', pfile);
+		fputc(*s, pfile);
+	}
+	fputc('"', pfile);
+}
+
+// 1 if two paths name the same file, one maybe given from a parent directory
+// of the other
+int slibpathmatch(const char *sfile, const char *spath)
+{
+	size_t lfile, lpath;
+
+	while (strncmp(sfile, "./", 2) == 0)
+		sfile += 2;
+	while (strncmp(spath, "./", 2) == 0)
+		spath += 2;
+	lfile = strlen(sfile);
+	lpath = strlen(spath);
+
+	if (lfile > lpath)
+		return sfile[lfile - lpath - 1] == '/' &&
+		       strcmp(&sfile[lfile - lpath], spath) == 0;
+	if (lpath > lfile)
+		return spath[lpath - lfile - 1] == '/' &&
+		       strcmp(&spath[lpath - lfile], sfile) == 0;
+
+	return strcmp(sfile, spath) == 0;
 }
@@ -26,7 +26,12 @@
 #ifndef _SLIB_H
 #define _SLIB_H
 
+#include <stdio.h>
+
 int slibcpy(char **sout, char const *sin, int errval);
 int slibbasename(char **sbase, char *spath, int withext);
+void slibjsonstr(FILE *pfile, const char *s);
+void slibcsvstr(FILE *pfile, const char *s);
+int slibpathmatch(const char *sfile, const char *spath);
 
 #endif // #ifndef _SLIB_H
@@ -30,6 +30,19 @@
 #ifndef _ALL_IN_ONE
 #include "defines.h"
 #include "gettree.h"
+#include "outbetw.h"
+#include "outdead.h"
+#include "outdiff.h"
+#include "outdom.h"
+#include "outimpact.h"
+#include "outmatrix.h"
+#include "outmetric.h"
+#include "outpath.h"
+#include "outprofile.h"
+#include "outreach.h"
+#include "outscc.h"
+#include "outsize.h"
+#include "outstack.h"
 #include "outtree.h"
 #include "slib.h"
 #include "ttree.h"
@@ -42,16 +55,63 @@ const char sdefaultoutfile[] = "tceetree.out"; // default output file
 // setting of string parameters
 int paramstr(char **sout, char const *sin) { return slibcpy(sout, sin, -3); }
 
-// setting of string array parameters
-int paramstrarr(char **sout, int *outidx, int maxnum, char const *sin,
-		char const *errmsg)
+// setting of string list parameters, with no limit on their number
+int paramstrlist(char ***sout, int *outidx, char const *sin)
 {
-	if (*outidx >= maxnum) {
-		printf(errmsg, maxnum);
+	char **plist;
+
+	plist = realloc(*sout, (*outidx + 1) * sizeof(*plist));
+	if (!plist) {
+		printf("\nMemory allocation error\n");
+		return -3;
+	}
+	*sout = plist;
+
+	plist[*outidx] = NULL;
+	return slibcpy(&plist[(*outidx)++], sin, -3);
+}
+
+// setting of integer list parameters, with no limit on their number
+int paramintlist(int **iout, int *outidx, int val)
+{
+	int *plist;
+
+	plist = realloc(*iout, (*outidx + 1) * sizeof(*plist));
+	if (!plist) {
+		printf("\nMemory allocation error\n");
 		return -3;
 	}
+	*iout = plist;
 
-	return slibcpy(&sout[(*outidx)++], sin, -3);
+	plist[(*outidx)++] = val;
+	return 0;
+}
+
+// setting of string list parameters from a file, one per line; empty lines
+// and lines starting with # are skipped
+int paramstrfile(char ***sout, int *outidx, char const *filename)
+{
+	FILE *pfile;
+	char sline[1024];
+	size_t len;
+	int iErr = 0;
+
+	pfile = fopen(filename, "r");
+	if (!pfile) {
+		printf("\nCannot open file %s\n", filename);
+		return -3;
+	}
+
+	while (iErr == 0 && fgets(sline, sizeof(sline), pfile)) {
+		len = strcspn(sline, "\r\n");
+		sline[len] = '\0';
+		if (len > 0 && sline[0] != '#')
+			iErr = paramstrlist(sout, outidx, sline);
+	}
+
+	fclose(pfile);
+
+	return iErr;
 }
 
 // setting of default parameters
@@ -67,6 +127,35 @@ void paramdefault(treeparam_t *ptreeparam)
 	paramstr(&ptreeparam->shortdbfile, ""); // default shortened output file
 	ptreeparam->outtype =
 	    TREEOUT_GRAPHVIZ; // default is output for graphviz
+	ptreeparam->topno = 10; // default functions in each metrics table
+	ptreeparam->betwsamples = 256; // default sources of the betweenness
+	ptreeparam->profpct = 1; // default percent of the samples of hot calls
+}
+
+// split the percent of the hot calls from the end of the profile file name,
+// if given as <file>:<percent>
+int paramprofpct(treeparam_t *ptreeparam)
+{
+	char *scolon = strrchr(ptreeparam->proffile, ':');
+	char *send;
+	double pct;
+
+	ptreeparam->profpct = 1;
+	if (!scolon)
+		return 0;
+
+	pct = strtod(scolon + 1, &send);
+	if (send == scolon + 1 || *send != '\0')
+		return 0; // a colon of the file name
+	if (pct < 0 || pct > 100) {
+		printf("\nThe percent of the hot calls must be between 0 and "
+		       "100\n");
+		return -3;
+	}
+	ptreeparam->profpct = pct;
+	*scolon = '\0';
+
+	return 0;
 }
 
 // parameter cross checks
@@ -85,6 +174,14 @@ int paramcrosscheck(treeparam_t *ptreeparam)
 		return -1;
 	}
 
+	if (ptreeparam->difffile &&
+	    (strcmp(ptreeparam->difffile, ptreeparam->outfile) == 0 ||
+	     strcmp(ptreeparam->difffile, ptreeparam->shortdbfile) == 0)) {
+		printf("\nThe database compared cannot be the same as an output "
+		       "file\n");
+		return -1;
+	}
+
 	if (strcmp(ptreeparam->outfile, ptreeparam->shortdbfile) == 0) {
 		printf("\nThe output file cannot be the same as the shortened "
 		       "cscope "
@@ -92,6 +189,114 @@ int paramcrosscheck(treeparam_t *ptreeparam)
 		return -1;
 	}
 
+	if (ptreeparam->mode == TREEMODE_TREE &&
+	    ptreeparam->outtype != TREEOUT_GRAPHVIZ) {
+		printf("\nThe call tree can only be output in dot format\n");
+		return -1;
+	}
+
+	if (ptreeparam->outtype == TREEOUT_CSV &&
+	    ptreeparam->mode != TREEMODE_METRICS &&
+	    ptreeparam->mode != TREEMODE_DEAD &&
+	    ptreeparam->mode != TREEMODE_MATRIX &&
+	    ptreeparam->mode != TREEMODE_BETWEENNESS &&
+	    ptreeparam->mode != TREEMODE_DIFF &&
+	    ptreeparam->mode != TREEMODE_IMPACT &&
+	    ptreeparam->mode != TREEMODE_STACK &&
+	    ptreeparam->mode != TREEMODE_SIZES) {
+		printf("\nOnly metrics, dead functions, the reachability "
+		       "matrix, the\nbetweenness, the diff, the impact, the "
+		       "stack usage and the code sizes\ncan be output in csv "
+		       "format\n");
+		return -1;
+	}
+
+	if (ptreeparam->outtype == TREEOUT_BINARY &&
+	    ptreeparam->mode != TREEMODE_MATRIX) {
+		printf("\nOnly the reachability matrix can be output in bin "
+		       "format\n");
+		return -1;
+	}
+
+	if (ptreeparam->mode == TREEMODE_MATRIX &&
+	    ptreeparam->outtype == TREEOUT_GRAPHVIZ) {
+		printf("\nThe reachability matrix can only be output in text, "
+		       "json, csv or\nbin format\n");
+		return -1;
+	}
+
+	if (ptreeparam->mode == TREEMODE_BETWEENNESS &&
+	    ptreeparam->outtype == TREEOUT_GRAPHVIZ) {
+		printf("\nThe betweenness can only be output in text, json or "
+		       "csv format\n");
+		return -1;
+	}
+
+	if (ptreeparam->mode == TREEMODE_IMPACT &&
+	    ptreeparam->outtype == TREEOUT_GRAPHVIZ) {
+		printf("\nThe impact can only be output in text, json or csv "
+		       "format\n");
+		return -1;
+	}
+
+	if (ptreeparam->mode == TREEMODE_STACK &&
+	    ptreeparam->outtype == TREEOUT_GRAPHVIZ) {
+		printf("\nThe stack usage can only be output in text, json or "
+		       "csv format\n");
+		return -1;
+	}
+
+	if (ptreeparam->mode == TREEMODE_PROFILE &&
+	    ptreeparam->outtype != TREEOUT_GRAPHVIZ) {
+		printf("\nThe hot call graph can only be output in dot format\n");
+		return -1;
+	}
+
+	if (ptreeparam->mode == TREEMODE_REACH &&
+	    ptreeparam->outtype == TREEOUT_GRAPHVIZ) {
+		printf("\nReachability answers can only be output in text or "
+		       "json format\n");
+		return -1;
+	}
+
+	if (ptreeparam->mode == TREEMODE_PATHS && ptreeparam->callpno == 0) {
+		printf("\nCall paths need at least one -p function where they "
+		       "end\n");
+		return -1;
+	}
+
+	if ((ptreeparam->doclusters || ptreeparam->autoclusters) &&
+	    (ptreeparam->condense != TREECONDENSE_NONE ||
+	     ptreeparam->mode == TREEMODE_RECURSION)) {
+		printf("\nClusters (-F, --cluster) cannot be combined with "
+		       "recursive groups\n");
+		return -1;
+	}
+
+	if (ptreeparam->autoclusters &&
+	    ((ptreeparam->mode != TREEMODE_TREE &&
+	      ptreeparam->mode != TREEMODE_METRICS &&
+	      ptreeparam->mode != TREEMODE_SIZES) ||
+	     ptreeparam->outtype != TREEOUT_GRAPHVIZ)) {
+		printf("\nAutomatic clusters only apply to the call tree\n");
+		return -1;
+	}
+
+	if (ptreeparam->threadno > 0 && ptreeparam->mode != TREEMODE_TREE &&
+	    ptreeparam->mode != TREEMODE_METRICS &&
+	    ptreeparam->mode != TREEMODE_SIZES &&
+	    ptreeparam->mode != TREEMODE_BETWEENNESS) {
+		printf("\nThreads (-j) only apply to the scan of the call "
+		       "tree and to the\nbetweenness\n");
+		return -1;
+	}
+
+	if (ptreeparam->condense != TREECONDENSE_NONE &&
+	    ptreeparam->mode != TREEMODE_TREE) {
+		printf("\nOnly the call tree can be condensed\n");
+		return -1;
+	}
+
 	return 0;
 }
 
@@ -103,12 +308,24 @@ void paramfree(treeparam_t *ptreeparam)
 	free(ptreeparam->infile);
 	free(ptreeparam->outfile);
 	free(ptreeparam->shortdbfile);
+	free(ptreeparam->reachfile);
+	free(ptreeparam->domsel);
+	free(ptreeparam->difffile);
+	free(ptreeparam->impactfile);
+	free(ptreeparam->stackfile);
+	free(ptreeparam->sizefile);
+	free(ptreeparam->proffile);
+	for (i = 0; i < ptreeparam->callpno; i++)
+		free(ptreeparam->callp[i]);
 	free(ptreeparam->callp);
+	free(ptreeparam->hlstyle);
 
 	for (i = 0; i < ptreeparam->rootno; i++)
 		free(ptreeparam->root[i]);
+	free(ptreeparam->root);
 	for (i = 0; i < ptreeparam->excludfno; i++)
 		free(ptreeparam->excludf[i]);
+	free(ptreeparam->excludf);
 }
 
 // print usage help
@@ -117,9 +334,21 @@ void usage(void)
 	printf("\n");
 	printf("Usage: tceetree [-c <depth>] [-C <depth>] [-d <file>] [-f] "
 	       "[-F] [-h]\n"
-	       "                [-i <file>] [-o <file>] [-p <function>] [-r "
-	       "<root>]\n"
-	       "                [-s <style>] [-v] [-V] [-x <function>]\n\n");
+	       "                [-i <file>] [-j <threads>] [-o <file>] [-p "
+	       "<function>]\n"
+	       "                [-r <root>] [-s <style>] [-v] [-V] [-x "
+	       "<function>]\n"
+	       "                [--paths=<query>] [--format=<format>] "
+	       "[--recursion]\n"
+	       "                [--condense=<how>] [--reach=<file>]\n"
+	       "                [--dominators[=<function>]] "
+	       "[--metrics[=<n>]]\n"
+	       "                [--dead] [--matrix] "
+	       "[--betweenness[=<samples>[:<n>]]]\n"
+	       "                [--cluster=<how>] [--diff=<file>] "
+	       "[--impact=<file>]\n"
+	       "                [--stack=<file>] [--sizes=<file>]\n"
+	       "                [--profile=<file>[:<percent>]]\n\n");
 	printf("-c <depth>    Depth of tree for called functions: default is "
 	       "max.\n");
 	printf("-C <depth>    Depth of tree for calling functions: default is "
@@ -140,46 +369,245 @@ void usage(void)
 	printf("-h            Print this help.\n");
 	printf(
 	    "-i <file>     Input cscope output file: default is cscope.out.\n");
+	printf("-j <threads>  Scan the tree breadth first on threads, as with "
+	       "depth limits:\n"
+	       "              the output is the same for any number of "
+	       "threads.\n");
 	printf("-o <file>     Output file for graphviz: default is %s.\n",
 	       sdefaultoutfile);
-	printf("-p <function> Highlight call path till function.\n");
+	printf("-p <function> Highlight call path till function. This option "
+	       "may occur\n"
+	       "              more than once for multiple call paths.\n");
 	printf(
 	    "-r <root>     Root function of tree: default is main. This option "
 	    "may occur\n"
-	    "              more than once for multiple roots (max %d).\n",
-	    TT_MAXROOTS);
+	    "              more than once for multiple roots.\n"
+	    "              -r @<file> adds the roots listed in file, one per "
+	    "line.\n");
 	printf("-s <style>    Style for highlight call path:\n"
 	       "              - 0 = red color (default);\n"
 	       "              - 1 = blue color;\n"
 	       "              - 2 = green color;\n"
 	       "              - 3 = bold;\n"
 	       "              - 4 = dashed;\n"
-	       "              - 5 = dotted.\n");
+	       "              - 5 = dotted.\n"
+	       "              The n-th -s applies to the n-th -p; call paths "
+	       "with no -s\n"
+	       "              use the style following the previous one.\n");
 	printf("-v            Print version.\n");
 	printf("-V            Verbose output.\n");
 	printf(
 	    "-x <function> Function to be excluded from tree. This option may "
 	    "occur more\n"
-	    "              than once for multiple functions (max %d).\n"
+	    "              than once for multiple functions.\n"
 	    "              -x %s is a special case for excluding all library\n"
-	    "              functions, i.e. not found defined in any file.\n",
-	    TT_MAXEXCLUDF, TT_LIBRARY);
+	    "              functions, i.e. not found defined in any file.\n"
+	    "              -x @<file> excludes the functions listed in file, one "
+	    "per line.\n",
+	    TT_LIBRARY);
+	printf("--paths=<query>\n"
+	       "              Output the call paths from the root(s) to the -p "
+	       "functions:\n"
+	       "              - shortest = one shortest path;\n"
+	       "              - kshortest:<k> = the k shortest paths;\n"
+	       "              - all:<maxlen> = all paths up to maxlen calls.\n"
+	       "              Paths repeat no function and end at the first -p "
+	       "function.\n");
+	printf("--format=<format>\n"
+	       "              Output format of --paths, --recursion, --reach "
+	       "and\n"
+	       "              --dominators: dot (default), text or json; "
+	       "csv for\n"
+	       "              --metrics, --dead, --matrix, --betweenness, "
+	       "--diff,\n"
+	       "              --impact, --stack and --sizes only, bin for "
+	       "--matrix only.\n");
+	printf("--recursion   Output the groups of functions calling each "
+	       "other instead of\n"
+	       "              the tree.\n");
+	printf("--condense=<how>\n"
+	       "              Show each recursive group of the tree as a "
+	       "cluster or as\n"
+	       "              a node: <how> is cluster or node.\n");
+	printf("--reach=<file>\n"
+	       "              Answer the queries of file (- = standard input), "
+	       "one per\n"
+	       "              line: <from> <to>, does from call to, directly "
+	       "or not?\n");
+	printf("--dominators[=<function>]\n"
+	       "              Output the dominator tree from the root(s), or the "
+	       "chain of\n"
+	       "              immediate dominators of function.\n");
+	printf("--metrics[=<n>]\n"
+	       "              Output fan-in, fan-out, callee files, depth "
+	       "and estimated\n"
+	       "              transitive callees and callers of every "
+	       "function: top <n>\n"
+	       "              (default 10) tables in text, all the functions "
+	       "in csv or json,\n"
+	       "              node attributes of the tree in dot.\n");
+	printf("--dead        Output the functions defined but not reached "
+	       "from the root(s),\n"
+	       "              grouped by file.\n");
+	printf("--matrix      Output which root(s) reach each -p function, or "
+	       "each function\n"
+	       "              if there is no -p: text, json, csv with a column "
+	       "per root or\n"
+	       "              bin with a bit per root.\n");
+	printf("--cluster=<how>\n"
+	       "              Group the functions of the tree into clusters: "
+	       "<how> is file\n"
+	       "              (as -F) or auto[:<n>], communities of functions "
+	       "calling each\n"
+	       "              other more than the rest, at most <n> if "
+	       "given.\n");
+	printf("--diff=<file> Output the functions and calls added and "
+	       "removed since the\n"
+	       "              cscope output file given, the old one: dot "
+	       "(added green,\n"
+	       "              removed red), text, json or csv.\n");
+	printf("--impact=<file>\n"
+	       "              Output the functions whose definition overlaps "
+	       "the changed lines\n"
+	       "              of file (- = stdin), a unified diff or "
+	       "<file>:<first>[-<last>]\n"
+	       "              lines, their callers and the root(s) they "
+	       "reach: text, json or\n"
+	       "              csv.\n");
+	printf("--stack=<file> Output the worst case stack usage from each "
+	       "root and the call\n"
+	       "              chain giving it, from the .su files of gcc "
+	       "-fstack-usage\n"
+	       "              concatenated in file (- = stdin): text, json "
+	       "or csv.\n");
+	printf("--sizes=<file> Output the bytes of code reached from each "
+	       "root, in total and\n"
+	       "              from no other root, from the nm -S output in "
+	       "file (- = stdin):\n"
+	       "              text, json or csv; in dot, the tree with the "
+	       "size of each\n"
+	       "              function in its label.\n");
+	printf("--profile=<file>[:<percent>]\n"
+	       "              Output the calls and functions with at least "
+	       "<percent> (default\n"
+	       "              1) of the samples of the folded stacks in file "
+	       "(- = stdin),\n"
+	       "              as given by stackcollapse-perf.pl: dot only, "
+	       "with the samples\n"
+	       "              in the labels and hotter calls wider and "
+	       "redder.\n");
+	printf("--betweenness[=<samples>[:<n>]]\n"
+	       "              Output the functions on the most shortest call "
+	       "chains, estimated\n"
+	       "              from <samples> (default 256, 0 = all) functions: "
+	       "top <n> (default\n"
+	       "              10) in text, all the functions in csv or json. "
+	       "-j sets the\n"
+	       "              threads.\n");
+	printf("\n<root>, <function> can be a function name, a glob pattern such "
+	       "as\n"
+	       "drv_foo_* or a file scoped fileglob:glob pattern such as\n"
+	       "net/ipv4/*.c: for all the functions defined in those files.\n");
+}
+
+// long options are decoded as the short ones, with codes above the char range;
+// their value follows = or is the next parameter
+enum {
+	OPT_PATHS = 256, // --paths
+	OPT_FORMAT,	 // --format
+	OPT_RECURSION,	 // --recursion
+	OPT_CONDENSE,	 // --condense
+	OPT_REACH,	 // --reach
+	OPT_DOMINATORS,	 // --dominators
+	OPT_METRICS,	 // --metrics
+	OPT_DEAD,	 // --dead
+	OPT_MATRIX,	 // --matrix
+	OPT_BETWEENNESS, // --betweenness
+	OPT_CLUSTER,	 // --cluster
+	OPT_DIFF,	 // --diff
+	OPT_IMPACT,	 // --impact
+	OPT_STACK,	 // --stack
+	OPT_SIZES,	 // --sizes
+	OPT_PROFILE,	 // --profile
+};
+
+typedef struct longopt_st {
+	const char *name;
+	int opt;
+} longopt_t;
+
+static const longopt_t longopts[] = {
+    {"paths", OPT_PATHS},
+    {"format", OPT_FORMAT},
+    {"recursion", OPT_RECURSION},
+    {"condense", OPT_CONDENSE},
+    {"reach", OPT_REACH},
+    {"dominators", OPT_DOMINATORS},
+    {"metrics", OPT_METRICS},
+    {"dead", OPT_DEAD},
+    {"matrix", OPT_MATRIX},
+    {"betweenness", OPT_BETWEENNESS},
+    {"cluster", OPT_CLUSTER},
+    {"diff", OPT_DIFF},
+    {"impact", OPT_IMPACT},
+    {"stack", OPT_STACK},
+    {"sizes", OPT_SIZES},
+    {"profile", OPT_PROFILE},
+    {NULL, 0},
+};
+
+// find a long option by name, returning the value after = in *pval (NULL if
+// none)
+static const longopt_t *usage_longopt(char const *sopt, char const **pval)
+{
+	const longopt_t *plong;
+	size_t len;
+
+	*pval = strchr(sopt, '=');
+	len = *pval ? (size_t)(*pval - sopt) : strlen(sopt);
+	if (*pval)
+		(*pval)++;
+
+	for (plong = longopts; plong->name; plong++)
+		if (strlen(plong->name) == len &&
+		    strncmp(plong->name, sopt, len) == 0)
+			return plong;
+
+	return NULL;
 }
 
 // decoding of inline parameters
 int usage_opt(char const *sopt, treeparam_t *ptreeparam)
 {
-	static char curopt =
+	static int curopt =
 	    0; // holds option currently being parsed (e.g. 'd')
 	int iErr = 0;
 	int isoptval; // = 1 when decoding value of option
+	int hlstyle;
+	int valno; // values decoded from an option with more than one
+	const longopt_t *plong;
+	char const *sval;
 
-	if (curopt == 0 && (sopt[0] != '-' || strlen(sopt) != 2))
+	if (curopt == 0 && strncmp(sopt, "--", 2) == 0) {
+		// long option, with its value if given after =
+		plong = usage_longopt(sopt + 2, &sval);
+		if (!plong)
+			iErr = -1;
+		else {
+			curopt = plong->opt;
+			isoptval = (sval != NULL);
+			if (isoptval)
+				sopt = sval;
+		}
+	} else if (curopt == 0 && (sopt[0] != '-' || strlen(sopt) != 2))
 		iErr = -1;
 	else {
 		isoptval = (curopt != 0);
 		if (!isoptval)
 			curopt = sopt[1];
+	}
+
+	if (iErr == 0) {
 		switch (curopt) {
 		case 'c':
 			if (isoptval) {
@@ -225,6 +653,7 @@ int usage_opt(char const *sopt, treeparam_t *ptreeparam)
 
 		case 'F':
 			ptreeparam->doclusters = 1;
+			ptreeparam->autoclusters = 0;
 			curopt = 0;
 			break;
 
@@ -241,6 +670,19 @@ int usage_opt(char const *sopt, treeparam_t *ptreeparam)
 			}
 			break;
 
+		case 'j':
+			if (isoptval) {
+				if (sscanf(sopt, "%d", &ptreeparam->threadno) !=
+					1 ||
+				    ptreeparam->threadno <= 0) {
+					printf("\nThreads must be a number > "
+					       "0\n");
+					iErr = -3;
+				}
+				curopt = 0;
+			}
+			break;
+
 		case 'o':
 			if (isoptval) {
 				iErr = paramstr(&ptreeparam->outfile, sopt);
@@ -250,33 +692,38 @@ int usage_opt(char const *sopt, treeparam_t *ptreeparam)
 
 		case 'p':
 			if (isoptval) {
-				iErr = paramstr(&ptreeparam->callp, sopt);
+				iErr = paramstrlist(&ptreeparam->callp,
+						    &ptreeparam->callpno, sopt);
 				curopt = 0;
 			}
 			break;
 
 		case 'r':
 			if (isoptval) {
-				iErr = paramstrarr(ptreeparam->root,
-						   &ptreeparam->rootno,
-						   TT_MAXROOTS, sopt,
-						   "\nThe maximum number of "
-						   "root functions is %d\n");
+				if (sopt[0] == '@')
+					iErr = paramstrfile(&ptreeparam->root,
+							    &ptreeparam->rootno,
+							    sopt + 1);
+				else
+					iErr = paramstrlist(&ptreeparam->root,
+							    &ptreeparam->rootno,
+							    sopt);
 				curopt = 0;
 			}
 			break;
 
 		case 's':
 			if (isoptval) {
-				if (sscanf(sopt, "%d", &ptreeparam->hlstyle) !=
-					1 ||
-				    ptreeparam->hlstyle < 0 ||
-				    ptreeparam->hlstyle >= TT_MAXSTYLES) {
+				if (sscanf(sopt, "%d", &hlstyle) != 1 ||
+				    hlstyle < 0 || hlstyle >= TT_MAXSTYLES) {
 					printf("\nHighlight style must be a "
 					       "number >= 0 and < %d\n",
 					       TT_MAXSTYLES);
 					iErr = -3;
-				}
+				} else
+					iErr = paramintlist(
+					    &ptreeparam->hlstyle,
+					    &ptreeparam->hlstyleno, hlstyle);
 				curopt = 0;
 			}
 			break;
@@ -294,11 +741,205 @@ int usage_opt(char const *sopt, treeparam_t *ptreeparam)
 
 		case 'x':
 			if (isoptval) {
-				iErr = paramstrarr(
-				    ptreeparam->excludf, &ptreeparam->excludfno,
-				    TT_MAXEXCLUDF, sopt, "\nThe maximum number "
-							 "of excluded "
-							 "functions is %d\n");
+				if (sopt[0] == '@')
+					iErr = paramstrfile(
+					    &ptreeparam->excludf,
+					    &ptreeparam->excludfno, sopt + 1);
+				else
+					iErr = paramstrlist(
+					    &ptreeparam->excludf,
+					    &ptreeparam->excludfno, sopt);
+				curopt = 0;
+			}
+			break;
+
+		case OPT_PATHS:
+			if (isoptval) {
+				ptreeparam->mode = TREEMODE_PATHS;
+				if (strcmp(sopt, "shortest") == 0)
+					ptreeparam->paths = TREEPATHS_SHORTEST;
+				else if (sscanf(sopt, "kshortest:%d",
+						&ptreeparam->pathno) == 1 &&
+					 ptreeparam->pathno > 0)
+					ptreeparam->paths = TREEPATHS_KSHORTEST;
+				else if (sscanf(sopt, "all:%d",
+						&ptreeparam->pathlen) == 1 &&
+					 ptreeparam->pathlen >= 0)
+					ptreeparam->paths = TREEPATHS_ALL;
+				else {
+					printf("\nCall paths must be shortest, "
+					       "kshortest:<k> or "
+					       "all:<maxlen>\n");
+					iErr = -3;
+				}
+				curopt = 0;
+			}
+			break;
+
+		case OPT_FORMAT:
+			if (isoptval) {
+				if (strcmp(sopt, "dot") == 0)
+					ptreeparam->outtype = TREEOUT_GRAPHVIZ;
+				else if (strcmp(sopt, "text") == 0)
+					ptreeparam->outtype = TREEOUT_TEXT;
+				else if (strcmp(sopt, "json") == 0)
+					ptreeparam->outtype = TREEOUT_JSON;
+				else if (strcmp(sopt, "csv") == 0)
+					ptreeparam->outtype = TREEOUT_CSV;
+				else if (strcmp(sopt, "bin") == 0)
+					ptreeparam->outtype = TREEOUT_BINARY;
+				else {
+					printf("\nOutput format must be dot, "
+					       "text, json, csv or bin\n");
+					iErr = -3;
+				}
+				curopt = 0;
+			}
+			break;
+
+		case OPT_RECURSION:
+			ptreeparam->mode = TREEMODE_RECURSION;
+			curopt = 0;
+			break;
+
+		case OPT_CONDENSE:
+			if (isoptval) {
+				if (strcmp(sopt, "cluster") == 0)
+					ptreeparam->condense =
+					    TREECONDENSE_CLUSTER;
+				else if (strcmp(sopt, "node") == 0)
+					ptreeparam->condense =
+					    TREECONDENSE_NODE;
+				else {
+					printf("\nRecursive groups must be "
+					       "condensed into cluster or "
+					       "node\n");
+					iErr = -3;
+				}
+				curopt = 0;
+			}
+			break;
+
+		case OPT_REACH:
+			if (isoptval) {
+				ptreeparam->mode = TREEMODE_REACH;
+				iErr = paramstr(&ptreeparam->reachfile, sopt);
+				curopt = 0;
+			}
+			break;
+
+		case OPT_DOMINATORS:
+			// the selector is optional, so only given after =
+			ptreeparam->mode = TREEMODE_DOMINATORS;
+			if (isoptval)
+				iErr = paramstr(&ptreeparam->domsel, sopt);
+			curopt = 0;
+			break;
+
+		case OPT_METRICS:
+			// the number of functions is optional, so only given
+			// after =
+			ptreeparam->mode = TREEMODE_METRICS;
+			if (isoptval && (sscanf(sopt, "%d",
+						&ptreeparam->topno) != 1 ||
+					 ptreeparam->topno <= 0)) {
+				printf("\nFunctions in each table of metrics "
+				       "must be a number > 0\n");
+				iErr = -3;
+			}
+			curopt = 0;
+			break;
+
+		case OPT_DEAD:
+			ptreeparam->mode = TREEMODE_DEAD;
+			curopt = 0;
+			break;
+
+		case OPT_MATRIX:
+			ptreeparam->mode = TREEMODE_MATRIX;
+			curopt = 0;
+			break;
+
+		case OPT_BETWEENNESS:
+			// samples and number of functions are optional, so
+			// only given after =
+			ptreeparam->mode = TREEMODE_BETWEENNESS;
+			if (isoptval) {
+				valno = sscanf(sopt, "%d:%d",
+					   &ptreeparam->betwsamples,
+					   &ptreeparam->topno);
+				if (valno < 1 || ptreeparam->betwsamples < 0 ||
+				    (valno == 2 && ptreeparam->topno <= 0)) {
+					printf("\nBetweenness samples must be "
+					       "a number >= 0, optionally "
+					       "followed by\n:<functions> > "
+					       "0\n");
+					iErr = -3;
+				}
+			}
+			curopt = 0;
+			break;
+
+		case OPT_DIFF:
+			if (isoptval) {
+				ptreeparam->mode = TREEMODE_DIFF;
+				iErr = paramstr(&ptreeparam->difffile, sopt);
+				curopt = 0;
+			}
+			break;
+
+		case OPT_IMPACT:
+			if (isoptval) {
+				ptreeparam->mode = TREEMODE_IMPACT;
+				iErr = paramstr(&ptreeparam->impactfile, sopt);
+				curopt = 0;
+			}
+			break;
+
+		case OPT_STACK:
+			if (isoptval) {
+				ptreeparam->mode = TREEMODE_STACK;
+				iErr = paramstr(&ptreeparam->stackfile, sopt);
+				curopt = 0;
+			}
+			break;
+
+		case OPT_SIZES:
+			if (isoptval) {
+				ptreeparam->mode = TREEMODE_SIZES;
+				iErr = paramstr(&ptreeparam->sizefile, sopt);
+				curopt = 0;
+			}
+			break;
+
+		case OPT_PROFILE:
+			if (isoptval) {
+				ptreeparam->mode = TREEMODE_PROFILE;
+				iErr = paramstr(&ptreeparam->proffile, sopt);
+				if (iErr == 0)
+					iErr = paramprofpct(ptreeparam);
+				curopt = 0;
+			}
+			break;
+
+		case OPT_CLUSTER:
+			if (isoptval) {
+				ptreeparam->clusterno = 0;
+				if (strcmp(sopt, "file") == 0) {
+					ptreeparam->doclusters = 1;
+					ptreeparam->autoclusters = 0;
+				} else if (strcmp(sopt, "auto") == 0 ||
+					   (sscanf(sopt, "auto:%d",
+						   &ptreeparam->clusterno) ==
+						1 &&
+					    ptreeparam->clusterno > 0)) {
+					ptreeparam->doclusters = 0;
+					ptreeparam->autoclusters = 1;
+				} else {
+					printf("\nClusters must be file, auto "
+					       "or auto:<n> with n > 0\n");
+					iErr = -3;
+				}
 				curopt = 0;
 			}
 			break;
@@ -336,18 +977,68 @@ int main(int argc, char *argv[])
 		iErr = paramcrosscheck(&treeparam);
 
 	if (iErr == 0) {
-		if (treeparam.rootno == 0) {
-			paramstr(&treeparam.root[0],
-				 "main"); // if no root is specified then start
-					  // from main
-			treeparam.rootno = 1;
-		}
+		if (treeparam.rootno == 0)
+			paramstrlist(&treeparam.root, &treeparam.rootno,
+				     "main"); // if no root is specified then
+					      // start from main
 
 		ttree = ttreeinit(); // initialize tree
 
 		// read cscope file and get the whole tree
 		iErr = gettree(ttree, &treeparam);
 		if (iErr == 0)
+			// build the symbol index
+			iErr = ttreefreeze(ttree);
+		if (iErr == 0 && treeparam.verbose)
+			printf("\nSymbol index: %u names, %.1f bits per name\n",
+			       ttree->nameno,
+			       ttree->nameno ? (double)mphbits(ttree->namemph) /
+						   ttree->nameno :
+					       0.0);
+		if (iErr == 0 && treeparam.mode == TREEMODE_PATHS)
+			// list the call paths between roots and path ends
+			iErr = outpaths(ttree, &treeparam);
+		else if (iErr == 0 && treeparam.mode == TREEMODE_RECURSION)
+			// list the groups of functions calling each other
+			iErr = outrecursion(ttree, &treeparam);
+		else if (iErr == 0 && treeparam.mode == TREEMODE_REACH)
+			// answer the reachability queries
+			iErr = outreachfile(ttree, &treeparam);
+		else if (iErr == 0 && treeparam.mode == TREEMODE_DOMINATORS)
+			// dominator tree from the roots
+			iErr = outdominators(ttree, &treeparam);
+		else if (iErr == 0 && treeparam.mode == TREEMODE_METRICS &&
+			 treeparam.outtype != TREEOUT_GRAPHVIZ)
+			// tables of metrics; in dot format, they are
+			// attributes of the tree nodes
+			iErr = outmetrics(ttree, &treeparam);
+		else if (iErr == 0 && treeparam.mode == TREEMODE_DEAD)
+			// functions not reached from the roots
+			iErr = outdead(ttree, &treeparam);
+		else if (iErr == 0 && treeparam.mode == TREEMODE_MATRIX)
+			// roots reaching each function
+			iErr = outmatrix(ttree, &treeparam);
+		else if (iErr == 0 && treeparam.mode == TREEMODE_BETWEENNESS)
+			// functions on the most shortest call chains
+			iErr = outbetweenness(ttree, &treeparam);
+		else if (iErr == 0 && treeparam.mode == TREEMODE_DIFF)
+			// calls added and removed since the old database
+			iErr = outdiff(ttree, &treeparam);
+		else if (iErr == 0 && treeparam.mode == TREEMODE_IMPACT)
+			// functions and roots reached by the changed lines
+			iErr = outimpact(ttree, &treeparam);
+		else if (iErr == 0 && treeparam.mode == TREEMODE_STACK)
+			// worst stack usage from the roots
+			iErr = outstack(ttree, &treeparam);
+		else if (iErr == 0 && treeparam.mode == TREEMODE_SIZES &&
+			 treeparam.outtype != TREEOUT_GRAPHVIZ)
+			// code sizes reached from the roots; in dot format,
+			// labels of the tree nodes
+			iErr = outsizes(ttree, &treeparam);
+		else if (iErr == 0 && treeparam.mode == TREEMODE_PROFILE)
+			// hot call graph of the sampled stacks
+			iErr = outprofile(ttree, &treeparam);
+		else if (iErr == 0)
 			// make subtree output according to options
 			iErr = outtree(ttree, &treeparam);
 
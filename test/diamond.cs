@@ -0,0 +1,106 @@
+cscope 15 . -c 0000000000
+	@diamond.c
+
+1 void
+	$main
+(void)
+
+2 
+	`x
+();
+
+3 
+	`a1
+();
+
+4 }
+	}
+
+6 void
+	$a1
+(void)
+
+7 
+	`a2
+();
+
+8 }
+	}
+
+10 void
+	$a2
+(void)
+
+11 
+	`x
+();
+
+12 }
+	}
+
+14 void
+	$x
+(void)
+
+15 
+	`y
+();
+
+16 }
+	}
+
+18 void
+	$y
+(void)
+
+19 
+	`z
+();
+
+20 
+	`c2
+();
+
+21 }
+	}
+
+23 void
+	$z
+(void)
+
+24 
+	`w
+();
+
+25 }
+	}
+
+27 void
+	$w
+(void)
+
+28 }
+	}
+
+30 void
+	$c2
+(void)
+
+31 
+	`c1
+();
+
+32 }
+	}
+
+34 void
+	$c1
+(void)
+
+35 
+	`w
+();
+
+36 }
+	}
+
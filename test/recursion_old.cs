@@ -0,0 +1,147 @@
+cscope 15 . -c 0000000000
+	@recursion.c
+
+1 void
+	$main
+(void)
+
+2 
+	`parse
+();
+
+3 
+	`walk
+();
+
+5 }
+	}
+
+7 void
+	$parse
+(void)
+
+8 
+	`expr
+();
+
+9 }
+	}
+
+11 void
+	$expr
+(void)
+
+12 
+	`term
+();
+
+13 
+	`report
+();
+
+14 }
+	}
+
+16 void
+	$term
+(void)
+
+17 
+	`factor
+();
+
+18 }
+	}
+
+20 void
+	$factor
+(void)
+
+21 
+	`expr
+();
+
+22 
+	`printf
+();
+
+23 }
+	}
+
+25 void
+	$walk
+(void)
+
+26 
+	`walk
+();
+
+27 
+	`visit
+();
+
+28 }
+24 
+	`trace
+();
+
+	}
+
+30 void
+	$visit
+(void)
+
+31 
+	`enter
+();
+
+32 }
+	}
+
+34 void
+	$enter
+(void)
+
+35 
+	`leave
+();
+
+36 }
+	}
+
+38 void
+	$leave
+(void)
+
+39 
+	`enter
+();
+
+40 }
+	}
+
+42 void
+	$report
+(void)
+
+43 
+	`printf
+();
+
+44 }
+	}
+
+60 void
+	$trace
+(void)
+
+61 
+	`printf
+();
+
+62 }
+	}
+
+64 #define 
+	#MAXN
+ 10
@@ -9,3 +9,146 @@ ${TCEETREE} -V -i cscope.out -o tceetree.out
 diff -u \
     <(grep '^[[:space:]]' tceetree.out.orig | sort) \
     <(grep '^[[:space:]]' tceetree.out | sort) \
+
+# depth limits on diamond shaped call graphs, where a node is first reached
+# through the longer path
+${TCEETREE} -i diamond.cs -o diamond_c3.out -c 3
+
+diff -u \
+    <(grep '^[[:space:]]' diamond_c3.out.orig | sort) \
+    <(grep '^[[:space:]]' diamond_c3.out | sort)
+
+${TCEETREE} -i diamond.cs -o diamond_bc3.out -r w -c 0 -C 3
+
+diff -u \
+    <(grep '^[[:space:]]' diamond_bc3.out.orig | sort) \
+    <(grep '^[[:space:]]' diamond_bc3.out | sort)
+
+# output file in another directory: the graph is named after its basename
+${TCEETREE} -i diamond.cs -o ../test/diamond_dir.out -c 3
+
+diff -u \
+    <(grep '^[[:space:]]' diamond_c3.out.orig | sort) \
+    <(grep '^[[:space:]]' diamond_dir.out | sort)
+head -n 1 diamond_dir.out | grep -qx 'digraph diamond_dir'
+
+# call path queries: paths by increasing length, with no repeated function
+${TCEETREE} -i diamond.cs -o diamond_paths.out --paths=kshortest:5 \
+    --format=text -p w
+
+diff -u diamond_paths.out.orig diamond_paths.out
+
+# recursive groups: report and tree with each group condensed into a node
+${TCEETREE} -i recursion.cs -o recursion.out --recursion --format=text
+
+diff -u recursion.out.orig recursion.out
+
+${TCEETREE} -i recursion.cs -o recursion_node.out --condense=node -p report
+
+diff -u \
+    <(grep '^[[:space:]]' recursion_node.out.orig | sort) \
+    <(grep '^[[:space:]]' recursion_node.out | sort)
+
+# reachability queries over the recursive groups
+${TCEETREE} -i recursion.cs -o recursion_reach.out \
+    --reach=recursion_reach.txt --format=text
+
+diff -u recursion_reach.out.orig recursion_reach.out
+
+# dominator tree: functions every call path from main goes through
+${TCEETREE} -i diamond.cs -o diamond_dom.out --dominators --format=text
+
+diff -u diamond_dom.out.orig diamond_dom.out
+
+# metrics of every function
+${TCEETREE} -i recursion.cs -o recursion_metrics.out --metrics --format=csv
+
+diff -u recursion_metrics.out.orig recursion_metrics.out
+
+# functions not reached from the roots
+${TCEETREE} -i recursion.cs -o recursion_dead.out --dead -r walk --format=text
+
+diff -u recursion_dead.out.orig recursion_dead.out
+
+# roots reaching each function, one column per root
+${TCEETREE} -i recursion.cs -o recursion_matrix.out --matrix --format=csv \
+    -r main -r walk -r 'f*' -r report -x visit
+
+diff -u recursion_matrix.out.orig recursion_matrix.out
+
+# the tree scanned on threads is the same as on one thread
+${TCEETREE} -i recursion.cs -o recursion_j1.out -r report -C max -j 1
+${TCEETREE} -i recursion.cs -o recursion_j4.out -r report -C max -j 4
+
+diff -u \
+    <(grep '^[[:space:]]' recursion_j1.out) \
+    <(grep '^[[:space:]]' recursion_j4.out)
+
+# and the same as the default depth first scan, where the callers of the
+# functions already scanned as callees are left out
+${TCEETREE} -i recursion.cs -o recursion_dfs.out -r term -c max -C max
+${TCEETREE} -i recursion.cs -o recursion_j2.out -r term -c max -C max -j 2
+
+diff -u \
+    <(grep '^[[:space:]]' recursion_dfs.out | sort) \
+    <(grep '^[[:space:]]' recursion_j2.out | sort)
+
+# levels of several chunks, scanned top down and bottom up
+${TCEETREE} -i wide.cs -o wide_dfs.out -r main
+${TCEETREE} -i wide.cs -o wide_j3.out -r main -j 3
+
+diff -u \
+    <(grep '^[[:space:]]' wide_dfs.out | sort) \
+    <(grep '^[[:space:]]' wide_j3.out | sort)
+
+${TCEETREE} -i wide.cs -o wide_dfs.out -r hub -c max -C max
+${TCEETREE} -i wide.cs -o wide_j3.out -r hub -c max -C max -j 3
+
+diff -u \
+    <(grep '^[[:space:]]' wide_dfs.out | sort) \
+    <(grep '^[[:space:]]' wide_j3.out | sort)
+
+# exact betweenness, on threads
+${TCEETREE} -i recursion.cs -o recursion_betw.out --betweenness=0 \
+    --format=csv -j 2
+
+diff -u recursion_betw.out.orig recursion_betw.out
+
+# clusters of functions calling each other
+${TCEETREE} -i recursion.cs -o recursion_comm.out --cluster=auto
+
+diff -u \
+    <(grep '^[[:space:]]' recursion_comm.out.orig | sort) \
+    <(grep '^[[:space:]]' recursion_comm.out | sort)
+
+# calls added and removed since an older database
+${TCEETREE} -i recursion.cs -o recursion_diff.out --diff=recursion_old.cs \
+    --format=csv
+
+diff -u recursion_diff.out.orig recursion_diff.out
+
+# functions and roots reached by the lines of a patch
+${TCEETREE} -i recursion.cs -o recursion_impact.out \
+    --impact=recursion.patch --format=text -r main -r walk
+
+diff -u recursion_impact.out.orig recursion_impact.out
+
+# worst stack usage from the roots, with frames of gcc -fstack-usage
+${TCEETREE} -i recursion.cs -o recursion_stack.out --stack=recursion.su \
+    --format=csv -r main -r term -r report -r leave -x expr
+
+diff -u recursion_stack.out.orig recursion_stack.out
+
+# code size reached from the roots, with the symbol sizes of nm -S
+${TCEETREE} -i recursion.cs -o recursion_sizes.out --sizes=recursion.nm \
+    --format=csv -r main -r walk -r report -r parse
+
+diff -u recursion_sizes.out.orig recursion_sizes.out
+
+# hot call graph of the folded stacks of a profiler
+${TCEETREE} -i recursion.cs -o recursion_profile.out \
+    --profile=recursion.folded:10
+
+diff -u \
+    <(grep '^[[:space:]]' recursion_profile.out.orig | sort) \
+    <(grep '^[[:space:]]' recursion_profile.out | sort)
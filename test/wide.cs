@@ -0,0 +1,16597 @@
+cscope 15 . -c 0000000000
+	@hub.c
+
+1 void
+	$main
+(void)
+
+2 
+	`m
+();
+
+3 
+	`hub
+();
+
+6 void
+	$m
+(void)
+
+7 
+	`r0
+();
+
+8 
+	`r1
+();
+
+9 
+	`r2
+();
+
+10 
+	`r3
+();
+
+11 
+	`r4
+();
+
+12 
+	`r5
+();
+
+13 
+	`r6
+();
+
+14 
+	`r7
+();
+
+15 
+	`r8
+();
+
+16 
+	`r9
+();
+
+17 
+	`r10
+();
+
+18 
+	`r11
+();
+
+19 
+	`r12
+();
+
+20 
+	`r13
+();
+
+21 
+	`r14
+();
+
+22 
+	`r15
+();
+
+23 
+	`r16
+();
+
+24 
+	`r17
+();
+
+25 
+	`r18
+();
+
+26 
+	`r19
+();
+
+27 
+	`r20
+();
+
+28 
+	`r21
+();
+
+29 
+	`r22
+();
+
+30 
+	`r23
+();
+
+31 
+	`r24
+();
+
+32 
+	`r25
+();
+
+33 
+	`r26
+();
+
+34 
+	`r27
+();
+
+35 
+	`r28
+();
+
+36 
+	`r29
+();
+
+37 
+	`r30
+();
+
+38 
+	`r31
+();
+
+39 
+	`r32
+();
+
+40 
+	`r33
+();
+
+41 
+	`r34
+();
+
+42 
+	`r35
+();
+
+43 
+	`r36
+();
+
+44 
+	`r37
+();
+
+45 
+	`r38
+();
+
+46 
+	`r39
+();
+
+47 
+	`r40
+();
+
+48 
+	`r41
+();
+
+49 
+	`r42
+();
+
+50 
+	`r43
+();
+
+51 
+	`r44
+();
+
+52 
+	`r45
+();
+
+53 
+	`r46
+();
+
+54 
+	`r47
+();
+
+55 
+	`r48
+();
+
+56 
+	`r49
+();
+
+57 
+	`r50
+();
+
+58 
+	`r51
+();
+
+59 
+	`r52
+();
+
+60 
+	`r53
+();
+
+61 
+	`r54
+();
+
+62 
+	`r55
+();
+
+63 
+	`r56
+();
+
+64 
+	`r57
+();
+
+65 
+	`r58
+();
+
+66 
+	`r59
+();
+
+67 
+	`r60
+();
+
+68 
+	`r61
+();
+
+69 
+	`r62
+();
+
+70 
+	`r63
+();
+
+71 
+	`r64
+();
+
+72 
+	`r65
+();
+
+73 
+	`r66
+();
+
+74 
+	`r67
+();
+
+75 
+	`r68
+();
+
+76 
+	`r69
+();
+
+77 
+	`r70
+();
+
+78 
+	`r71
+();
+
+79 
+	`r72
+();
+
+80 
+	`r73
+();
+
+81 
+	`r74
+();
+
+82 
+	`r75
+();
+
+83 
+	`r76
+();
+
+84 
+	`r77
+();
+
+85 
+	`r78
+();
+
+86 
+	`r79
+();
+
+87 
+	`r80
+();
+
+88 
+	`r81
+();
+
+89 
+	`r82
+();
+
+90 
+	`r83
+();
+
+91 
+	`r84
+();
+
+92 
+	`r85
+();
+
+93 
+	`r86
+();
+
+94 
+	`r87
+();
+
+95 
+	`r88
+();
+
+96 
+	`r89
+();
+
+97 
+	`r90
+();
+
+98 
+	`r91
+();
+
+99 
+	`r92
+();
+
+100 
+	`r93
+();
+
+101 
+	`r94
+();
+
+102 
+	`r95
+();
+
+103 
+	`r96
+();
+
+104 
+	`r97
+();
+
+105 
+	`r98
+();
+
+106 
+	`r99
+();
+
+107 
+	`r100
+();
+
+108 
+	`r101
+();
+
+109 
+	`r102
+();
+
+110 
+	`r103
+();
+
+111 
+	`r104
+();
+
+112 
+	`r105
+();
+
+113 
+	`r106
+();
+
+114 
+	`r107
+();
+
+115 
+	`r108
+();
+
+116 
+	`r109
+();
+
+117 
+	`r110
+();
+
+118 
+	`r111
+();
+
+119 
+	`r112
+();
+
+120 
+	`r113
+();
+
+121 
+	`r114
+();
+
+122 
+	`r115
+();
+
+123 
+	`r116
+();
+
+124 
+	`r117
+();
+
+125 
+	`r118
+();
+
+126 
+	`r119
+();
+
+127 
+	`r120
+();
+
+128 
+	`r121
+();
+
+129 
+	`r122
+();
+
+130 
+	`r123
+();
+
+131 
+	`r124
+();
+
+132 
+	`r125
+();
+
+133 
+	`r126
+();
+
+134 
+	`r127
+();
+
+135 
+	`r128
+();
+
+136 
+	`r129
+();
+
+137 
+	`r130
+();
+
+138 
+	`r131
+();
+
+139 
+	`r132
+();
+
+140 
+	`r133
+();
+
+141 
+	`r134
+();
+
+142 
+	`r135
+();
+
+143 
+	`r136
+();
+
+144 
+	`r137
+();
+
+145 
+	`r138
+();
+
+146 
+	`r139
+();
+
+147 
+	`r140
+();
+
+148 
+	`r141
+();
+
+149 
+	`r142
+();
+
+150 
+	`r143
+();
+
+151 
+	`r144
+();
+
+152 
+	`r145
+();
+
+153 
+	`r146
+();
+
+154 
+	`r147
+();
+
+155 
+	`r148
+();
+
+156 
+	`r149
+();
+
+157 
+	`r150
+();
+
+158 
+	`r151
+();
+
+159 
+	`r152
+();
+
+160 
+	`r153
+();
+
+161 
+	`r154
+();
+
+162 
+	`r155
+();
+
+163 
+	`r156
+();
+
+164 
+	`r157
+();
+
+165 
+	`r158
+();
+
+166 
+	`r159
+();
+
+167 
+	`r160
+();
+
+168 
+	`r161
+();
+
+169 
+	`r162
+();
+
+170 
+	`r163
+();
+
+171 
+	`r164
+();
+
+172 
+	`r165
+();
+
+173 
+	`r166
+();
+
+174 
+	`r167
+();
+
+175 
+	`r168
+();
+
+176 
+	`r169
+();
+
+177 
+	`r170
+();
+
+178 
+	`r171
+();
+
+179 
+	`r172
+();
+
+180 
+	`r173
+();
+
+181 
+	`r174
+();
+
+182 
+	`r175
+();
+
+183 
+	`r176
+();
+
+184 
+	`r177
+();
+
+185 
+	`r178
+();
+
+186 
+	`r179
+();
+
+187 
+	`r180
+();
+
+188 
+	`r181
+();
+
+189 
+	`r182
+();
+
+190 
+	`r183
+();
+
+191 
+	`r184
+();
+
+192 
+	`r185
+();
+
+193 
+	`r186
+();
+
+194 
+	`r187
+();
+
+195 
+	`r188
+();
+
+196 
+	`r189
+();
+
+197 
+	`r190
+();
+
+198 
+	`r191
+();
+
+199 
+	`r192
+();
+
+200 
+	`r193
+();
+
+201 
+	`r194
+();
+
+202 
+	`r195
+();
+
+203 
+	`r196
+();
+
+204 
+	`r197
+();
+
+205 
+	`r198
+();
+
+206 
+	`r199
+();
+
+209 void
+	$hub
+(void)
+
+210 
+	`p0
+();
+
+211 
+	`p1
+();
+
+212 
+	`p2
+();
+
+213 
+	`p3
+();
+
+214 
+	`p4
+();
+
+215 
+	`p5
+();
+
+216 
+	`p6
+();
+
+217 
+	`p7
+();
+
+218 
+	`p8
+();
+
+219 
+	`p9
+();
+
+220 
+	`p10
+();
+
+221 
+	`p11
+();
+
+222 
+	`p12
+();
+
+223 
+	`p13
+();
+
+224 
+	`p14
+();
+
+225 
+	`p15
+();
+
+226 
+	`p16
+();
+
+227 
+	`p17
+();
+
+228 
+	`p18
+();
+
+229 
+	`p19
+();
+
+230 
+	`p20
+();
+
+231 
+	`p21
+();
+
+232 
+	`p22
+();
+
+233 
+	`p23
+();
+
+234 
+	`p24
+();
+
+235 
+	`p25
+();
+
+236 
+	`p26
+();
+
+237 
+	`p27
+();
+
+238 
+	`p28
+();
+
+239 
+	`p29
+();
+
+240 
+	`p30
+();
+
+241 
+	`p31
+();
+
+242 
+	`p32
+();
+
+243 
+	`p33
+();
+
+244 
+	`p34
+();
+
+245 
+	`p35
+();
+
+246 
+	`p36
+();
+
+247 
+	`p37
+();
+
+248 
+	`p38
+();
+
+249 
+	`p39
+();
+
+250 
+	`p40
+();
+
+251 
+	`p41
+();
+
+252 
+	`p42
+();
+
+253 
+	`p43
+();
+
+254 
+	`p44
+();
+
+255 
+	`p45
+();
+
+256 
+	`p46
+();
+
+257 
+	`p47
+();
+
+258 
+	`p48
+();
+
+259 
+	`p49
+();
+
+260 
+	`leaf
+();
+
+263 void
+	$leaf
+(void)
+
+	@p.c
+
+1 void
+	$p0
+(void)
+
+2 
+	`hub
+();
+
+3 
+	`w0
+();
+
+6 void
+	$p1
+(void)
+
+7 
+	`hub
+();
+
+8 
+	`w1
+();
+
+11 void
+	$p2
+(void)
+
+12 
+	`hub
+();
+
+13 
+	`w2
+();
+
+16 void
+	$p3
+(void)
+
+17 
+	`hub
+();
+
+18 
+	`w3
+();
+
+21 void
+	$p4
+(void)
+
+22 
+	`hub
+();
+
+23 
+	`w4
+();
+
+26 void
+	$p5
+(void)
+
+27 
+	`hub
+();
+
+28 
+	`w5
+();
+
+31 void
+	$p6
+(void)
+
+32 
+	`hub
+();
+
+33 
+	`w6
+();
+
+36 void
+	$p7
+(void)
+
+37 
+	`hub
+();
+
+38 
+	`w7
+();
+
+41 void
+	$p8
+(void)
+
+42 
+	`hub
+();
+
+43 
+	`w8
+();
+
+46 void
+	$p9
+(void)
+
+47 
+	`hub
+();
+
+48 
+	`w9
+();
+
+51 void
+	$p10
+(void)
+
+52 
+	`hub
+();
+
+53 
+	`w10
+();
+
+56 void
+	$p11
+(void)
+
+57 
+	`hub
+();
+
+58 
+	`w11
+();
+
+61 void
+	$p12
+(void)
+
+62 
+	`hub
+();
+
+63 
+	`w12
+();
+
+66 void
+	$p13
+(void)
+
+67 
+	`hub
+();
+
+68 
+	`w13
+();
+
+71 void
+	$p14
+(void)
+
+72 
+	`hub
+();
+
+73 
+	`w14
+();
+
+76 void
+	$p15
+(void)
+
+77 
+	`hub
+();
+
+78 
+	`w15
+();
+
+81 void
+	$p16
+(void)
+
+82 
+	`hub
+();
+
+83 
+	`w16
+();
+
+86 void
+	$p17
+(void)
+
+87 
+	`hub
+();
+
+88 
+	`w17
+();
+
+91 void
+	$p18
+(void)
+
+92 
+	`hub
+();
+
+93 
+	`w18
+();
+
+96 void
+	$p19
+(void)
+
+97 
+	`hub
+();
+
+98 
+	`w19
+();
+
+101 void
+	$p20
+(void)
+
+102 
+	`hub
+();
+
+103 
+	`w20
+();
+
+106 void
+	$p21
+(void)
+
+107 
+	`hub
+();
+
+108 
+	`w21
+();
+
+111 void
+	$p22
+(void)
+
+112 
+	`hub
+();
+
+113 
+	`w22
+();
+
+116 void
+	$p23
+(void)
+
+117 
+	`hub
+();
+
+118 
+	`w23
+();
+
+121 void
+	$p24
+(void)
+
+122 
+	`hub
+();
+
+123 
+	`w24
+();
+
+126 void
+	$p25
+(void)
+
+127 
+	`hub
+();
+
+128 
+	`w25
+();
+
+131 void
+	$p26
+(void)
+
+132 
+	`hub
+();
+
+133 
+	`w26
+();
+
+136 void
+	$p27
+(void)
+
+137 
+	`hub
+();
+
+138 
+	`w27
+();
+
+141 void
+	$p28
+(void)
+
+142 
+	`hub
+();
+
+143 
+	`w28
+();
+
+146 void
+	$p29
+(void)
+
+147 
+	`hub
+();
+
+148 
+	`w29
+();
+
+151 void
+	$p30
+(void)
+
+152 
+	`hub
+();
+
+153 
+	`w30
+();
+
+156 void
+	$p31
+(void)
+
+157 
+	`hub
+();
+
+158 
+	`w31
+();
+
+161 void
+	$p32
+(void)
+
+162 
+	`hub
+();
+
+163 
+	`w32
+();
+
+166 void
+	$p33
+(void)
+
+167 
+	`hub
+();
+
+168 
+	`w33
+();
+
+171 void
+	$p34
+(void)
+
+172 
+	`hub
+();
+
+173 
+	`w34
+();
+
+176 void
+	$p35
+(void)
+
+177 
+	`hub
+();
+
+178 
+	`w35
+();
+
+181 void
+	$p36
+(void)
+
+182 
+	`hub
+();
+
+183 
+	`w36
+();
+
+186 void
+	$p37
+(void)
+
+187 
+	`hub
+();
+
+188 
+	`w37
+();
+
+191 void
+	$p38
+(void)
+
+192 
+	`hub
+();
+
+193 
+	`w38
+();
+
+196 void
+	$p39
+(void)
+
+197 
+	`hub
+();
+
+198 
+	`w39
+();
+
+201 void
+	$p40
+(void)
+
+202 
+	`hub
+();
+
+203 
+	`w40
+();
+
+206 void
+	$p41
+(void)
+
+207 
+	`hub
+();
+
+208 
+	`w41
+();
+
+211 void
+	$p42
+(void)
+
+212 
+	`hub
+();
+
+213 
+	`w42
+();
+
+216 void
+	$p43
+(void)
+
+217 
+	`hub
+();
+
+218 
+	`w43
+();
+
+221 void
+	$p44
+(void)
+
+222 
+	`hub
+();
+
+223 
+	`w44
+();
+
+226 void
+	$p45
+(void)
+
+227 
+	`hub
+();
+
+228 
+	`w45
+();
+
+231 void
+	$p46
+(void)
+
+232 
+	`hub
+();
+
+233 
+	`w46
+();
+
+236 void
+	$p47
+(void)
+
+237 
+	`hub
+();
+
+238 
+	`w47
+();
+
+241 void
+	$p48
+(void)
+
+242 
+	`hub
+();
+
+243 
+	`w48
+();
+
+246 void
+	$p49
+(void)
+
+247 
+	`hub
+();
+
+248 
+	`w49
+();
+
+251 void
+	$p50
+(void)
+
+252 
+	`hub
+();
+
+253 
+	`w50
+();
+
+256 void
+	$p51
+(void)
+
+257 
+	`hub
+();
+
+258 
+	`w51
+();
+
+261 void
+	$p52
+(void)
+
+262 
+	`hub
+();
+
+263 
+	`w52
+();
+
+266 void
+	$p53
+(void)
+
+267 
+	`hub
+();
+
+268 
+	`w53
+();
+
+271 void
+	$p54
+(void)
+
+272 
+	`hub
+();
+
+273 
+	`w54
+();
+
+276 void
+	$p55
+(void)
+
+277 
+	`hub
+();
+
+278 
+	`w55
+();
+
+281 void
+	$p56
+(void)
+
+282 
+	`hub
+();
+
+283 
+	`w56
+();
+
+286 void
+	$p57
+(void)
+
+287 
+	`hub
+();
+
+288 
+	`w57
+();
+
+291 void
+	$p58
+(void)
+
+292 
+	`hub
+();
+
+293 
+	`w58
+();
+
+296 void
+	$p59
+(void)
+
+297 
+	`hub
+();
+
+298 
+	`w59
+();
+
+301 void
+	$p60
+(void)
+
+302 
+	`hub
+();
+
+303 
+	`w60
+();
+
+306 void
+	$p61
+(void)
+
+307 
+	`hub
+();
+
+308 
+	`w61
+();
+
+311 void
+	$p62
+(void)
+
+312 
+	`hub
+();
+
+313 
+	`w62
+();
+
+316 void
+	$p63
+(void)
+
+317 
+	`hub
+();
+
+318 
+	`w63
+();
+
+321 void
+	$p64
+(void)
+
+322 
+	`hub
+();
+
+323 
+	`w64
+();
+
+326 void
+	$p65
+(void)
+
+327 
+	`hub
+();
+
+328 
+	`w65
+();
+
+331 void
+	$p66
+(void)
+
+332 
+	`hub
+();
+
+333 
+	`w66
+();
+
+336 void
+	$p67
+(void)
+
+337 
+	`hub
+();
+
+338 
+	`w67
+();
+
+341 void
+	$p68
+(void)
+
+342 
+	`hub
+();
+
+343 
+	`w68
+();
+
+346 void
+	$p69
+(void)
+
+347 
+	`hub
+();
+
+348 
+	`w69
+();
+
+351 void
+	$p70
+(void)
+
+352 
+	`hub
+();
+
+353 
+	`w70
+();
+
+356 void
+	$p71
+(void)
+
+357 
+	`hub
+();
+
+358 
+	`w71
+();
+
+361 void
+	$p72
+(void)
+
+362 
+	`hub
+();
+
+363 
+	`w72
+();
+
+366 void
+	$p73
+(void)
+
+367 
+	`hub
+();
+
+368 
+	`w73
+();
+
+371 void
+	$p74
+(void)
+
+372 
+	`hub
+();
+
+373 
+	`w74
+();
+
+376 void
+	$p75
+(void)
+
+377 
+	`hub
+();
+
+378 
+	`w75
+();
+
+381 void
+	$p76
+(void)
+
+382 
+	`hub
+();
+
+383 
+	`w76
+();
+
+386 void
+	$p77
+(void)
+
+387 
+	`hub
+();
+
+388 
+	`w77
+();
+
+391 void
+	$p78
+(void)
+
+392 
+	`hub
+();
+
+393 
+	`w78
+();
+
+396 void
+	$p79
+(void)
+
+397 
+	`hub
+();
+
+398 
+	`w79
+();
+
+401 void
+	$p80
+(void)
+
+402 
+	`hub
+();
+
+403 
+	`w80
+();
+
+406 void
+	$p81
+(void)
+
+407 
+	`hub
+();
+
+408 
+	`w81
+();
+
+411 void
+	$p82
+(void)
+
+412 
+	`hub
+();
+
+413 
+	`w82
+();
+
+416 void
+	$p83
+(void)
+
+417 
+	`hub
+();
+
+418 
+	`w83
+();
+
+421 void
+	$p84
+(void)
+
+422 
+	`hub
+();
+
+423 
+	`w84
+();
+
+426 void
+	$p85
+(void)
+
+427 
+	`hub
+();
+
+428 
+	`w85
+();
+
+431 void
+	$p86
+(void)
+
+432 
+	`hub
+();
+
+433 
+	`w86
+();
+
+436 void
+	$p87
+(void)
+
+437 
+	`hub
+();
+
+438 
+	`w87
+();
+
+441 void
+	$p88
+(void)
+
+442 
+	`hub
+();
+
+443 
+	`w88
+();
+
+446 void
+	$p89
+(void)
+
+447 
+	`hub
+();
+
+448 
+	`w89
+();
+
+451 void
+	$p90
+(void)
+
+452 
+	`hub
+();
+
+453 
+	`w90
+();
+
+456 void
+	$p91
+(void)
+
+457 
+	`hub
+();
+
+458 
+	`w91
+();
+
+461 void
+	$p92
+(void)
+
+462 
+	`hub
+();
+
+463 
+	`w92
+();
+
+466 void
+	$p93
+(void)
+
+467 
+	`hub
+();
+
+468 
+	`w93
+();
+
+471 void
+	$p94
+(void)
+
+472 
+	`hub
+();
+
+473 
+	`w94
+();
+
+476 void
+	$p95
+(void)
+
+477 
+	`hub
+();
+
+478 
+	`w95
+();
+
+481 void
+	$p96
+(void)
+
+482 
+	`hub
+();
+
+483 
+	`w96
+();
+
+486 void
+	$p97
+(void)
+
+487 
+	`hub
+();
+
+488 
+	`w97
+();
+
+491 void
+	$p98
+(void)
+
+492 
+	`hub
+();
+
+493 
+	`w98
+();
+
+496 void
+	$p99
+(void)
+
+497 
+	`hub
+();
+
+498 
+	`w99
+();
+
+501 void
+	$p100
+(void)
+
+502 
+	`hub
+();
+
+503 
+	`w100
+();
+
+506 void
+	$p101
+(void)
+
+507 
+	`hub
+();
+
+508 
+	`w101
+();
+
+511 void
+	$p102
+(void)
+
+512 
+	`hub
+();
+
+513 
+	`w102
+();
+
+516 void
+	$p103
+(void)
+
+517 
+	`hub
+();
+
+518 
+	`w103
+();
+
+521 void
+	$p104
+(void)
+
+522 
+	`hub
+();
+
+523 
+	`w104
+();
+
+526 void
+	$p105
+(void)
+
+527 
+	`hub
+();
+
+528 
+	`w105
+();
+
+531 void
+	$p106
+(void)
+
+532 
+	`hub
+();
+
+533 
+	`w106
+();
+
+536 void
+	$p107
+(void)
+
+537 
+	`hub
+();
+
+538 
+	`w107
+();
+
+541 void
+	$p108
+(void)
+
+542 
+	`hub
+();
+
+543 
+	`w108
+();
+
+546 void
+	$p109
+(void)
+
+547 
+	`hub
+();
+
+548 
+	`w109
+();
+
+551 void
+	$p110
+(void)
+
+552 
+	`hub
+();
+
+553 
+	`w110
+();
+
+556 void
+	$p111
+(void)
+
+557 
+	`hub
+();
+
+558 
+	`w111
+();
+
+561 void
+	$p112
+(void)
+
+562 
+	`hub
+();
+
+563 
+	`w112
+();
+
+566 void
+	$p113
+(void)
+
+567 
+	`hub
+();
+
+568 
+	`w113
+();
+
+571 void
+	$p114
+(void)
+
+572 
+	`hub
+();
+
+573 
+	`w114
+();
+
+576 void
+	$p115
+(void)
+
+577 
+	`hub
+();
+
+578 
+	`w115
+();
+
+581 void
+	$p116
+(void)
+
+582 
+	`hub
+();
+
+583 
+	`w116
+();
+
+586 void
+	$p117
+(void)
+
+587 
+	`hub
+();
+
+588 
+	`w117
+();
+
+591 void
+	$p118
+(void)
+
+592 
+	`hub
+();
+
+593 
+	`w118
+();
+
+596 void
+	$p119
+(void)
+
+597 
+	`hub
+();
+
+598 
+	`w119
+();
+
+601 void
+	$p120
+(void)
+
+602 
+	`hub
+();
+
+603 
+	`w120
+();
+
+606 void
+	$p121
+(void)
+
+607 
+	`hub
+();
+
+608 
+	`w121
+();
+
+611 void
+	$p122
+(void)
+
+612 
+	`hub
+();
+
+613 
+	`w122
+();
+
+616 void
+	$p123
+(void)
+
+617 
+	`hub
+();
+
+618 
+	`w123
+();
+
+621 void
+	$p124
+(void)
+
+622 
+	`hub
+();
+
+623 
+	`w124
+();
+
+626 void
+	$p125
+(void)
+
+627 
+	`hub
+();
+
+628 
+	`w125
+();
+
+631 void
+	$p126
+(void)
+
+632 
+	`hub
+();
+
+633 
+	`w126
+();
+
+636 void
+	$p127
+(void)
+
+637 
+	`hub
+();
+
+638 
+	`w127
+();
+
+641 void
+	$p128
+(void)
+
+642 
+	`hub
+();
+
+643 
+	`w128
+();
+
+646 void
+	$p129
+(void)
+
+647 
+	`hub
+();
+
+648 
+	`w129
+();
+
+651 void
+	$p130
+(void)
+
+652 
+	`hub
+();
+
+653 
+	`w130
+();
+
+656 void
+	$p131
+(void)
+
+657 
+	`hub
+();
+
+658 
+	`w131
+();
+
+661 void
+	$p132
+(void)
+
+662 
+	`hub
+();
+
+663 
+	`w132
+();
+
+666 void
+	$p133
+(void)
+
+667 
+	`hub
+();
+
+668 
+	`w133
+();
+
+671 void
+	$p134
+(void)
+
+672 
+	`hub
+();
+
+673 
+	`w134
+();
+
+676 void
+	$p135
+(void)
+
+677 
+	`hub
+();
+
+678 
+	`w135
+();
+
+681 void
+	$p136
+(void)
+
+682 
+	`hub
+();
+
+683 
+	`w136
+();
+
+686 void
+	$p137
+(void)
+
+687 
+	`hub
+();
+
+688 
+	`w137
+();
+
+691 void
+	$p138
+(void)
+
+692 
+	`hub
+();
+
+693 
+	`w138
+();
+
+696 void
+	$p139
+(void)
+
+697 
+	`hub
+();
+
+698 
+	`w139
+();
+
+701 void
+	$p140
+(void)
+
+702 
+	`hub
+();
+
+703 
+	`w140
+();
+
+706 void
+	$p141
+(void)
+
+707 
+	`hub
+();
+
+708 
+	`w141
+();
+
+711 void
+	$p142
+(void)
+
+712 
+	`hub
+();
+
+713 
+	`w142
+();
+
+716 void
+	$p143
+(void)
+
+717 
+	`hub
+();
+
+718 
+	`w143
+();
+
+721 void
+	$p144
+(void)
+
+722 
+	`hub
+();
+
+723 
+	`w144
+();
+
+726 void
+	$p145
+(void)
+
+727 
+	`hub
+();
+
+728 
+	`w145
+();
+
+731 void
+	$p146
+(void)
+
+732 
+	`hub
+();
+
+733 
+	`w146
+();
+
+736 void
+	$p147
+(void)
+
+737 
+	`hub
+();
+
+738 
+	`w147
+();
+
+741 void
+	$p148
+(void)
+
+742 
+	`hub
+();
+
+743 
+	`w148
+();
+
+746 void
+	$p149
+(void)
+
+747 
+	`hub
+();
+
+748 
+	`w149
+();
+
+751 void
+	$p150
+(void)
+
+752 
+	`hub
+();
+
+753 
+	`w150
+();
+
+756 void
+	$p151
+(void)
+
+757 
+	`hub
+();
+
+758 
+	`w151
+();
+
+761 void
+	$p152
+(void)
+
+762 
+	`hub
+();
+
+763 
+	`w152
+();
+
+766 void
+	$p153
+(void)
+
+767 
+	`hub
+();
+
+768 
+	`w153
+();
+
+771 void
+	$p154
+(void)
+
+772 
+	`hub
+();
+
+773 
+	`w154
+();
+
+776 void
+	$p155
+(void)
+
+777 
+	`hub
+();
+
+778 
+	`w155
+();
+
+781 void
+	$p156
+(void)
+
+782 
+	`hub
+();
+
+783 
+	`w156
+();
+
+786 void
+	$p157
+(void)
+
+787 
+	`hub
+();
+
+788 
+	`w157
+();
+
+791 void
+	$p158
+(void)
+
+792 
+	`hub
+();
+
+793 
+	`w158
+();
+
+796 void
+	$p159
+(void)
+
+797 
+	`hub
+();
+
+798 
+	`w159
+();
+
+801 void
+	$p160
+(void)
+
+802 
+	`hub
+();
+
+803 
+	`w160
+();
+
+806 void
+	$p161
+(void)
+
+807 
+	`hub
+();
+
+808 
+	`w161
+();
+
+811 void
+	$p162
+(void)
+
+812 
+	`hub
+();
+
+813 
+	`w162
+();
+
+816 void
+	$p163
+(void)
+
+817 
+	`hub
+();
+
+818 
+	`w163
+();
+
+821 void
+	$p164
+(void)
+
+822 
+	`hub
+();
+
+823 
+	`w164
+();
+
+826 void
+	$p165
+(void)
+
+827 
+	`hub
+();
+
+828 
+	`w165
+();
+
+831 void
+	$p166
+(void)
+
+832 
+	`hub
+();
+
+833 
+	`w166
+();
+
+836 void
+	$p167
+(void)
+
+837 
+	`hub
+();
+
+838 
+	`w167
+();
+
+841 void
+	$p168
+(void)
+
+842 
+	`hub
+();
+
+843 
+	`w168
+();
+
+846 void
+	$p169
+(void)
+
+847 
+	`hub
+();
+
+848 
+	`w169
+();
+
+851 void
+	$p170
+(void)
+
+852 
+	`hub
+();
+
+853 
+	`w170
+();
+
+856 void
+	$p171
+(void)
+
+857 
+	`hub
+();
+
+858 
+	`w171
+();
+
+861 void
+	$p172
+(void)
+
+862 
+	`hub
+();
+
+863 
+	`w172
+();
+
+866 void
+	$p173
+(void)
+
+867 
+	`hub
+();
+
+868 
+	`w173
+();
+
+871 void
+	$p174
+(void)
+
+872 
+	`hub
+();
+
+873 
+	`w174
+();
+
+876 void
+	$p175
+(void)
+
+877 
+	`hub
+();
+
+878 
+	`w175
+();
+
+881 void
+	$p176
+(void)
+
+882 
+	`hub
+();
+
+883 
+	`w176
+();
+
+886 void
+	$p177
+(void)
+
+887 
+	`hub
+();
+
+888 
+	`w177
+();
+
+891 void
+	$p178
+(void)
+
+892 
+	`hub
+();
+
+893 
+	`w178
+();
+
+896 void
+	$p179
+(void)
+
+897 
+	`hub
+();
+
+898 
+	`w179
+();
+
+901 void
+	$p180
+(void)
+
+902 
+	`hub
+();
+
+903 
+	`w180
+();
+
+906 void
+	$p181
+(void)
+
+907 
+	`hub
+();
+
+908 
+	`w181
+();
+
+911 void
+	$p182
+(void)
+
+912 
+	`hub
+();
+
+913 
+	`w182
+();
+
+916 void
+	$p183
+(void)
+
+917 
+	`hub
+();
+
+918 
+	`w183
+();
+
+921 void
+	$p184
+(void)
+
+922 
+	`hub
+();
+
+923 
+	`w184
+();
+
+926 void
+	$p185
+(void)
+
+927 
+	`hub
+();
+
+928 
+	`w185
+();
+
+931 void
+	$p186
+(void)
+
+932 
+	`hub
+();
+
+933 
+	`w186
+();
+
+936 void
+	$p187
+(void)
+
+937 
+	`hub
+();
+
+938 
+	`w187
+();
+
+941 void
+	$p188
+(void)
+
+942 
+	`hub
+();
+
+943 
+	`w188
+();
+
+946 void
+	$p189
+(void)
+
+947 
+	`hub
+();
+
+948 
+	`w189
+();
+
+951 void
+	$p190
+(void)
+
+952 
+	`hub
+();
+
+953 
+	`w190
+();
+
+956 void
+	$p191
+(void)
+
+957 
+	`hub
+();
+
+958 
+	`w191
+();
+
+961 void
+	$p192
+(void)
+
+962 
+	`hub
+();
+
+963 
+	`w192
+();
+
+966 void
+	$p193
+(void)
+
+967 
+	`hub
+();
+
+968 
+	`w193
+();
+
+971 void
+	$p194
+(void)
+
+972 
+	`hub
+();
+
+973 
+	`w194
+();
+
+976 void
+	$p195
+(void)
+
+977 
+	`hub
+();
+
+978 
+	`w195
+();
+
+981 void
+	$p196
+(void)
+
+982 
+	`hub
+();
+
+983 
+	`w196
+();
+
+986 void
+	$p197
+(void)
+
+987 
+	`hub
+();
+
+988 
+	`w197
+();
+
+991 void
+	$p198
+(void)
+
+992 
+	`hub
+();
+
+993 
+	`w198
+();
+
+996 void
+	$p199
+(void)
+
+997 
+	`hub
+();
+
+998 
+	`w199
+();
+
+1001 void
+	$p200
+(void)
+
+1002 
+	`hub
+();
+
+1003 
+	`w200
+();
+
+1006 void
+	$p201
+(void)
+
+1007 
+	`hub
+();
+
+1008 
+	`w201
+();
+
+1011 void
+	$p202
+(void)
+
+1012 
+	`hub
+();
+
+1013 
+	`w202
+();
+
+1016 void
+	$p203
+(void)
+
+1017 
+	`hub
+();
+
+1018 
+	`w203
+();
+
+1021 void
+	$p204
+(void)
+
+1022 
+	`hub
+();
+
+1023 
+	`w204
+();
+
+1026 void
+	$p205
+(void)
+
+1027 
+	`hub
+();
+
+1028 
+	`w205
+();
+
+1031 void
+	$p206
+(void)
+
+1032 
+	`hub
+();
+
+1033 
+	`w206
+();
+
+1036 void
+	$p207
+(void)
+
+1037 
+	`hub
+();
+
+1038 
+	`w207
+();
+
+1041 void
+	$p208
+(void)
+
+1042 
+	`hub
+();
+
+1043 
+	`w208
+();
+
+1046 void
+	$p209
+(void)
+
+1047 
+	`hub
+();
+
+1048 
+	`w209
+();
+
+1051 void
+	$p210
+(void)
+
+1052 
+	`hub
+();
+
+1053 
+	`w210
+();
+
+1056 void
+	$p211
+(void)
+
+1057 
+	`hub
+();
+
+1058 
+	`w211
+();
+
+1061 void
+	$p212
+(void)
+
+1062 
+	`hub
+();
+
+1063 
+	`w212
+();
+
+1066 void
+	$p213
+(void)
+
+1067 
+	`hub
+();
+
+1068 
+	`w213
+();
+
+1071 void
+	$p214
+(void)
+
+1072 
+	`hub
+();
+
+1073 
+	`w214
+();
+
+1076 void
+	$p215
+(void)
+
+1077 
+	`hub
+();
+
+1078 
+	`w215
+();
+
+1081 void
+	$p216
+(void)
+
+1082 
+	`hub
+();
+
+1083 
+	`w216
+();
+
+1086 void
+	$p217
+(void)
+
+1087 
+	`hub
+();
+
+1088 
+	`w217
+();
+
+1091 void
+	$p218
+(void)
+
+1092 
+	`hub
+();
+
+1093 
+	`w218
+();
+
+1096 void
+	$p219
+(void)
+
+1097 
+	`hub
+();
+
+1098 
+	`w219
+();
+
+1101 void
+	$p220
+(void)
+
+1102 
+	`hub
+();
+
+1103 
+	`w220
+();
+
+1106 void
+	$p221
+(void)
+
+1107 
+	`hub
+();
+
+1108 
+	`w221
+();
+
+1111 void
+	$p222
+(void)
+
+1112 
+	`hub
+();
+
+1113 
+	`w222
+();
+
+1116 void
+	$p223
+(void)
+
+1117 
+	`hub
+();
+
+1118 
+	`w223
+();
+
+1121 void
+	$p224
+(void)
+
+1122 
+	`hub
+();
+
+1123 
+	`w224
+();
+
+1126 void
+	$p225
+(void)
+
+1127 
+	`hub
+();
+
+1128 
+	`w225
+();
+
+1131 void
+	$p226
+(void)
+
+1132 
+	`hub
+();
+
+1133 
+	`w226
+();
+
+1136 void
+	$p227
+(void)
+
+1137 
+	`hub
+();
+
+1138 
+	`w227
+();
+
+1141 void
+	$p228
+(void)
+
+1142 
+	`hub
+();
+
+1143 
+	`w228
+();
+
+1146 void
+	$p229
+(void)
+
+1147 
+	`hub
+();
+
+1148 
+	`w229
+();
+
+1151 void
+	$p230
+(void)
+
+1152 
+	`hub
+();
+
+1153 
+	`w230
+();
+
+1156 void
+	$p231
+(void)
+
+1157 
+	`hub
+();
+
+1158 
+	`w231
+();
+
+1161 void
+	$p232
+(void)
+
+1162 
+	`hub
+();
+
+1163 
+	`w232
+();
+
+1166 void
+	$p233
+(void)
+
+1167 
+	`hub
+();
+
+1168 
+	`w233
+();
+
+1171 void
+	$p234
+(void)
+
+1172 
+	`hub
+();
+
+1173 
+	`w234
+();
+
+1176 void
+	$p235
+(void)
+
+1177 
+	`hub
+();
+
+1178 
+	`w235
+();
+
+1181 void
+	$p236
+(void)
+
+1182 
+	`hub
+();
+
+1183 
+	`w236
+();
+
+1186 void
+	$p237
+(void)
+
+1187 
+	`hub
+();
+
+1188 
+	`w237
+();
+
+1191 void
+	$p238
+(void)
+
+1192 
+	`hub
+();
+
+1193 
+	`w238
+();
+
+1196 void
+	$p239
+(void)
+
+1197 
+	`hub
+();
+
+1198 
+	`w239
+();
+
+1201 void
+	$p240
+(void)
+
+1202 
+	`hub
+();
+
+1203 
+	`w240
+();
+
+1206 void
+	$p241
+(void)
+
+1207 
+	`hub
+();
+
+1208 
+	`w241
+();
+
+1211 void
+	$p242
+(void)
+
+1212 
+	`hub
+();
+
+1213 
+	`w242
+();
+
+1216 void
+	$p243
+(void)
+
+1217 
+	`hub
+();
+
+1218 
+	`w243
+();
+
+1221 void
+	$p244
+(void)
+
+1222 
+	`hub
+();
+
+1223 
+	`w244
+();
+
+1226 void
+	$p245
+(void)
+
+1227 
+	`hub
+();
+
+1228 
+	`w245
+();
+
+1231 void
+	$p246
+(void)
+
+1232 
+	`hub
+();
+
+1233 
+	`w246
+();
+
+1236 void
+	$p247
+(void)
+
+1237 
+	`hub
+();
+
+1238 
+	`w247
+();
+
+1241 void
+	$p248
+(void)
+
+1242 
+	`hub
+();
+
+1243 
+	`w248
+();
+
+1246 void
+	$p249
+(void)
+
+1247 
+	`hub
+();
+
+1248 
+	`w249
+();
+
+1251 void
+	$p250
+(void)
+
+1252 
+	`hub
+();
+
+1253 
+	`w250
+();
+
+1256 void
+	$p251
+(void)
+
+1257 
+	`hub
+();
+
+1258 
+	`w251
+();
+
+1261 void
+	$p252
+(void)
+
+1262 
+	`hub
+();
+
+1263 
+	`w252
+();
+
+1266 void
+	$p253
+(void)
+
+1267 
+	`hub
+();
+
+1268 
+	`w253
+();
+
+1271 void
+	$p254
+(void)
+
+1272 
+	`hub
+();
+
+1273 
+	`w254
+();
+
+1276 void
+	$p255
+(void)
+
+1277 
+	`hub
+();
+
+1278 
+	`w255
+();
+
+1281 void
+	$p256
+(void)
+
+1282 
+	`hub
+();
+
+1283 
+	`w256
+();
+
+1286 void
+	$p257
+(void)
+
+1287 
+	`hub
+();
+
+1288 
+	`w257
+();
+
+1291 void
+	$p258
+(void)
+
+1292 
+	`hub
+();
+
+1293 
+	`w258
+();
+
+1296 void
+	$p259
+(void)
+
+1297 
+	`hub
+();
+
+1298 
+	`w259
+();
+
+1301 void
+	$p260
+(void)
+
+1302 
+	`hub
+();
+
+1303 
+	`w260
+();
+
+1306 void
+	$p261
+(void)
+
+1307 
+	`hub
+();
+
+1308 
+	`w261
+();
+
+1311 void
+	$p262
+(void)
+
+1312 
+	`hub
+();
+
+1313 
+	`w262
+();
+
+1316 void
+	$p263
+(void)
+
+1317 
+	`hub
+();
+
+1318 
+	`w263
+();
+
+1321 void
+	$p264
+(void)
+
+1322 
+	`hub
+();
+
+1323 
+	`w264
+();
+
+1326 void
+	$p265
+(void)
+
+1327 
+	`hub
+();
+
+1328 
+	`w265
+();
+
+1331 void
+	$p266
+(void)
+
+1332 
+	`hub
+();
+
+1333 
+	`w266
+();
+
+1336 void
+	$p267
+(void)
+
+1337 
+	`hub
+();
+
+1338 
+	`w267
+();
+
+1341 void
+	$p268
+(void)
+
+1342 
+	`hub
+();
+
+1343 
+	`w268
+();
+
+1346 void
+	$p269
+(void)
+
+1347 
+	`hub
+();
+
+1348 
+	`w269
+();
+
+1351 void
+	$p270
+(void)
+
+1352 
+	`hub
+();
+
+1353 
+	`w270
+();
+
+1356 void
+	$p271
+(void)
+
+1357 
+	`hub
+();
+
+1358 
+	`w271
+();
+
+1361 void
+	$p272
+(void)
+
+1362 
+	`hub
+();
+
+1363 
+	`w272
+();
+
+1366 void
+	$p273
+(void)
+
+1367 
+	`hub
+();
+
+1368 
+	`w273
+();
+
+1371 void
+	$p274
+(void)
+
+1372 
+	`hub
+();
+
+1373 
+	`w274
+();
+
+1376 void
+	$p275
+(void)
+
+1377 
+	`hub
+();
+
+1378 
+	`w275
+();
+
+1381 void
+	$p276
+(void)
+
+1382 
+	`hub
+();
+
+1383 
+	`w276
+();
+
+1386 void
+	$p277
+(void)
+
+1387 
+	`hub
+();
+
+1388 
+	`w277
+();
+
+1391 void
+	$p278
+(void)
+
+1392 
+	`hub
+();
+
+1393 
+	`w278
+();
+
+1396 void
+	$p279
+(void)
+
+1397 
+	`hub
+();
+
+1398 
+	`w279
+();
+
+1401 void
+	$p280
+(void)
+
+1402 
+	`hub
+();
+
+1403 
+	`w280
+();
+
+1406 void
+	$p281
+(void)
+
+1407 
+	`hub
+();
+
+1408 
+	`w281
+();
+
+1411 void
+	$p282
+(void)
+
+1412 
+	`hub
+();
+
+1413 
+	`w282
+();
+
+1416 void
+	$p283
+(void)
+
+1417 
+	`hub
+();
+
+1418 
+	`w283
+();
+
+1421 void
+	$p284
+(void)
+
+1422 
+	`hub
+();
+
+1423 
+	`w284
+();
+
+1426 void
+	$p285
+(void)
+
+1427 
+	`hub
+();
+
+1428 
+	`w285
+();
+
+1431 void
+	$p286
+(void)
+
+1432 
+	`hub
+();
+
+1433 
+	`w286
+();
+
+1436 void
+	$p287
+(void)
+
+1437 
+	`hub
+();
+
+1438 
+	`w287
+();
+
+1441 void
+	$p288
+(void)
+
+1442 
+	`hub
+();
+
+1443 
+	`w288
+();
+
+1446 void
+	$p289
+(void)
+
+1447 
+	`hub
+();
+
+1448 
+	`w289
+();
+
+1451 void
+	$p290
+(void)
+
+1452 
+	`hub
+();
+
+1453 
+	`w290
+();
+
+1456 void
+	$p291
+(void)
+
+1457 
+	`hub
+();
+
+1458 
+	`w291
+();
+
+1461 void
+	$p292
+(void)
+
+1462 
+	`hub
+();
+
+1463 
+	`w292
+();
+
+1466 void
+	$p293
+(void)
+
+1467 
+	`hub
+();
+
+1468 
+	`w293
+();
+
+1471 void
+	$p294
+(void)
+
+1472 
+	`hub
+();
+
+1473 
+	`w294
+();
+
+1476 void
+	$p295
+(void)
+
+1477 
+	`hub
+();
+
+1478 
+	`w295
+();
+
+1481 void
+	$p296
+(void)
+
+1482 
+	`hub
+();
+
+1483 
+	`w296
+();
+
+1486 void
+	$p297
+(void)
+
+1487 
+	`hub
+();
+
+1488 
+	`w297
+();
+
+1491 void
+	$p298
+(void)
+
+1492 
+	`hub
+();
+
+1493 
+	`w298
+();
+
+1496 void
+	$p299
+(void)
+
+1497 
+	`hub
+();
+
+1498 
+	`w299
+();
+
+1501 void
+	$p300
+(void)
+
+1502 
+	`hub
+();
+
+1503 
+	`w300
+();
+
+1506 void
+	$p301
+(void)
+
+1507 
+	`hub
+();
+
+1508 
+	`w301
+();
+
+1511 void
+	$p302
+(void)
+
+1512 
+	`hub
+();
+
+1513 
+	`w302
+();
+
+1516 void
+	$p303
+(void)
+
+1517 
+	`hub
+();
+
+1518 
+	`w303
+();
+
+1521 void
+	$p304
+(void)
+
+1522 
+	`hub
+();
+
+1523 
+	`w304
+();
+
+1526 void
+	$p305
+(void)
+
+1527 
+	`hub
+();
+
+1528 
+	`w305
+();
+
+1531 void
+	$p306
+(void)
+
+1532 
+	`hub
+();
+
+1533 
+	`w306
+();
+
+1536 void
+	$p307
+(void)
+
+1537 
+	`hub
+();
+
+1538 
+	`w307
+();
+
+1541 void
+	$p308
+(void)
+
+1542 
+	`hub
+();
+
+1543 
+	`w308
+();
+
+1546 void
+	$p309
+(void)
+
+1547 
+	`hub
+();
+
+1548 
+	`w309
+();
+
+1551 void
+	$p310
+(void)
+
+1552 
+	`hub
+();
+
+1553 
+	`w310
+();
+
+1556 void
+	$p311
+(void)
+
+1557 
+	`hub
+();
+
+1558 
+	`w311
+();
+
+1561 void
+	$p312
+(void)
+
+1562 
+	`hub
+();
+
+1563 
+	`w312
+();
+
+1566 void
+	$p313
+(void)
+
+1567 
+	`hub
+();
+
+1568 
+	`w313
+();
+
+1571 void
+	$p314
+(void)
+
+1572 
+	`hub
+();
+
+1573 
+	`w314
+();
+
+1576 void
+	$p315
+(void)
+
+1577 
+	`hub
+();
+
+1578 
+	`w315
+();
+
+1581 void
+	$p316
+(void)
+
+1582 
+	`hub
+();
+
+1583 
+	`w316
+();
+
+1586 void
+	$p317
+(void)
+
+1587 
+	`hub
+();
+
+1588 
+	`w317
+();
+
+1591 void
+	$p318
+(void)
+
+1592 
+	`hub
+();
+
+1593 
+	`w318
+();
+
+1596 void
+	$p319
+(void)
+
+1597 
+	`hub
+();
+
+1598 
+	`w319
+();
+
+1601 void
+	$p320
+(void)
+
+1602 
+	`hub
+();
+
+1603 
+	`w320
+();
+
+1606 void
+	$p321
+(void)
+
+1607 
+	`hub
+();
+
+1608 
+	`w321
+();
+
+1611 void
+	$p322
+(void)
+
+1612 
+	`hub
+();
+
+1613 
+	`w322
+();
+
+1616 void
+	$p323
+(void)
+
+1617 
+	`hub
+();
+
+1618 
+	`w323
+();
+
+1621 void
+	$p324
+(void)
+
+1622 
+	`hub
+();
+
+1623 
+	`w324
+();
+
+1626 void
+	$p325
+(void)
+
+1627 
+	`hub
+();
+
+1628 
+	`w325
+();
+
+1631 void
+	$p326
+(void)
+
+1632 
+	`hub
+();
+
+1633 
+	`w326
+();
+
+1636 void
+	$p327
+(void)
+
+1637 
+	`hub
+();
+
+1638 
+	`w327
+();
+
+1641 void
+	$p328
+(void)
+
+1642 
+	`hub
+();
+
+1643 
+	`w328
+();
+
+1646 void
+	$p329
+(void)
+
+1647 
+	`hub
+();
+
+1648 
+	`w329
+();
+
+1651 void
+	$p330
+(void)
+
+1652 
+	`hub
+();
+
+1653 
+	`w330
+();
+
+1656 void
+	$p331
+(void)
+
+1657 
+	`hub
+();
+
+1658 
+	`w331
+();
+
+1661 void
+	$p332
+(void)
+
+1662 
+	`hub
+();
+
+1663 
+	`w332
+();
+
+1666 void
+	$p333
+(void)
+
+1667 
+	`hub
+();
+
+1668 
+	`w333
+();
+
+1671 void
+	$p334
+(void)
+
+1672 
+	`hub
+();
+
+1673 
+	`w334
+();
+
+1676 void
+	$p335
+(void)
+
+1677 
+	`hub
+();
+
+1678 
+	`w335
+();
+
+1681 void
+	$p336
+(void)
+
+1682 
+	`hub
+();
+
+1683 
+	`w336
+();
+
+1686 void
+	$p337
+(void)
+
+1687 
+	`hub
+();
+
+1688 
+	`w337
+();
+
+1691 void
+	$p338
+(void)
+
+1692 
+	`hub
+();
+
+1693 
+	`w338
+();
+
+1696 void
+	$p339
+(void)
+
+1697 
+	`hub
+();
+
+1698 
+	`w339
+();
+
+1701 void
+	$p340
+(void)
+
+1702 
+	`hub
+();
+
+1703 
+	`w340
+();
+
+1706 void
+	$p341
+(void)
+
+1707 
+	`hub
+();
+
+1708 
+	`w341
+();
+
+1711 void
+	$p342
+(void)
+
+1712 
+	`hub
+();
+
+1713 
+	`w342
+();
+
+1716 void
+	$p343
+(void)
+
+1717 
+	`hub
+();
+
+1718 
+	`w343
+();
+
+1721 void
+	$p344
+(void)
+
+1722 
+	`hub
+();
+
+1723 
+	`w344
+();
+
+1726 void
+	$p345
+(void)
+
+1727 
+	`hub
+();
+
+1728 
+	`w345
+();
+
+1731 void
+	$p346
+(void)
+
+1732 
+	`hub
+();
+
+1733 
+	`w346
+();
+
+1736 void
+	$p347
+(void)
+
+1737 
+	`hub
+();
+
+1738 
+	`w347
+();
+
+1741 void
+	$p348
+(void)
+
+1742 
+	`hub
+();
+
+1743 
+	`w348
+();
+
+1746 void
+	$p349
+(void)
+
+1747 
+	`hub
+();
+
+1748 
+	`w349
+();
+
+1751 void
+	$p350
+(void)
+
+1752 
+	`hub
+();
+
+1753 
+	`w350
+();
+
+1756 void
+	$p351
+(void)
+
+1757 
+	`hub
+();
+
+1758 
+	`w351
+();
+
+1761 void
+	$p352
+(void)
+
+1762 
+	`hub
+();
+
+1763 
+	`w352
+();
+
+1766 void
+	$p353
+(void)
+
+1767 
+	`hub
+();
+
+1768 
+	`w353
+();
+
+1771 void
+	$p354
+(void)
+
+1772 
+	`hub
+();
+
+1773 
+	`w354
+();
+
+1776 void
+	$p355
+(void)
+
+1777 
+	`hub
+();
+
+1778 
+	`w355
+();
+
+1781 void
+	$p356
+(void)
+
+1782 
+	`hub
+();
+
+1783 
+	`w356
+();
+
+1786 void
+	$p357
+(void)
+
+1787 
+	`hub
+();
+
+1788 
+	`w357
+();
+
+1791 void
+	$p358
+(void)
+
+1792 
+	`hub
+();
+
+1793 
+	`w358
+();
+
+1796 void
+	$p359
+(void)
+
+1797 
+	`hub
+();
+
+1798 
+	`w359
+();
+
+1801 void
+	$p360
+(void)
+
+1802 
+	`hub
+();
+
+1803 
+	`w360
+();
+
+1806 void
+	$p361
+(void)
+
+1807 
+	`hub
+();
+
+1808 
+	`w361
+();
+
+1811 void
+	$p362
+(void)
+
+1812 
+	`hub
+();
+
+1813 
+	`w362
+();
+
+1816 void
+	$p363
+(void)
+
+1817 
+	`hub
+();
+
+1818 
+	`w363
+();
+
+1821 void
+	$p364
+(void)
+
+1822 
+	`hub
+();
+
+1823 
+	`w364
+();
+
+1826 void
+	$p365
+(void)
+
+1827 
+	`hub
+();
+
+1828 
+	`w365
+();
+
+1831 void
+	$p366
+(void)
+
+1832 
+	`hub
+();
+
+1833 
+	`w366
+();
+
+1836 void
+	$p367
+(void)
+
+1837 
+	`hub
+();
+
+1838 
+	`w367
+();
+
+1841 void
+	$p368
+(void)
+
+1842 
+	`hub
+();
+
+1843 
+	`w368
+();
+
+1846 void
+	$p369
+(void)
+
+1847 
+	`hub
+();
+
+1848 
+	`w369
+();
+
+1851 void
+	$p370
+(void)
+
+1852 
+	`hub
+();
+
+1853 
+	`w370
+();
+
+1856 void
+	$p371
+(void)
+
+1857 
+	`hub
+();
+
+1858 
+	`w371
+();
+
+1861 void
+	$p372
+(void)
+
+1862 
+	`hub
+();
+
+1863 
+	`w372
+();
+
+1866 void
+	$p373
+(void)
+
+1867 
+	`hub
+();
+
+1868 
+	`w373
+();
+
+1871 void
+	$p374
+(void)
+
+1872 
+	`hub
+();
+
+1873 
+	`w374
+();
+
+1876 void
+	$p375
+(void)
+
+1877 
+	`hub
+();
+
+1878 
+	`w375
+();
+
+1881 void
+	$p376
+(void)
+
+1882 
+	`hub
+();
+
+1883 
+	`w376
+();
+
+1886 void
+	$p377
+(void)
+
+1887 
+	`hub
+();
+
+1888 
+	`w377
+();
+
+1891 void
+	$p378
+(void)
+
+1892 
+	`hub
+();
+
+1893 
+	`w378
+();
+
+1896 void
+	$p379
+(void)
+
+1897 
+	`hub
+();
+
+1898 
+	`w379
+();
+
+1901 void
+	$p380
+(void)
+
+1902 
+	`hub
+();
+
+1903 
+	`w380
+();
+
+1906 void
+	$p381
+(void)
+
+1907 
+	`hub
+();
+
+1908 
+	`w381
+();
+
+1911 void
+	$p382
+(void)
+
+1912 
+	`hub
+();
+
+1913 
+	`w382
+();
+
+1916 void
+	$p383
+(void)
+
+1917 
+	`hub
+();
+
+1918 
+	`w383
+();
+
+1921 void
+	$p384
+(void)
+
+1922 
+	`hub
+();
+
+1923 
+	`w384
+();
+
+1926 void
+	$p385
+(void)
+
+1927 
+	`hub
+();
+
+1928 
+	`w385
+();
+
+1931 void
+	$p386
+(void)
+
+1932 
+	`hub
+();
+
+1933 
+	`w386
+();
+
+1936 void
+	$p387
+(void)
+
+1937 
+	`hub
+();
+
+1938 
+	`w387
+();
+
+1941 void
+	$p388
+(void)
+
+1942 
+	`hub
+();
+
+1943 
+	`w388
+();
+
+1946 void
+	$p389
+(void)
+
+1947 
+	`hub
+();
+
+1948 
+	`w389
+();
+
+1951 void
+	$p390
+(void)
+
+1952 
+	`hub
+();
+
+1953 
+	`w390
+();
+
+1956 void
+	$p391
+(void)
+
+1957 
+	`hub
+();
+
+1958 
+	`w391
+();
+
+1961 void
+	$p392
+(void)
+
+1962 
+	`hub
+();
+
+1963 
+	`w392
+();
+
+1966 void
+	$p393
+(void)
+
+1967 
+	`hub
+();
+
+1968 
+	`w393
+();
+
+1971 void
+	$p394
+(void)
+
+1972 
+	`hub
+();
+
+1973 
+	`w394
+();
+
+1976 void
+	$p395
+(void)
+
+1977 
+	`hub
+();
+
+1978 
+	`w395
+();
+
+1981 void
+	$p396
+(void)
+
+1982 
+	`hub
+();
+
+1983 
+	`w396
+();
+
+1986 void
+	$p397
+(void)
+
+1987 
+	`hub
+();
+
+1988 
+	`w397
+();
+
+1991 void
+	$p398
+(void)
+
+1992 
+	`hub
+();
+
+1993 
+	`w398
+();
+
+1996 void
+	$p399
+(void)
+
+1997 
+	`hub
+();
+
+1998 
+	`w399
+();
+
+	@w.c
+
+1 void
+	$w0
+(void)
+
+4 void
+	$w1
+(void)
+
+5 
+	`leaf
+();
+
+8 void
+	$w2
+(void)
+
+9 
+	`leaf
+();
+
+12 void
+	$w3
+(void)
+
+15 void
+	$w4
+(void)
+
+16 
+	`leaf
+();
+
+19 void
+	$w5
+(void)
+
+20 
+	`leaf
+();
+
+23 void
+	$w6
+(void)
+
+26 void
+	$w7
+(void)
+
+27 
+	`leaf
+();
+
+30 void
+	$w8
+(void)
+
+31 
+	`leaf
+();
+
+34 void
+	$w9
+(void)
+
+37 void
+	$w10
+(void)
+
+38 
+	`leaf
+();
+
+41 void
+	$w11
+(void)
+
+42 
+	`leaf
+();
+
+45 void
+	$w12
+(void)
+
+48 void
+	$w13
+(void)
+
+49 
+	`leaf
+();
+
+52 void
+	$w14
+(void)
+
+53 
+	`leaf
+();
+
+56 void
+	$w15
+(void)
+
+59 void
+	$w16
+(void)
+
+60 
+	`leaf
+();
+
+63 void
+	$w17
+(void)
+
+64 
+	`leaf
+();
+
+67 void
+	$w18
+(void)
+
+70 void
+	$w19
+(void)
+
+71 
+	`leaf
+();
+
+74 void
+	$w20
+(void)
+
+75 
+	`leaf
+();
+
+78 void
+	$w21
+(void)
+
+81 void
+	$w22
+(void)
+
+82 
+	`leaf
+();
+
+85 void
+	$w23
+(void)
+
+86 
+	`leaf
+();
+
+89 void
+	$w24
+(void)
+
+92 void
+	$w25
+(void)
+
+93 
+	`leaf
+();
+
+96 void
+	$w26
+(void)
+
+97 
+	`leaf
+();
+
+100 void
+	$w27
+(void)
+
+103 void
+	$w28
+(void)
+
+104 
+	`leaf
+();
+
+107 void
+	$w29
+(void)
+
+108 
+	`leaf
+();
+
+111 void
+	$w30
+(void)
+
+114 void
+	$w31
+(void)
+
+115 
+	`leaf
+();
+
+118 void
+	$w32
+(void)
+
+119 
+	`leaf
+();
+
+122 void
+	$w33
+(void)
+
+125 void
+	$w34
+(void)
+
+126 
+	`leaf
+();
+
+129 void
+	$w35
+(void)
+
+130 
+	`leaf
+();
+
+133 void
+	$w36
+(void)
+
+136 void
+	$w37
+(void)
+
+137 
+	`leaf
+();
+
+140 void
+	$w38
+(void)
+
+141 
+	`leaf
+();
+
+144 void
+	$w39
+(void)
+
+147 void
+	$w40
+(void)
+
+148 
+	`leaf
+();
+
+151 void
+	$w41
+(void)
+
+152 
+	`leaf
+();
+
+155 void
+	$w42
+(void)
+
+158 void
+	$w43
+(void)
+
+159 
+	`leaf
+();
+
+162 void
+	$w44
+(void)
+
+163 
+	`leaf
+();
+
+166 void
+	$w45
+(void)
+
+169 void
+	$w46
+(void)
+
+170 
+	`leaf
+();
+
+173 void
+	$w47
+(void)
+
+174 
+	`leaf
+();
+
+177 void
+	$w48
+(void)
+
+180 void
+	$w49
+(void)
+
+181 
+	`leaf
+();
+
+184 void
+	$w50
+(void)
+
+185 
+	`leaf
+();
+
+188 void
+	$w51
+(void)
+
+191 void
+	$w52
+(void)
+
+192 
+	`leaf
+();
+
+195 void
+	$w53
+(void)
+
+196 
+	`leaf
+();
+
+199 void
+	$w54
+(void)
+
+202 void
+	$w55
+(void)
+
+203 
+	`leaf
+();
+
+206 void
+	$w56
+(void)
+
+207 
+	`leaf
+();
+
+210 void
+	$w57
+(void)
+
+213 void
+	$w58
+(void)
+
+214 
+	`leaf
+();
+
+217 void
+	$w59
+(void)
+
+218 
+	`leaf
+();
+
+221 void
+	$w60
+(void)
+
+224 void
+	$w61
+(void)
+
+225 
+	`leaf
+();
+
+228 void
+	$w62
+(void)
+
+229 
+	`leaf
+();
+
+232 void
+	$w63
+(void)
+
+235 void
+	$w64
+(void)
+
+236 
+	`leaf
+();
+
+239 void
+	$w65
+(void)
+
+240 
+	`leaf
+();
+
+243 void
+	$w66
+(void)
+
+246 void
+	$w67
+(void)
+
+247 
+	`leaf
+();
+
+250 void
+	$w68
+(void)
+
+251 
+	`leaf
+();
+
+254 void
+	$w69
+(void)
+
+257 void
+	$w70
+(void)
+
+258 
+	`leaf
+();
+
+261 void
+	$w71
+(void)
+
+262 
+	`leaf
+();
+
+265 void
+	$w72
+(void)
+
+268 void
+	$w73
+(void)
+
+269 
+	`leaf
+();
+
+272 void
+	$w74
+(void)
+
+273 
+	`leaf
+();
+
+276 void
+	$w75
+(void)
+
+279 void
+	$w76
+(void)
+
+280 
+	`leaf
+();
+
+283 void
+	$w77
+(void)
+
+284 
+	`leaf
+();
+
+287 void
+	$w78
+(void)
+
+290 void
+	$w79
+(void)
+
+291 
+	`leaf
+();
+
+294 void
+	$w80
+(void)
+
+295 
+	`leaf
+();
+
+298 void
+	$w81
+(void)
+
+301 void
+	$w82
+(void)
+
+302 
+	`leaf
+();
+
+305 void
+	$w83
+(void)
+
+306 
+	`leaf
+();
+
+309 void
+	$w84
+(void)
+
+312 void
+	$w85
+(void)
+
+313 
+	`leaf
+();
+
+316 void
+	$w86
+(void)
+
+317 
+	`leaf
+();
+
+320 void
+	$w87
+(void)
+
+323 void
+	$w88
+(void)
+
+324 
+	`leaf
+();
+
+327 void
+	$w89
+(void)
+
+328 
+	`leaf
+();
+
+331 void
+	$w90
+(void)
+
+334 void
+	$w91
+(void)
+
+335 
+	`leaf
+();
+
+338 void
+	$w92
+(void)
+
+339 
+	`leaf
+();
+
+342 void
+	$w93
+(void)
+
+345 void
+	$w94
+(void)
+
+346 
+	`leaf
+();
+
+349 void
+	$w95
+(void)
+
+350 
+	`leaf
+();
+
+353 void
+	$w96
+(void)
+
+356 void
+	$w97
+(void)
+
+357 
+	`leaf
+();
+
+360 void
+	$w98
+(void)
+
+361 
+	`leaf
+();
+
+364 void
+	$w99
+(void)
+
+367 void
+	$w100
+(void)
+
+368 
+	`leaf
+();
+
+371 void
+	$w101
+(void)
+
+372 
+	`leaf
+();
+
+375 void
+	$w102
+(void)
+
+378 void
+	$w103
+(void)
+
+379 
+	`leaf
+();
+
+382 void
+	$w104
+(void)
+
+383 
+	`leaf
+();
+
+386 void
+	$w105
+(void)
+
+389 void
+	$w106
+(void)
+
+390 
+	`leaf
+();
+
+393 void
+	$w107
+(void)
+
+394 
+	`leaf
+();
+
+397 void
+	$w108
+(void)
+
+400 void
+	$w109
+(void)
+
+401 
+	`leaf
+();
+
+404 void
+	$w110
+(void)
+
+405 
+	`leaf
+();
+
+408 void
+	$w111
+(void)
+
+411 void
+	$w112
+(void)
+
+412 
+	`leaf
+();
+
+415 void
+	$w113
+(void)
+
+416 
+	`leaf
+();
+
+419 void
+	$w114
+(void)
+
+422 void
+	$w115
+(void)
+
+423 
+	`leaf
+();
+
+426 void
+	$w116
+(void)
+
+427 
+	`leaf
+();
+
+430 void
+	$w117
+(void)
+
+433 void
+	$w118
+(void)
+
+434 
+	`leaf
+();
+
+437 void
+	$w119
+(void)
+
+438 
+	`leaf
+();
+
+441 void
+	$w120
+(void)
+
+444 void
+	$w121
+(void)
+
+445 
+	`leaf
+();
+
+448 void
+	$w122
+(void)
+
+449 
+	`leaf
+();
+
+452 void
+	$w123
+(void)
+
+455 void
+	$w124
+(void)
+
+456 
+	`leaf
+();
+
+459 void
+	$w125
+(void)
+
+460 
+	`leaf
+();
+
+463 void
+	$w126
+(void)
+
+466 void
+	$w127
+(void)
+
+467 
+	`leaf
+();
+
+470 void
+	$w128
+(void)
+
+471 
+	`leaf
+();
+
+474 void
+	$w129
+(void)
+
+477 void
+	$w130
+(void)
+
+478 
+	`leaf
+();
+
+481 void
+	$w131
+(void)
+
+482 
+	`leaf
+();
+
+485 void
+	$w132
+(void)
+
+488 void
+	$w133
+(void)
+
+489 
+	`leaf
+();
+
+492 void
+	$w134
+(void)
+
+493 
+	`leaf
+();
+
+496 void
+	$w135
+(void)
+
+499 void
+	$w136
+(void)
+
+500 
+	`leaf
+();
+
+503 void
+	$w137
+(void)
+
+504 
+	`leaf
+();
+
+507 void
+	$w138
+(void)
+
+510 void
+	$w139
+(void)
+
+511 
+	`leaf
+();
+
+514 void
+	$w140
+(void)
+
+515 
+	`leaf
+();
+
+518 void
+	$w141
+(void)
+
+521 void
+	$w142
+(void)
+
+522 
+	`leaf
+();
+
+525 void
+	$w143
+(void)
+
+526 
+	`leaf
+();
+
+529 void
+	$w144
+(void)
+
+532 void
+	$w145
+(void)
+
+533 
+	`leaf
+();
+
+536 void
+	$w146
+(void)
+
+537 
+	`leaf
+();
+
+540 void
+	$w147
+(void)
+
+543 void
+	$w148
+(void)
+
+544 
+	`leaf
+();
+
+547 void
+	$w149
+(void)
+
+548 
+	`leaf
+();
+
+551 void
+	$w150
+(void)
+
+554 void
+	$w151
+(void)
+
+555 
+	`leaf
+();
+
+558 void
+	$w152
+(void)
+
+559 
+	`leaf
+();
+
+562 void
+	$w153
+(void)
+
+565 void
+	$w154
+(void)
+
+566 
+	`leaf
+();
+
+569 void
+	$w155
+(void)
+
+570 
+	`leaf
+();
+
+573 void
+	$w156
+(void)
+
+576 void
+	$w157
+(void)
+
+577 
+	`leaf
+();
+
+580 void
+	$w158
+(void)
+
+581 
+	`leaf
+();
+
+584 void
+	$w159
+(void)
+
+587 void
+	$w160
+(void)
+
+588 
+	`leaf
+();
+
+591 void
+	$w161
+(void)
+
+592 
+	`leaf
+();
+
+595 void
+	$w162
+(void)
+
+598 void
+	$w163
+(void)
+
+599 
+	`leaf
+();
+
+602 void
+	$w164
+(void)
+
+603 
+	`leaf
+();
+
+606 void
+	$w165
+(void)
+
+609 void
+	$w166
+(void)
+
+610 
+	`leaf
+();
+
+613 void
+	$w167
+(void)
+
+614 
+	`leaf
+();
+
+617 void
+	$w168
+(void)
+
+620 void
+	$w169
+(void)
+
+621 
+	`leaf
+();
+
+624 void
+	$w170
+(void)
+
+625 
+	`leaf
+();
+
+628 void
+	$w171
+(void)
+
+631 void
+	$w172
+(void)
+
+632 
+	`leaf
+();
+
+635 void
+	$w173
+(void)
+
+636 
+	`leaf
+();
+
+639 void
+	$w174
+(void)
+
+642 void
+	$w175
+(void)
+
+643 
+	`leaf
+();
+
+646 void
+	$w176
+(void)
+
+647 
+	`leaf
+();
+
+650 void
+	$w177
+(void)
+
+653 void
+	$w178
+(void)
+
+654 
+	`leaf
+();
+
+657 void
+	$w179
+(void)
+
+658 
+	`leaf
+();
+
+661 void
+	$w180
+(void)
+
+664 void
+	$w181
+(void)
+
+665 
+	`leaf
+();
+
+668 void
+	$w182
+(void)
+
+669 
+	`leaf
+();
+
+672 void
+	$w183
+(void)
+
+675 void
+	$w184
+(void)
+
+676 
+	`leaf
+();
+
+679 void
+	$w185
+(void)
+
+680 
+	`leaf
+();
+
+683 void
+	$w186
+(void)
+
+686 void
+	$w187
+(void)
+
+687 
+	`leaf
+();
+
+690 void
+	$w188
+(void)
+
+691 
+	`leaf
+();
+
+694 void
+	$w189
+(void)
+
+697 void
+	$w190
+(void)
+
+698 
+	`leaf
+();
+
+701 void
+	$w191
+(void)
+
+702 
+	`leaf
+();
+
+705 void
+	$w192
+(void)
+
+708 void
+	$w193
+(void)
+
+709 
+	`leaf
+();
+
+712 void
+	$w194
+(void)
+
+713 
+	`leaf
+();
+
+716 void
+	$w195
+(void)
+
+719 void
+	$w196
+(void)
+
+720 
+	`leaf
+();
+
+723 void
+	$w197
+(void)
+
+724 
+	`leaf
+();
+
+727 void
+	$w198
+(void)
+
+730 void
+	$w199
+(void)
+
+731 
+	`leaf
+();
+
+734 void
+	$w200
+(void)
+
+735 
+	`leaf
+();
+
+738 void
+	$w201
+(void)
+
+741 void
+	$w202
+(void)
+
+742 
+	`leaf
+();
+
+745 void
+	$w203
+(void)
+
+746 
+	`leaf
+();
+
+749 void
+	$w204
+(void)
+
+752 void
+	$w205
+(void)
+
+753 
+	`leaf
+();
+
+756 void
+	$w206
+(void)
+
+757 
+	`leaf
+();
+
+760 void
+	$w207
+(void)
+
+763 void
+	$w208
+(void)
+
+764 
+	`leaf
+();
+
+767 void
+	$w209
+(void)
+
+768 
+	`leaf
+();
+
+771 void
+	$w210
+(void)
+
+774 void
+	$w211
+(void)
+
+775 
+	`leaf
+();
+
+778 void
+	$w212
+(void)
+
+779 
+	`leaf
+();
+
+782 void
+	$w213
+(void)
+
+785 void
+	$w214
+(void)
+
+786 
+	`leaf
+();
+
+789 void
+	$w215
+(void)
+
+790 
+	`leaf
+();
+
+793 void
+	$w216
+(void)
+
+796 void
+	$w217
+(void)
+
+797 
+	`leaf
+();
+
+800 void
+	$w218
+(void)
+
+801 
+	`leaf
+();
+
+804 void
+	$w219
+(void)
+
+807 void
+	$w220
+(void)
+
+808 
+	`leaf
+();
+
+811 void
+	$w221
+(void)
+
+812 
+	`leaf
+();
+
+815 void
+	$w222
+(void)
+
+818 void
+	$w223
+(void)
+
+819 
+	`leaf
+();
+
+822 void
+	$w224
+(void)
+
+823 
+	`leaf
+();
+
+826 void
+	$w225
+(void)
+
+829 void
+	$w226
+(void)
+
+830 
+	`leaf
+();
+
+833 void
+	$w227
+(void)
+
+834 
+	`leaf
+();
+
+837 void
+	$w228
+(void)
+
+840 void
+	$w229
+(void)
+
+841 
+	`leaf
+();
+
+844 void
+	$w230
+(void)
+
+845 
+	`leaf
+();
+
+848 void
+	$w231
+(void)
+
+851 void
+	$w232
+(void)
+
+852 
+	`leaf
+();
+
+855 void
+	$w233
+(void)
+
+856 
+	`leaf
+();
+
+859 void
+	$w234
+(void)
+
+862 void
+	$w235
+(void)
+
+863 
+	`leaf
+();
+
+866 void
+	$w236
+(void)
+
+867 
+	`leaf
+();
+
+870 void
+	$w237
+(void)
+
+873 void
+	$w238
+(void)
+
+874 
+	`leaf
+();
+
+877 void
+	$w239
+(void)
+
+878 
+	`leaf
+();
+
+881 void
+	$w240
+(void)
+
+884 void
+	$w241
+(void)
+
+885 
+	`leaf
+();
+
+888 void
+	$w242
+(void)
+
+889 
+	`leaf
+();
+
+892 void
+	$w243
+(void)
+
+895 void
+	$w244
+(void)
+
+896 
+	`leaf
+();
+
+899 void
+	$w245
+(void)
+
+900 
+	`leaf
+();
+
+903 void
+	$w246
+(void)
+
+906 void
+	$w247
+(void)
+
+907 
+	`leaf
+();
+
+910 void
+	$w248
+(void)
+
+911 
+	`leaf
+();
+
+914 void
+	$w249
+(void)
+
+917 void
+	$w250
+(void)
+
+918 
+	`leaf
+();
+
+921 void
+	$w251
+(void)
+
+922 
+	`leaf
+();
+
+925 void
+	$w252
+(void)
+
+928 void
+	$w253
+(void)
+
+929 
+	`leaf
+();
+
+932 void
+	$w254
+(void)
+
+933 
+	`leaf
+();
+
+936 void
+	$w255
+(void)
+
+939 void
+	$w256
+(void)
+
+940 
+	`leaf
+();
+
+943 void
+	$w257
+(void)
+
+944 
+	`leaf
+();
+
+947 void
+	$w258
+(void)
+
+950 void
+	$w259
+(void)
+
+951 
+	`leaf
+();
+
+954 void
+	$w260
+(void)
+
+955 
+	`leaf
+();
+
+958 void
+	$w261
+(void)
+
+961 void
+	$w262
+(void)
+
+962 
+	`leaf
+();
+
+965 void
+	$w263
+(void)
+
+966 
+	`leaf
+();
+
+969 void
+	$w264
+(void)
+
+972 void
+	$w265
+(void)
+
+973 
+	`leaf
+();
+
+976 void
+	$w266
+(void)
+
+977 
+	`leaf
+();
+
+980 void
+	$w267
+(void)
+
+983 void
+	$w268
+(void)
+
+984 
+	`leaf
+();
+
+987 void
+	$w269
+(void)
+
+988 
+	`leaf
+();
+
+991 void
+	$w270
+(void)
+
+994 void
+	$w271
+(void)
+
+995 
+	`leaf
+();
+
+998 void
+	$w272
+(void)
+
+999 
+	`leaf
+();
+
+1002 void
+	$w273
+(void)
+
+1005 void
+	$w274
+(void)
+
+1006 
+	`leaf
+();
+
+1009 void
+	$w275
+(void)
+
+1010 
+	`leaf
+();
+
+1013 void
+	$w276
+(void)
+
+1016 void
+	$w277
+(void)
+
+1017 
+	`leaf
+();
+
+1020 void
+	$w278
+(void)
+
+1021 
+	`leaf
+();
+
+1024 void
+	$w279
+(void)
+
+1027 void
+	$w280
+(void)
+
+1028 
+	`leaf
+();
+
+1031 void
+	$w281
+(void)
+
+1032 
+	`leaf
+();
+
+1035 void
+	$w282
+(void)
+
+1038 void
+	$w283
+(void)
+
+1039 
+	`leaf
+();
+
+1042 void
+	$w284
+(void)
+
+1043 
+	`leaf
+();
+
+1046 void
+	$w285
+(void)
+
+1049 void
+	$w286
+(void)
+
+1050 
+	`leaf
+();
+
+1053 void
+	$w287
+(void)
+
+1054 
+	`leaf
+();
+
+1057 void
+	$w288
+(void)
+
+1060 void
+	$w289
+(void)
+
+1061 
+	`leaf
+();
+
+1064 void
+	$w290
+(void)
+
+1065 
+	`leaf
+();
+
+1068 void
+	$w291
+(void)
+
+1071 void
+	$w292
+(void)
+
+1072 
+	`leaf
+();
+
+1075 void
+	$w293
+(void)
+
+1076 
+	`leaf
+();
+
+1079 void
+	$w294
+(void)
+
+1082 void
+	$w295
+(void)
+
+1083 
+	`leaf
+();
+
+1086 void
+	$w296
+(void)
+
+1087 
+	`leaf
+();
+
+1090 void
+	$w297
+(void)
+
+1093 void
+	$w298
+(void)
+
+1094 
+	`leaf
+();
+
+1097 void
+	$w299
+(void)
+
+1098 
+	`leaf
+();
+
+1101 void
+	$w300
+(void)
+
+1104 void
+	$w301
+(void)
+
+1105 
+	`leaf
+();
+
+1108 void
+	$w302
+(void)
+
+1109 
+	`leaf
+();
+
+1112 void
+	$w303
+(void)
+
+1115 void
+	$w304
+(void)
+
+1116 
+	`leaf
+();
+
+1119 void
+	$w305
+(void)
+
+1120 
+	`leaf
+();
+
+1123 void
+	$w306
+(void)
+
+1126 void
+	$w307
+(void)
+
+1127 
+	`leaf
+();
+
+1130 void
+	$w308
+(void)
+
+1131 
+	`leaf
+();
+
+1134 void
+	$w309
+(void)
+
+1137 void
+	$w310
+(void)
+
+1138 
+	`leaf
+();
+
+1141 void
+	$w311
+(void)
+
+1142 
+	`leaf
+();
+
+1145 void
+	$w312
+(void)
+
+1148 void
+	$w313
+(void)
+
+1149 
+	`leaf
+();
+
+1152 void
+	$w314
+(void)
+
+1153 
+	`leaf
+();
+
+1156 void
+	$w315
+(void)
+
+1159 void
+	$w316
+(void)
+
+1160 
+	`leaf
+();
+
+1163 void
+	$w317
+(void)
+
+1164 
+	`leaf
+();
+
+1167 void
+	$w318
+(void)
+
+1170 void
+	$w319
+(void)
+
+1171 
+	`leaf
+();
+
+1174 void
+	$w320
+(void)
+
+1175 
+	`leaf
+();
+
+1178 void
+	$w321
+(void)
+
+1181 void
+	$w322
+(void)
+
+1182 
+	`leaf
+();
+
+1185 void
+	$w323
+(void)
+
+1186 
+	`leaf
+();
+
+1189 void
+	$w324
+(void)
+
+1192 void
+	$w325
+(void)
+
+1193 
+	`leaf
+();
+
+1196 void
+	$w326
+(void)
+
+1197 
+	`leaf
+();
+
+1200 void
+	$w327
+(void)
+
+1203 void
+	$w328
+(void)
+
+1204 
+	`leaf
+();
+
+1207 void
+	$w329
+(void)
+
+1208 
+	`leaf
+();
+
+1211 void
+	$w330
+(void)
+
+1214 void
+	$w331
+(void)
+
+1215 
+	`leaf
+();
+
+1218 void
+	$w332
+(void)
+
+1219 
+	`leaf
+();
+
+1222 void
+	$w333
+(void)
+
+1225 void
+	$w334
+(void)
+
+1226 
+	`leaf
+();
+
+1229 void
+	$w335
+(void)
+
+1230 
+	`leaf
+();
+
+1233 void
+	$w336
+(void)
+
+1236 void
+	$w337
+(void)
+
+1237 
+	`leaf
+();
+
+1240 void
+	$w338
+(void)
+
+1241 
+	`leaf
+();
+
+1244 void
+	$w339
+(void)
+
+1247 void
+	$w340
+(void)
+
+1248 
+	`leaf
+();
+
+1251 void
+	$w341
+(void)
+
+1252 
+	`leaf
+();
+
+1255 void
+	$w342
+(void)
+
+1258 void
+	$w343
+(void)
+
+1259 
+	`leaf
+();
+
+1262 void
+	$w344
+(void)
+
+1263 
+	`leaf
+();
+
+1266 void
+	$w345
+(void)
+
+1269 void
+	$w346
+(void)
+
+1270 
+	`leaf
+();
+
+1273 void
+	$w347
+(void)
+
+1274 
+	`leaf
+();
+
+1277 void
+	$w348
+(void)
+
+1280 void
+	$w349
+(void)
+
+1281 
+	`leaf
+();
+
+1284 void
+	$w350
+(void)
+
+1285 
+	`leaf
+();
+
+1288 void
+	$w351
+(void)
+
+1291 void
+	$w352
+(void)
+
+1292 
+	`leaf
+();
+
+1295 void
+	$w353
+(void)
+
+1296 
+	`leaf
+();
+
+1299 void
+	$w354
+(void)
+
+1302 void
+	$w355
+(void)
+
+1303 
+	`leaf
+();
+
+1306 void
+	$w356
+(void)
+
+1307 
+	`leaf
+();
+
+1310 void
+	$w357
+(void)
+
+1313 void
+	$w358
+(void)
+
+1314 
+	`leaf
+();
+
+1317 void
+	$w359
+(void)
+
+1318 
+	`leaf
+();
+
+1321 void
+	$w360
+(void)
+
+1324 void
+	$w361
+(void)
+
+1325 
+	`leaf
+();
+
+1328 void
+	$w362
+(void)
+
+1329 
+	`leaf
+();
+
+1332 void
+	$w363
+(void)
+
+1335 void
+	$w364
+(void)
+
+1336 
+	`leaf
+();
+
+1339 void
+	$w365
+(void)
+
+1340 
+	`leaf
+();
+
+1343 void
+	$w366
+(void)
+
+1346 void
+	$w367
+(void)
+
+1347 
+	`leaf
+();
+
+1350 void
+	$w368
+(void)
+
+1351 
+	`leaf
+();
+
+1354 void
+	$w369
+(void)
+
+1357 void
+	$w370
+(void)
+
+1358 
+	`leaf
+();
+
+1361 void
+	$w371
+(void)
+
+1362 
+	`leaf
+();
+
+1365 void
+	$w372
+(void)
+
+1368 void
+	$w373
+(void)
+
+1369 
+	`leaf
+();
+
+1372 void
+	$w374
+(void)
+
+1373 
+	`leaf
+();
+
+1376 void
+	$w375
+(void)
+
+1379 void
+	$w376
+(void)
+
+1380 
+	`leaf
+();
+
+1383 void
+	$w377
+(void)
+
+1384 
+	`leaf
+();
+
+1387 void
+	$w378
+(void)
+
+1390 void
+	$w379
+(void)
+
+1391 
+	`leaf
+();
+
+1394 void
+	$w380
+(void)
+
+1395 
+	`leaf
+();
+
+1398 void
+	$w381
+(void)
+
+1401 void
+	$w382
+(void)
+
+1402 
+	`leaf
+();
+
+1405 void
+	$w383
+(void)
+
+1406 
+	`leaf
+();
+
+1409 void
+	$w384
+(void)
+
+1412 void
+	$w385
+(void)
+
+1413 
+	`leaf
+();
+
+1416 void
+	$w386
+(void)
+
+1417 
+	`leaf
+();
+
+1420 void
+	$w387
+(void)
+
+1423 void
+	$w388
+(void)
+
+1424 
+	`leaf
+();
+
+1427 void
+	$w389
+(void)
+
+1428 
+	`leaf
+();
+
+1431 void
+	$w390
+(void)
+
+1434 void
+	$w391
+(void)
+
+1435 
+	`leaf
+();
+
+1438 void
+	$w392
+(void)
+
+1439 
+	`leaf
+();
+
+1442 void
+	$w393
+(void)
+
+1445 void
+	$w394
+(void)
+
+1446 
+	`leaf
+();
+
+1449 void
+	$w395
+(void)
+
+1450 
+	`leaf
+();
+
+1453 void
+	$w396
+(void)
+
+1456 void
+	$w397
+(void)
+
+1457 
+	`leaf
+();
+
+1460 void
+	$w398
+(void)
+
+1461 
+	`leaf
+();
+
+1464 void
+	$w399
+(void)
+
+	@q.c
+
+1 void
+	$q0
+(void)
+
+2 
+	`p0
+();
+
+3 
+	`p1
+();
+
+6 void
+	$q1
+(void)
+
+7 
+	`p1
+();
+
+8 
+	`p2
+();
+
+11 void
+	$q2
+(void)
+
+12 
+	`p2
+();
+
+13 
+	`p3
+();
+
+16 void
+	$q3
+(void)
+
+17 
+	`p3
+();
+
+18 
+	`p4
+();
+
+21 void
+	$q4
+(void)
+
+22 
+	`p4
+();
+
+23 
+	`p5
+();
+
+26 void
+	$q5
+(void)
+
+27 
+	`p5
+();
+
+28 
+	`p6
+();
+
+31 void
+	$q6
+(void)
+
+32 
+	`p6
+();
+
+33 
+	`p7
+();
+
+36 void
+	$q7
+(void)
+
+37 
+	`p7
+();
+
+38 
+	`p8
+();
+
+41 void
+	$q8
+(void)
+
+42 
+	`p8
+();
+
+43 
+	`p9
+();
+
+46 void
+	$q9
+(void)
+
+47 
+	`p9
+();
+
+48 
+	`p10
+();
+
+51 void
+	$q10
+(void)
+
+52 
+	`p10
+();
+
+53 
+	`p11
+();
+
+56 void
+	$q11
+(void)
+
+57 
+	`p11
+();
+
+58 
+	`p12
+();
+
+61 void
+	$q12
+(void)
+
+62 
+	`p12
+();
+
+63 
+	`p13
+();
+
+66 void
+	$q13
+(void)
+
+67 
+	`p13
+();
+
+68 
+	`p14
+();
+
+71 void
+	$q14
+(void)
+
+72 
+	`p14
+();
+
+73 
+	`p15
+();
+
+76 void
+	$q15
+(void)
+
+77 
+	`p15
+();
+
+78 
+	`p16
+();
+
+81 void
+	$q16
+(void)
+
+82 
+	`p16
+();
+
+83 
+	`p17
+();
+
+86 void
+	$q17
+(void)
+
+87 
+	`p17
+();
+
+88 
+	`p18
+();
+
+91 void
+	$q18
+(void)
+
+92 
+	`p18
+();
+
+93 
+	`p19
+();
+
+96 void
+	$q19
+(void)
+
+97 
+	`p19
+();
+
+98 
+	`p20
+();
+
+101 void
+	$q20
+(void)
+
+102 
+	`p20
+();
+
+103 
+	`p21
+();
+
+106 void
+	$q21
+(void)
+
+107 
+	`p21
+();
+
+108 
+	`p22
+();
+
+111 void
+	$q22
+(void)
+
+112 
+	`p22
+();
+
+113 
+	`p23
+();
+
+116 void
+	$q23
+(void)
+
+117 
+	`p23
+();
+
+118 
+	`p24
+();
+
+121 void
+	$q24
+(void)
+
+122 
+	`p24
+();
+
+123 
+	`p25
+();
+
+126 void
+	$q25
+(void)
+
+127 
+	`p25
+();
+
+128 
+	`p26
+();
+
+131 void
+	$q26
+(void)
+
+132 
+	`p26
+();
+
+133 
+	`p27
+();
+
+136 void
+	$q27
+(void)
+
+137 
+	`p27
+();
+
+138 
+	`p28
+();
+
+141 void
+	$q28
+(void)
+
+142 
+	`p28
+();
+
+143 
+	`p29
+();
+
+146 void
+	$q29
+(void)
+
+147 
+	`p29
+();
+
+148 
+	`p30
+();
+
+151 void
+	$q30
+(void)
+
+152 
+	`p30
+();
+
+153 
+	`p31
+();
+
+156 void
+	$q31
+(void)
+
+157 
+	`p31
+();
+
+158 
+	`p32
+();
+
+161 void
+	$q32
+(void)
+
+162 
+	`p32
+();
+
+163 
+	`p33
+();
+
+166 void
+	$q33
+(void)
+
+167 
+	`p33
+();
+
+168 
+	`p34
+();
+
+171 void
+	$q34
+(void)
+
+172 
+	`p34
+();
+
+173 
+	`p35
+();
+
+176 void
+	$q35
+(void)
+
+177 
+	`p35
+();
+
+178 
+	`p36
+();
+
+181 void
+	$q36
+(void)
+
+182 
+	`p36
+();
+
+183 
+	`p37
+();
+
+186 void
+	$q37
+(void)
+
+187 
+	`p37
+();
+
+188 
+	`p38
+();
+
+191 void
+	$q38
+(void)
+
+192 
+	`p38
+();
+
+193 
+	`p39
+();
+
+196 void
+	$q39
+(void)
+
+197 
+	`p39
+();
+
+198 
+	`p40
+();
+
+201 void
+	$q40
+(void)
+
+202 
+	`p40
+();
+
+203 
+	`p41
+();
+
+206 void
+	$q41
+(void)
+
+207 
+	`p41
+();
+
+208 
+	`p42
+();
+
+211 void
+	$q42
+(void)
+
+212 
+	`p42
+();
+
+213 
+	`p43
+();
+
+216 void
+	$q43
+(void)
+
+217 
+	`p43
+();
+
+218 
+	`p44
+();
+
+221 void
+	$q44
+(void)
+
+222 
+	`p44
+();
+
+223 
+	`p45
+();
+
+226 void
+	$q45
+(void)
+
+227 
+	`p45
+();
+
+228 
+	`p46
+();
+
+231 void
+	$q46
+(void)
+
+232 
+	`p46
+();
+
+233 
+	`p47
+();
+
+236 void
+	$q47
+(void)
+
+237 
+	`p47
+();
+
+238 
+	`p48
+();
+
+241 void
+	$q48
+(void)
+
+242 
+	`p48
+();
+
+243 
+	`p49
+();
+
+246 void
+	$q49
+(void)
+
+247 
+	`p49
+();
+
+248 
+	`p50
+();
+
+251 void
+	$q50
+(void)
+
+252 
+	`p50
+();
+
+253 
+	`p51
+();
+
+256 void
+	$q51
+(void)
+
+257 
+	`p51
+();
+
+258 
+	`p52
+();
+
+261 void
+	$q52
+(void)
+
+262 
+	`p52
+();
+
+263 
+	`p53
+();
+
+266 void
+	$q53
+(void)
+
+267 
+	`p53
+();
+
+268 
+	`p54
+();
+
+271 void
+	$q54
+(void)
+
+272 
+	`p54
+();
+
+273 
+	`p55
+();
+
+276 void
+	$q55
+(void)
+
+277 
+	`p55
+();
+
+278 
+	`p56
+();
+
+281 void
+	$q56
+(void)
+
+282 
+	`p56
+();
+
+283 
+	`p57
+();
+
+286 void
+	$q57
+(void)
+
+287 
+	`p57
+();
+
+288 
+	`p58
+();
+
+291 void
+	$q58
+(void)
+
+292 
+	`p58
+();
+
+293 
+	`p59
+();
+
+296 void
+	$q59
+(void)
+
+297 
+	`p59
+();
+
+298 
+	`p60
+();
+
+301 void
+	$q60
+(void)
+
+302 
+	`p60
+();
+
+303 
+	`p61
+();
+
+306 void
+	$q61
+(void)
+
+307 
+	`p61
+();
+
+308 
+	`p62
+();
+
+311 void
+	$q62
+(void)
+
+312 
+	`p62
+();
+
+313 
+	`p63
+();
+
+316 void
+	$q63
+(void)
+
+317 
+	`p63
+();
+
+318 
+	`p64
+();
+
+321 void
+	$q64
+(void)
+
+322 
+	`p64
+();
+
+323 
+	`p65
+();
+
+326 void
+	$q65
+(void)
+
+327 
+	`p65
+();
+
+328 
+	`p66
+();
+
+331 void
+	$q66
+(void)
+
+332 
+	`p66
+();
+
+333 
+	`p67
+();
+
+336 void
+	$q67
+(void)
+
+337 
+	`p67
+();
+
+338 
+	`p68
+();
+
+341 void
+	$q68
+(void)
+
+342 
+	`p68
+();
+
+343 
+	`p69
+();
+
+346 void
+	$q69
+(void)
+
+347 
+	`p69
+();
+
+348 
+	`p70
+();
+
+351 void
+	$q70
+(void)
+
+352 
+	`p70
+();
+
+353 
+	`p71
+();
+
+356 void
+	$q71
+(void)
+
+357 
+	`p71
+();
+
+358 
+	`p72
+();
+
+361 void
+	$q72
+(void)
+
+362 
+	`p72
+();
+
+363 
+	`p73
+();
+
+366 void
+	$q73
+(void)
+
+367 
+	`p73
+();
+
+368 
+	`p74
+();
+
+371 void
+	$q74
+(void)
+
+372 
+	`p74
+();
+
+373 
+	`p75
+();
+
+376 void
+	$q75
+(void)
+
+377 
+	`p75
+();
+
+378 
+	`p76
+();
+
+381 void
+	$q76
+(void)
+
+382 
+	`p76
+();
+
+383 
+	`p77
+();
+
+386 void
+	$q77
+(void)
+
+387 
+	`p77
+();
+
+388 
+	`p78
+();
+
+391 void
+	$q78
+(void)
+
+392 
+	`p78
+();
+
+393 
+	`p79
+();
+
+396 void
+	$q79
+(void)
+
+397 
+	`p79
+();
+
+398 
+	`p80
+();
+
+401 void
+	$q80
+(void)
+
+402 
+	`p80
+();
+
+403 
+	`p81
+();
+
+406 void
+	$q81
+(void)
+
+407 
+	`p81
+();
+
+408 
+	`p82
+();
+
+411 void
+	$q82
+(void)
+
+412 
+	`p82
+();
+
+413 
+	`p83
+();
+
+416 void
+	$q83
+(void)
+
+417 
+	`p83
+();
+
+418 
+	`p84
+();
+
+421 void
+	$q84
+(void)
+
+422 
+	`p84
+();
+
+423 
+	`p85
+();
+
+426 void
+	$q85
+(void)
+
+427 
+	`p85
+();
+
+428 
+	`p86
+();
+
+431 void
+	$q86
+(void)
+
+432 
+	`p86
+();
+
+433 
+	`p87
+();
+
+436 void
+	$q87
+(void)
+
+437 
+	`p87
+();
+
+438 
+	`p88
+();
+
+441 void
+	$q88
+(void)
+
+442 
+	`p88
+();
+
+443 
+	`p89
+();
+
+446 void
+	$q89
+(void)
+
+447 
+	`p89
+();
+
+448 
+	`p90
+();
+
+451 void
+	$q90
+(void)
+
+452 
+	`p90
+();
+
+453 
+	`p91
+();
+
+456 void
+	$q91
+(void)
+
+457 
+	`p91
+();
+
+458 
+	`p92
+();
+
+461 void
+	$q92
+(void)
+
+462 
+	`p92
+();
+
+463 
+	`p93
+();
+
+466 void
+	$q93
+(void)
+
+467 
+	`p93
+();
+
+468 
+	`p94
+();
+
+471 void
+	$q94
+(void)
+
+472 
+	`p94
+();
+
+473 
+	`p95
+();
+
+476 void
+	$q95
+(void)
+
+477 
+	`p95
+();
+
+478 
+	`p96
+();
+
+481 void
+	$q96
+(void)
+
+482 
+	`p96
+();
+
+483 
+	`p97
+();
+
+486 void
+	$q97
+(void)
+
+487 
+	`p97
+();
+
+488 
+	`p98
+();
+
+491 void
+	$q98
+(void)
+
+492 
+	`p98
+();
+
+493 
+	`p99
+();
+
+496 void
+	$q99
+(void)
+
+497 
+	`p99
+();
+
+498 
+	`p100
+();
+
+501 void
+	$q100
+(void)
+
+502 
+	`p100
+();
+
+503 
+	`p101
+();
+
+506 void
+	$q101
+(void)
+
+507 
+	`p101
+();
+
+508 
+	`p102
+();
+
+511 void
+	$q102
+(void)
+
+512 
+	`p102
+();
+
+513 
+	`p103
+();
+
+516 void
+	$q103
+(void)
+
+517 
+	`p103
+();
+
+518 
+	`p104
+();
+
+521 void
+	$q104
+(void)
+
+522 
+	`p104
+();
+
+523 
+	`p105
+();
+
+526 void
+	$q105
+(void)
+
+527 
+	`p105
+();
+
+528 
+	`p106
+();
+
+531 void
+	$q106
+(void)
+
+532 
+	`p106
+();
+
+533 
+	`p107
+();
+
+536 void
+	$q107
+(void)
+
+537 
+	`p107
+();
+
+538 
+	`p108
+();
+
+541 void
+	$q108
+(void)
+
+542 
+	`p108
+();
+
+543 
+	`p109
+();
+
+546 void
+	$q109
+(void)
+
+547 
+	`p109
+();
+
+548 
+	`p110
+();
+
+551 void
+	$q110
+(void)
+
+552 
+	`p110
+();
+
+553 
+	`p111
+();
+
+556 void
+	$q111
+(void)
+
+557 
+	`p111
+();
+
+558 
+	`p112
+();
+
+561 void
+	$q112
+(void)
+
+562 
+	`p112
+();
+
+563 
+	`p113
+();
+
+566 void
+	$q113
+(void)
+
+567 
+	`p113
+();
+
+568 
+	`p114
+();
+
+571 void
+	$q114
+(void)
+
+572 
+	`p114
+();
+
+573 
+	`p115
+();
+
+576 void
+	$q115
+(void)
+
+577 
+	`p115
+();
+
+578 
+	`p116
+();
+
+581 void
+	$q116
+(void)
+
+582 
+	`p116
+();
+
+583 
+	`p117
+();
+
+586 void
+	$q117
+(void)
+
+587 
+	`p117
+();
+
+588 
+	`p118
+();
+
+591 void
+	$q118
+(void)
+
+592 
+	`p118
+();
+
+593 
+	`p119
+();
+
+596 void
+	$q119
+(void)
+
+597 
+	`p119
+();
+
+598 
+	`p120
+();
+
+601 void
+	$q120
+(void)
+
+602 
+	`p120
+();
+
+603 
+	`p121
+();
+
+606 void
+	$q121
+(void)
+
+607 
+	`p121
+();
+
+608 
+	`p122
+();
+
+611 void
+	$q122
+(void)
+
+612 
+	`p122
+();
+
+613 
+	`p123
+();
+
+616 void
+	$q123
+(void)
+
+617 
+	`p123
+();
+
+618 
+	`p124
+();
+
+621 void
+	$q124
+(void)
+
+622 
+	`p124
+();
+
+623 
+	`p125
+();
+
+626 void
+	$q125
+(void)
+
+627 
+	`p125
+();
+
+628 
+	`p126
+();
+
+631 void
+	$q126
+(void)
+
+632 
+	`p126
+();
+
+633 
+	`p127
+();
+
+636 void
+	$q127
+(void)
+
+637 
+	`p127
+();
+
+638 
+	`p128
+();
+
+641 void
+	$q128
+(void)
+
+642 
+	`p128
+();
+
+643 
+	`p129
+();
+
+646 void
+	$q129
+(void)
+
+647 
+	`p129
+();
+
+648 
+	`p130
+();
+
+651 void
+	$q130
+(void)
+
+652 
+	`p130
+();
+
+653 
+	`p131
+();
+
+656 void
+	$q131
+(void)
+
+657 
+	`p131
+();
+
+658 
+	`p132
+();
+
+661 void
+	$q132
+(void)
+
+662 
+	`p132
+();
+
+663 
+	`p133
+();
+
+666 void
+	$q133
+(void)
+
+667 
+	`p133
+();
+
+668 
+	`p134
+();
+
+671 void
+	$q134
+(void)
+
+672 
+	`p134
+();
+
+673 
+	`p135
+();
+
+676 void
+	$q135
+(void)
+
+677 
+	`p135
+();
+
+678 
+	`p136
+();
+
+681 void
+	$q136
+(void)
+
+682 
+	`p136
+();
+
+683 
+	`p137
+();
+
+686 void
+	$q137
+(void)
+
+687 
+	`p137
+();
+
+688 
+	`p138
+();
+
+691 void
+	$q138
+(void)
+
+692 
+	`p138
+();
+
+693 
+	`p139
+();
+
+696 void
+	$q139
+(void)
+
+697 
+	`p139
+();
+
+698 
+	`p140
+();
+
+701 void
+	$q140
+(void)
+
+702 
+	`p140
+();
+
+703 
+	`p141
+();
+
+706 void
+	$q141
+(void)
+
+707 
+	`p141
+();
+
+708 
+	`p142
+();
+
+711 void
+	$q142
+(void)
+
+712 
+	`p142
+();
+
+713 
+	`p143
+();
+
+716 void
+	$q143
+(void)
+
+717 
+	`p143
+();
+
+718 
+	`p144
+();
+
+721 void
+	$q144
+(void)
+
+722 
+	`p144
+();
+
+723 
+	`p145
+();
+
+726 void
+	$q145
+(void)
+
+727 
+	`p145
+();
+
+728 
+	`p146
+();
+
+731 void
+	$q146
+(void)
+
+732 
+	`p146
+();
+
+733 
+	`p147
+();
+
+736 void
+	$q147
+(void)
+
+737 
+	`p147
+();
+
+738 
+	`p148
+();
+
+741 void
+	$q148
+(void)
+
+742 
+	`p148
+();
+
+743 
+	`p149
+();
+
+746 void
+	$q149
+(void)
+
+747 
+	`p149
+();
+
+748 
+	`p150
+();
+
+751 void
+	$q150
+(void)
+
+752 
+	`p150
+();
+
+753 
+	`p151
+();
+
+756 void
+	$q151
+(void)
+
+757 
+	`p151
+();
+
+758 
+	`p152
+();
+
+761 void
+	$q152
+(void)
+
+762 
+	`p152
+();
+
+763 
+	`p153
+();
+
+766 void
+	$q153
+(void)
+
+767 
+	`p153
+();
+
+768 
+	`p154
+();
+
+771 void
+	$q154
+(void)
+
+772 
+	`p154
+();
+
+773 
+	`p155
+();
+
+776 void
+	$q155
+(void)
+
+777 
+	`p155
+();
+
+778 
+	`p156
+();
+
+781 void
+	$q156
+(void)
+
+782 
+	`p156
+();
+
+783 
+	`p157
+();
+
+786 void
+	$q157
+(void)
+
+787 
+	`p157
+();
+
+788 
+	`p158
+();
+
+791 void
+	$q158
+(void)
+
+792 
+	`p158
+();
+
+793 
+	`p159
+();
+
+796 void
+	$q159
+(void)
+
+797 
+	`p159
+();
+
+798 
+	`p160
+();
+
+801 void
+	$q160
+(void)
+
+802 
+	`p160
+();
+
+803 
+	`p161
+();
+
+806 void
+	$q161
+(void)
+
+807 
+	`p161
+();
+
+808 
+	`p162
+();
+
+811 void
+	$q162
+(void)
+
+812 
+	`p162
+();
+
+813 
+	`p163
+();
+
+816 void
+	$q163
+(void)
+
+817 
+	`p163
+();
+
+818 
+	`p164
+();
+
+821 void
+	$q164
+(void)
+
+822 
+	`p164
+();
+
+823 
+	`p165
+();
+
+826 void
+	$q165
+(void)
+
+827 
+	`p165
+();
+
+828 
+	`p166
+();
+
+831 void
+	$q166
+(void)
+
+832 
+	`p166
+();
+
+833 
+	`p167
+();
+
+836 void
+	$q167
+(void)
+
+837 
+	`p167
+();
+
+838 
+	`p168
+();
+
+841 void
+	$q168
+(void)
+
+842 
+	`p168
+();
+
+843 
+	`p169
+();
+
+846 void
+	$q169
+(void)
+
+847 
+	`p169
+();
+
+848 
+	`p170
+();
+
+851 void
+	$q170
+(void)
+
+852 
+	`p170
+();
+
+853 
+	`p171
+();
+
+856 void
+	$q171
+(void)
+
+857 
+	`p171
+();
+
+858 
+	`p172
+();
+
+861 void
+	$q172
+(void)
+
+862 
+	`p172
+();
+
+863 
+	`p173
+();
+
+866 void
+	$q173
+(void)
+
+867 
+	`p173
+();
+
+868 
+	`p174
+();
+
+871 void
+	$q174
+(void)
+
+872 
+	`p174
+();
+
+873 
+	`p175
+();
+
+876 void
+	$q175
+(void)
+
+877 
+	`p175
+();
+
+878 
+	`p176
+();
+
+881 void
+	$q176
+(void)
+
+882 
+	`p176
+();
+
+883 
+	`p177
+();
+
+886 void
+	$q177
+(void)
+
+887 
+	`p177
+();
+
+888 
+	`p178
+();
+
+891 void
+	$q178
+(void)
+
+892 
+	`p178
+();
+
+893 
+	`p179
+();
+
+896 void
+	$q179
+(void)
+
+897 
+	`p179
+();
+
+898 
+	`p180
+();
+
+901 void
+	$q180
+(void)
+
+902 
+	`p180
+();
+
+903 
+	`p181
+();
+
+906 void
+	$q181
+(void)
+
+907 
+	`p181
+();
+
+908 
+	`p182
+();
+
+911 void
+	$q182
+(void)
+
+912 
+	`p182
+();
+
+913 
+	`p183
+();
+
+916 void
+	$q183
+(void)
+
+917 
+	`p183
+();
+
+918 
+	`p184
+();
+
+921 void
+	$q184
+(void)
+
+922 
+	`p184
+();
+
+923 
+	`p185
+();
+
+926 void
+	$q185
+(void)
+
+927 
+	`p185
+();
+
+928 
+	`p186
+();
+
+931 void
+	$q186
+(void)
+
+932 
+	`p186
+();
+
+933 
+	`p187
+();
+
+936 void
+	$q187
+(void)
+
+937 
+	`p187
+();
+
+938 
+	`p188
+();
+
+941 void
+	$q188
+(void)
+
+942 
+	`p188
+();
+
+943 
+	`p189
+();
+
+946 void
+	$q189
+(void)
+
+947 
+	`p189
+();
+
+948 
+	`p190
+();
+
+951 void
+	$q190
+(void)
+
+952 
+	`p190
+();
+
+953 
+	`p191
+();
+
+956 void
+	$q191
+(void)
+
+957 
+	`p191
+();
+
+958 
+	`p192
+();
+
+961 void
+	$q192
+(void)
+
+962 
+	`p192
+();
+
+963 
+	`p193
+();
+
+966 void
+	$q193
+(void)
+
+967 
+	`p193
+();
+
+968 
+	`p194
+();
+
+971 void
+	$q194
+(void)
+
+972 
+	`p194
+();
+
+973 
+	`p195
+();
+
+976 void
+	$q195
+(void)
+
+977 
+	`p195
+();
+
+978 
+	`p196
+();
+
+981 void
+	$q196
+(void)
+
+982 
+	`p196
+();
+
+983 
+	`p197
+();
+
+986 void
+	$q197
+(void)
+
+987 
+	`p197
+();
+
+988 
+	`p198
+();
+
+991 void
+	$q198
+(void)
+
+992 
+	`p198
+();
+
+993 
+	`p199
+();
+
+996 void
+	$q199
+(void)
+
+997 
+	`p199
+();
+
+998 
+	`p200
+();
+
+1001 void
+	$q200
+(void)
+
+1002 
+	`p200
+();
+
+1003 
+	`p201
+();
+
+1006 void
+	$q201
+(void)
+
+1007 
+	`p201
+();
+
+1008 
+	`p202
+();
+
+1011 void
+	$q202
+(void)
+
+1012 
+	`p202
+();
+
+1013 
+	`p203
+();
+
+1016 void
+	$q203
+(void)
+
+1017 
+	`p203
+();
+
+1018 
+	`p204
+();
+
+1021 void
+	$q204
+(void)
+
+1022 
+	`p204
+();
+
+1023 
+	`p205
+();
+
+1026 void
+	$q205
+(void)
+
+1027 
+	`p205
+();
+
+1028 
+	`p206
+();
+
+1031 void
+	$q206
+(void)
+
+1032 
+	`p206
+();
+
+1033 
+	`p207
+();
+
+1036 void
+	$q207
+(void)
+
+1037 
+	`p207
+();
+
+1038 
+	`p208
+();
+
+1041 void
+	$q208
+(void)
+
+1042 
+	`p208
+();
+
+1043 
+	`p209
+();
+
+1046 void
+	$q209
+(void)
+
+1047 
+	`p209
+();
+
+1048 
+	`p210
+();
+
+1051 void
+	$q210
+(void)
+
+1052 
+	`p210
+();
+
+1053 
+	`p211
+();
+
+1056 void
+	$q211
+(void)
+
+1057 
+	`p211
+();
+
+1058 
+	`p212
+();
+
+1061 void
+	$q212
+(void)
+
+1062 
+	`p212
+();
+
+1063 
+	`p213
+();
+
+1066 void
+	$q213
+(void)
+
+1067 
+	`p213
+();
+
+1068 
+	`p214
+();
+
+1071 void
+	$q214
+(void)
+
+1072 
+	`p214
+();
+
+1073 
+	`p215
+();
+
+1076 void
+	$q215
+(void)
+
+1077 
+	`p215
+();
+
+1078 
+	`p216
+();
+
+1081 void
+	$q216
+(void)
+
+1082 
+	`p216
+();
+
+1083 
+	`p217
+();
+
+1086 void
+	$q217
+(void)
+
+1087 
+	`p217
+();
+
+1088 
+	`p218
+();
+
+1091 void
+	$q218
+(void)
+
+1092 
+	`p218
+();
+
+1093 
+	`p219
+();
+
+1096 void
+	$q219
+(void)
+
+1097 
+	`p219
+();
+
+1098 
+	`p220
+();
+
+1101 void
+	$q220
+(void)
+
+1102 
+	`p220
+();
+
+1103 
+	`p221
+();
+
+1106 void
+	$q221
+(void)
+
+1107 
+	`p221
+();
+
+1108 
+	`p222
+();
+
+1111 void
+	$q222
+(void)
+
+1112 
+	`p222
+();
+
+1113 
+	`p223
+();
+
+1116 void
+	$q223
+(void)
+
+1117 
+	`p223
+();
+
+1118 
+	`p224
+();
+
+1121 void
+	$q224
+(void)
+
+1122 
+	`p224
+();
+
+1123 
+	`p225
+();
+
+1126 void
+	$q225
+(void)
+
+1127 
+	`p225
+();
+
+1128 
+	`p226
+();
+
+1131 void
+	$q226
+(void)
+
+1132 
+	`p226
+();
+
+1133 
+	`p227
+();
+
+1136 void
+	$q227
+(void)
+
+1137 
+	`p227
+();
+
+1138 
+	`p228
+();
+
+1141 void
+	$q228
+(void)
+
+1142 
+	`p228
+();
+
+1143 
+	`p229
+();
+
+1146 void
+	$q229
+(void)
+
+1147 
+	`p229
+();
+
+1148 
+	`p230
+();
+
+1151 void
+	$q230
+(void)
+
+1152 
+	`p230
+();
+
+1153 
+	`p231
+();
+
+1156 void
+	$q231
+(void)
+
+1157 
+	`p231
+();
+
+1158 
+	`p232
+();
+
+1161 void
+	$q232
+(void)
+
+1162 
+	`p232
+();
+
+1163 
+	`p233
+();
+
+1166 void
+	$q233
+(void)
+
+1167 
+	`p233
+();
+
+1168 
+	`p234
+();
+
+1171 void
+	$q234
+(void)
+
+1172 
+	`p234
+();
+
+1173 
+	`p235
+();
+
+1176 void
+	$q235
+(void)
+
+1177 
+	`p235
+();
+
+1178 
+	`p236
+();
+
+1181 void
+	$q236
+(void)
+
+1182 
+	`p236
+();
+
+1183 
+	`p237
+();
+
+1186 void
+	$q237
+(void)
+
+1187 
+	`p237
+();
+
+1188 
+	`p238
+();
+
+1191 void
+	$q238
+(void)
+
+1192 
+	`p238
+();
+
+1193 
+	`p239
+();
+
+1196 void
+	$q239
+(void)
+
+1197 
+	`p239
+();
+
+1198 
+	`p240
+();
+
+1201 void
+	$q240
+(void)
+
+1202 
+	`p240
+();
+
+1203 
+	`p241
+();
+
+1206 void
+	$q241
+(void)
+
+1207 
+	`p241
+();
+
+1208 
+	`p242
+();
+
+1211 void
+	$q242
+(void)
+
+1212 
+	`p242
+();
+
+1213 
+	`p243
+();
+
+1216 void
+	$q243
+(void)
+
+1217 
+	`p243
+();
+
+1218 
+	`p244
+();
+
+1221 void
+	$q244
+(void)
+
+1222 
+	`p244
+();
+
+1223 
+	`p245
+();
+
+1226 void
+	$q245
+(void)
+
+1227 
+	`p245
+();
+
+1228 
+	`p246
+();
+
+1231 void
+	$q246
+(void)
+
+1232 
+	`p246
+();
+
+1233 
+	`p247
+();
+
+1236 void
+	$q247
+(void)
+
+1237 
+	`p247
+();
+
+1238 
+	`p248
+();
+
+1241 void
+	$q248
+(void)
+
+1242 
+	`p248
+();
+
+1243 
+	`p249
+();
+
+1246 void
+	$q249
+(void)
+
+1247 
+	`p249
+();
+
+1248 
+	`p250
+();
+
+1251 void
+	$q250
+(void)
+
+1252 
+	`p250
+();
+
+1253 
+	`p251
+();
+
+1256 void
+	$q251
+(void)
+
+1257 
+	`p251
+();
+
+1258 
+	`p252
+();
+
+1261 void
+	$q252
+(void)
+
+1262 
+	`p252
+();
+
+1263 
+	`p253
+();
+
+1266 void
+	$q253
+(void)
+
+1267 
+	`p253
+();
+
+1268 
+	`p254
+();
+
+1271 void
+	$q254
+(void)
+
+1272 
+	`p254
+();
+
+1273 
+	`p255
+();
+
+1276 void
+	$q255
+(void)
+
+1277 
+	`p255
+();
+
+1278 
+	`p256
+();
+
+1281 void
+	$q256
+(void)
+
+1282 
+	`p256
+();
+
+1283 
+	`p257
+();
+
+1286 void
+	$q257
+(void)
+
+1287 
+	`p257
+();
+
+1288 
+	`p258
+();
+
+1291 void
+	$q258
+(void)
+
+1292 
+	`p258
+();
+
+1293 
+	`p259
+();
+
+1296 void
+	$q259
+(void)
+
+1297 
+	`p259
+();
+
+1298 
+	`p260
+();
+
+1301 void
+	$q260
+(void)
+
+1302 
+	`p260
+();
+
+1303 
+	`p261
+();
+
+1306 void
+	$q261
+(void)
+
+1307 
+	`p261
+();
+
+1308 
+	`p262
+();
+
+1311 void
+	$q262
+(void)
+
+1312 
+	`p262
+();
+
+1313 
+	`p263
+();
+
+1316 void
+	$q263
+(void)
+
+1317 
+	`p263
+();
+
+1318 
+	`p264
+();
+
+1321 void
+	$q264
+(void)
+
+1322 
+	`p264
+();
+
+1323 
+	`p265
+();
+
+1326 void
+	$q265
+(void)
+
+1327 
+	`p265
+();
+
+1328 
+	`p266
+();
+
+1331 void
+	$q266
+(void)
+
+1332 
+	`p266
+();
+
+1333 
+	`p267
+();
+
+1336 void
+	$q267
+(void)
+
+1337 
+	`p267
+();
+
+1338 
+	`p268
+();
+
+1341 void
+	$q268
+(void)
+
+1342 
+	`p268
+();
+
+1343 
+	`p269
+();
+
+1346 void
+	$q269
+(void)
+
+1347 
+	`p269
+();
+
+1348 
+	`p270
+();
+
+1351 void
+	$q270
+(void)
+
+1352 
+	`p270
+();
+
+1353 
+	`p271
+();
+
+1356 void
+	$q271
+(void)
+
+1357 
+	`p271
+();
+
+1358 
+	`p272
+();
+
+1361 void
+	$q272
+(void)
+
+1362 
+	`p272
+();
+
+1363 
+	`p273
+();
+
+1366 void
+	$q273
+(void)
+
+1367 
+	`p273
+();
+
+1368 
+	`p274
+();
+
+1371 void
+	$q274
+(void)
+
+1372 
+	`p274
+();
+
+1373 
+	`p275
+();
+
+1376 void
+	$q275
+(void)
+
+1377 
+	`p275
+();
+
+1378 
+	`p276
+();
+
+1381 void
+	$q276
+(void)
+
+1382 
+	`p276
+();
+
+1383 
+	`p277
+();
+
+1386 void
+	$q277
+(void)
+
+1387 
+	`p277
+();
+
+1388 
+	`p278
+();
+
+1391 void
+	$q278
+(void)
+
+1392 
+	`p278
+();
+
+1393 
+	`p279
+();
+
+1396 void
+	$q279
+(void)
+
+1397 
+	`p279
+();
+
+1398 
+	`p280
+();
+
+1401 void
+	$q280
+(void)
+
+1402 
+	`p280
+();
+
+1403 
+	`p281
+();
+
+1406 void
+	$q281
+(void)
+
+1407 
+	`p281
+();
+
+1408 
+	`p282
+();
+
+1411 void
+	$q282
+(void)
+
+1412 
+	`p282
+();
+
+1413 
+	`p283
+();
+
+1416 void
+	$q283
+(void)
+
+1417 
+	`p283
+();
+
+1418 
+	`p284
+();
+
+1421 void
+	$q284
+(void)
+
+1422 
+	`p284
+();
+
+1423 
+	`p285
+();
+
+1426 void
+	$q285
+(void)
+
+1427 
+	`p285
+();
+
+1428 
+	`p286
+();
+
+1431 void
+	$q286
+(void)
+
+1432 
+	`p286
+();
+
+1433 
+	`p287
+();
+
+1436 void
+	$q287
+(void)
+
+1437 
+	`p287
+();
+
+1438 
+	`p288
+();
+
+1441 void
+	$q288
+(void)
+
+1442 
+	`p288
+();
+
+1443 
+	`p289
+();
+
+1446 void
+	$q289
+(void)
+
+1447 
+	`p289
+();
+
+1448 
+	`p290
+();
+
+1451 void
+	$q290
+(void)
+
+1452 
+	`p290
+();
+
+1453 
+	`p291
+();
+
+1456 void
+	$q291
+(void)
+
+1457 
+	`p291
+();
+
+1458 
+	`p292
+();
+
+1461 void
+	$q292
+(void)
+
+1462 
+	`p292
+();
+
+1463 
+	`p293
+();
+
+1466 void
+	$q293
+(void)
+
+1467 
+	`p293
+();
+
+1468 
+	`p294
+();
+
+1471 void
+	$q294
+(void)
+
+1472 
+	`p294
+();
+
+1473 
+	`p295
+();
+
+1476 void
+	$q295
+(void)
+
+1477 
+	`p295
+();
+
+1478 
+	`p296
+();
+
+1481 void
+	$q296
+(void)
+
+1482 
+	`p296
+();
+
+1483 
+	`p297
+();
+
+1486 void
+	$q297
+(void)
+
+1487 
+	`p297
+();
+
+1488 
+	`p298
+();
+
+1491 void
+	$q298
+(void)
+
+1492 
+	`p298
+();
+
+1493 
+	`p299
+();
+
+1496 void
+	$q299
+(void)
+
+1497 
+	`p299
+();
+
+1498 
+	`p300
+();
+
+1501 void
+	$q300
+(void)
+
+1502 
+	`p300
+();
+
+1503 
+	`p301
+();
+
+1506 void
+	$q301
+(void)
+
+1507 
+	`p301
+();
+
+1508 
+	`p302
+();
+
+1511 void
+	$q302
+(void)
+
+1512 
+	`p302
+();
+
+1513 
+	`p303
+();
+
+1516 void
+	$q303
+(void)
+
+1517 
+	`p303
+();
+
+1518 
+	`p304
+();
+
+1521 void
+	$q304
+(void)
+
+1522 
+	`p304
+();
+
+1523 
+	`p305
+();
+
+1526 void
+	$q305
+(void)
+
+1527 
+	`p305
+();
+
+1528 
+	`p306
+();
+
+1531 void
+	$q306
+(void)
+
+1532 
+	`p306
+();
+
+1533 
+	`p307
+();
+
+1536 void
+	$q307
+(void)
+
+1537 
+	`p307
+();
+
+1538 
+	`p308
+();
+
+1541 void
+	$q308
+(void)
+
+1542 
+	`p308
+();
+
+1543 
+	`p309
+();
+
+1546 void
+	$q309
+(void)
+
+1547 
+	`p309
+();
+
+1548 
+	`p310
+();
+
+1551 void
+	$q310
+(void)
+
+1552 
+	`p310
+();
+
+1553 
+	`p311
+();
+
+1556 void
+	$q311
+(void)
+
+1557 
+	`p311
+();
+
+1558 
+	`p312
+();
+
+1561 void
+	$q312
+(void)
+
+1562 
+	`p312
+();
+
+1563 
+	`p313
+();
+
+1566 void
+	$q313
+(void)
+
+1567 
+	`p313
+();
+
+1568 
+	`p314
+();
+
+1571 void
+	$q314
+(void)
+
+1572 
+	`p314
+();
+
+1573 
+	`p315
+();
+
+1576 void
+	$q315
+(void)
+
+1577 
+	`p315
+();
+
+1578 
+	`p316
+();
+
+1581 void
+	$q316
+(void)
+
+1582 
+	`p316
+();
+
+1583 
+	`p317
+();
+
+1586 void
+	$q317
+(void)
+
+1587 
+	`p317
+();
+
+1588 
+	`p318
+();
+
+1591 void
+	$q318
+(void)
+
+1592 
+	`p318
+();
+
+1593 
+	`p319
+();
+
+1596 void
+	$q319
+(void)
+
+1597 
+	`p319
+();
+
+1598 
+	`p320
+();
+
+1601 void
+	$q320
+(void)
+
+1602 
+	`p320
+();
+
+1603 
+	`p321
+();
+
+1606 void
+	$q321
+(void)
+
+1607 
+	`p321
+();
+
+1608 
+	`p322
+();
+
+1611 void
+	$q322
+(void)
+
+1612 
+	`p322
+();
+
+1613 
+	`p323
+();
+
+1616 void
+	$q323
+(void)
+
+1617 
+	`p323
+();
+
+1618 
+	`p324
+();
+
+1621 void
+	$q324
+(void)
+
+1622 
+	`p324
+();
+
+1623 
+	`p325
+();
+
+1626 void
+	$q325
+(void)
+
+1627 
+	`p325
+();
+
+1628 
+	`p326
+();
+
+1631 void
+	$q326
+(void)
+
+1632 
+	`p326
+();
+
+1633 
+	`p327
+();
+
+1636 void
+	$q327
+(void)
+
+1637 
+	`p327
+();
+
+1638 
+	`p328
+();
+
+1641 void
+	$q328
+(void)
+
+1642 
+	`p328
+();
+
+1643 
+	`p329
+();
+
+1646 void
+	$q329
+(void)
+
+1647 
+	`p329
+();
+
+1648 
+	`p330
+();
+
+1651 void
+	$q330
+(void)
+
+1652 
+	`p330
+();
+
+1653 
+	`p331
+();
+
+1656 void
+	$q331
+(void)
+
+1657 
+	`p331
+();
+
+1658 
+	`p332
+();
+
+1661 void
+	$q332
+(void)
+
+1662 
+	`p332
+();
+
+1663 
+	`p333
+();
+
+1666 void
+	$q333
+(void)
+
+1667 
+	`p333
+();
+
+1668 
+	`p334
+();
+
+1671 void
+	$q334
+(void)
+
+1672 
+	`p334
+();
+
+1673 
+	`p335
+();
+
+1676 void
+	$q335
+(void)
+
+1677 
+	`p335
+();
+
+1678 
+	`p336
+();
+
+1681 void
+	$q336
+(void)
+
+1682 
+	`p336
+();
+
+1683 
+	`p337
+();
+
+1686 void
+	$q337
+(void)
+
+1687 
+	`p337
+();
+
+1688 
+	`p338
+();
+
+1691 void
+	$q338
+(void)
+
+1692 
+	`p338
+();
+
+1693 
+	`p339
+();
+
+1696 void
+	$q339
+(void)
+
+1697 
+	`p339
+();
+
+1698 
+	`p340
+();
+
+1701 void
+	$q340
+(void)
+
+1702 
+	`p340
+();
+
+1703 
+	`p341
+();
+
+1706 void
+	$q341
+(void)
+
+1707 
+	`p341
+();
+
+1708 
+	`p342
+();
+
+1711 void
+	$q342
+(void)
+
+1712 
+	`p342
+();
+
+1713 
+	`p343
+();
+
+1716 void
+	$q343
+(void)
+
+1717 
+	`p343
+();
+
+1718 
+	`p344
+();
+
+1721 void
+	$q344
+(void)
+
+1722 
+	`p344
+();
+
+1723 
+	`p345
+();
+
+1726 void
+	$q345
+(void)
+
+1727 
+	`p345
+();
+
+1728 
+	`p346
+();
+
+1731 void
+	$q346
+(void)
+
+1732 
+	`p346
+();
+
+1733 
+	`p347
+();
+
+1736 void
+	$q347
+(void)
+
+1737 
+	`p347
+();
+
+1738 
+	`p348
+();
+
+1741 void
+	$q348
+(void)
+
+1742 
+	`p348
+();
+
+1743 
+	`p349
+();
+
+1746 void
+	$q349
+(void)
+
+1747 
+	`p349
+();
+
+1748 
+	`p350
+();
+
+1751 void
+	$q350
+(void)
+
+1752 
+	`p350
+();
+
+1753 
+	`p351
+();
+
+1756 void
+	$q351
+(void)
+
+1757 
+	`p351
+();
+
+1758 
+	`p352
+();
+
+1761 void
+	$q352
+(void)
+
+1762 
+	`p352
+();
+
+1763 
+	`p353
+();
+
+1766 void
+	$q353
+(void)
+
+1767 
+	`p353
+();
+
+1768 
+	`p354
+();
+
+1771 void
+	$q354
+(void)
+
+1772 
+	`p354
+();
+
+1773 
+	`p355
+();
+
+1776 void
+	$q355
+(void)
+
+1777 
+	`p355
+();
+
+1778 
+	`p356
+();
+
+1781 void
+	$q356
+(void)
+
+1782 
+	`p356
+();
+
+1783 
+	`p357
+();
+
+1786 void
+	$q357
+(void)
+
+1787 
+	`p357
+();
+
+1788 
+	`p358
+();
+
+1791 void
+	$q358
+(void)
+
+1792 
+	`p358
+();
+
+1793 
+	`p359
+();
+
+1796 void
+	$q359
+(void)
+
+1797 
+	`p359
+();
+
+1798 
+	`p360
+();
+
+1801 void
+	$q360
+(void)
+
+1802 
+	`p360
+();
+
+1803 
+	`p361
+();
+
+1806 void
+	$q361
+(void)
+
+1807 
+	`p361
+();
+
+1808 
+	`p362
+();
+
+1811 void
+	$q362
+(void)
+
+1812 
+	`p362
+();
+
+1813 
+	`p363
+();
+
+1816 void
+	$q363
+(void)
+
+1817 
+	`p363
+();
+
+1818 
+	`p364
+();
+
+1821 void
+	$q364
+(void)
+
+1822 
+	`p364
+();
+
+1823 
+	`p365
+();
+
+1826 void
+	$q365
+(void)
+
+1827 
+	`p365
+();
+
+1828 
+	`p366
+();
+
+1831 void
+	$q366
+(void)
+
+1832 
+	`p366
+();
+
+1833 
+	`p367
+();
+
+1836 void
+	$q367
+(void)
+
+1837 
+	`p367
+();
+
+1838 
+	`p368
+();
+
+1841 void
+	$q368
+(void)
+
+1842 
+	`p368
+();
+
+1843 
+	`p369
+();
+
+1846 void
+	$q369
+(void)
+
+1847 
+	`p369
+();
+
+1848 
+	`p370
+();
+
+1851 void
+	$q370
+(void)
+
+1852 
+	`p370
+();
+
+1853 
+	`p371
+();
+
+1856 void
+	$q371
+(void)
+
+1857 
+	`p371
+();
+
+1858 
+	`p372
+();
+
+1861 void
+	$q372
+(void)
+
+1862 
+	`p372
+();
+
+1863 
+	`p373
+();
+
+1866 void
+	$q373
+(void)
+
+1867 
+	`p373
+();
+
+1868 
+	`p374
+();
+
+1871 void
+	$q374
+(void)
+
+1872 
+	`p374
+();
+
+1873 
+	`p375
+();
+
+1876 void
+	$q375
+(void)
+
+1877 
+	`p375
+();
+
+1878 
+	`p376
+();
+
+1881 void
+	$q376
+(void)
+
+1882 
+	`p376
+();
+
+1883 
+	`p377
+();
+
+1886 void
+	$q377
+(void)
+
+1887 
+	`p377
+();
+
+1888 
+	`p378
+();
+
+1891 void
+	$q378
+(void)
+
+1892 
+	`p378
+();
+
+1893 
+	`p379
+();
+
+1896 void
+	$q379
+(void)
+
+1897 
+	`p379
+();
+
+1898 
+	`p380
+();
+
+1901 void
+	$q380
+(void)
+
+1902 
+	`p380
+();
+
+1903 
+	`p381
+();
+
+1906 void
+	$q381
+(void)
+
+1907 
+	`p381
+();
+
+1908 
+	`p382
+();
+
+1911 void
+	$q382
+(void)
+
+1912 
+	`p382
+();
+
+1913 
+	`p383
+();
+
+1916 void
+	$q383
+(void)
+
+1917 
+	`p383
+();
+
+1918 
+	`p384
+();
+
+1921 void
+	$q384
+(void)
+
+1922 
+	`p384
+();
+
+1923 
+	`p385
+();
+
+1926 void
+	$q385
+(void)
+
+1927 
+	`p385
+();
+
+1928 
+	`p386
+();
+
+1931 void
+	$q386
+(void)
+
+1932 
+	`p386
+();
+
+1933 
+	`p387
+();
+
+1936 void
+	$q387
+(void)
+
+1937 
+	`p387
+();
+
+1938 
+	`p388
+();
+
+1941 void
+	$q388
+(void)
+
+1942 
+	`p388
+();
+
+1943 
+	`p389
+();
+
+1946 void
+	$q389
+(void)
+
+1947 
+	`p389
+();
+
+1948 
+	`p390
+();
+
+1951 void
+	$q390
+(void)
+
+1952 
+	`p390
+();
+
+1953 
+	`p391
+();
+
+1956 void
+	$q391
+(void)
+
+1957 
+	`p391
+();
+
+1958 
+	`p392
+();
+
+1961 void
+	$q392
+(void)
+
+1962 
+	`p392
+();
+
+1963 
+	`p393
+();
+
+1966 void
+	$q393
+(void)
+
+1967 
+	`p393
+();
+
+1968 
+	`p394
+();
+
+1971 void
+	$q394
+(void)
+
+1972 
+	`p394
+();
+
+1973 
+	`p395
+();
+
+1976 void
+	$q395
+(void)
+
+1977 
+	`p395
+();
+
+1978 
+	`p396
+();
+
+1981 void
+	$q396
+(void)
+
+1982 
+	`p396
+();
+
+1983 
+	`p397
+();
+
+1986 void
+	$q397
+(void)
+
+1987 
+	`p397
+();
+
+1988 
+	`p398
+();
+
+1991 void
+	$q398
+(void)
+
+1992 
+	`p398
+();
+
+1993 
+	`p399
+();
+
+1996 void
+	$q399
+(void)
+
+1997 
+	`p399
+();
+
+1998 
+	`p0
+();
+
+	@r.c
+
+1 void
+	$r0
+(void)
+
+2 
+	`q0
+();
+
+3 
+	`q1
+();
+
+6 void
+	$r1
+(void)
+
+7 
+	`q2
+();
+
+8 
+	`q3
+();
+
+11 void
+	$r2
+(void)
+
+12 
+	`q4
+();
+
+13 
+	`q5
+();
+
+16 void
+	$r3
+(void)
+
+17 
+	`q6
+();
+
+18 
+	`q7
+();
+
+21 void
+	$r4
+(void)
+
+22 
+	`q8
+();
+
+23 
+	`q9
+();
+
+26 void
+	$r5
+(void)
+
+27 
+	`q10
+();
+
+28 
+	`q11
+();
+
+31 void
+	$r6
+(void)
+
+32 
+	`q12
+();
+
+33 
+	`q13
+();
+
+36 void
+	$r7
+(void)
+
+37 
+	`q14
+();
+
+38 
+	`q15
+();
+
+41 void
+	$r8
+(void)
+
+42 
+	`q16
+();
+
+43 
+	`q17
+();
+
+46 void
+	$r9
+(void)
+
+47 
+	`q18
+();
+
+48 
+	`q19
+();
+
+51 void
+	$r10
+(void)
+
+52 
+	`q20
+();
+
+53 
+	`q21
+();
+
+56 void
+	$r11
+(void)
+
+57 
+	`q22
+();
+
+58 
+	`q23
+();
+
+61 void
+	$r12
+(void)
+
+62 
+	`q24
+();
+
+63 
+	`q25
+();
+
+66 void
+	$r13
+(void)
+
+67 
+	`q26
+();
+
+68 
+	`q27
+();
+
+71 void
+	$r14
+(void)
+
+72 
+	`q28
+();
+
+73 
+	`q29
+();
+
+76 void
+	$r15
+(void)
+
+77 
+	`q30
+();
+
+78 
+	`q31
+();
+
+81 void
+	$r16
+(void)
+
+82 
+	`q32
+();
+
+83 
+	`q33
+();
+
+86 void
+	$r17
+(void)
+
+87 
+	`q34
+();
+
+88 
+	`q35
+();
+
+91 void
+	$r18
+(void)
+
+92 
+	`q36
+();
+
+93 
+	`q37
+();
+
+96 void
+	$r19
+(void)
+
+97 
+	`q38
+();
+
+98 
+	`q39
+();
+
+101 void
+	$r20
+(void)
+
+102 
+	`q40
+();
+
+103 
+	`q41
+();
+
+106 void
+	$r21
+(void)
+
+107 
+	`q42
+();
+
+108 
+	`q43
+();
+
+111 void
+	$r22
+(void)
+
+112 
+	`q44
+();
+
+113 
+	`q45
+();
+
+116 void
+	$r23
+(void)
+
+117 
+	`q46
+();
+
+118 
+	`q47
+();
+
+121 void
+	$r24
+(void)
+
+122 
+	`q48
+();
+
+123 
+	`q49
+();
+
+126 void
+	$r25
+(void)
+
+127 
+	`q50
+();
+
+128 
+	`q51
+();
+
+131 void
+	$r26
+(void)
+
+132 
+	`q52
+();
+
+133 
+	`q53
+();
+
+136 void
+	$r27
+(void)
+
+137 
+	`q54
+();
+
+138 
+	`q55
+();
+
+141 void
+	$r28
+(void)
+
+142 
+	`q56
+();
+
+143 
+	`q57
+();
+
+146 void
+	$r29
+(void)
+
+147 
+	`q58
+();
+
+148 
+	`q59
+();
+
+151 void
+	$r30
+(void)
+
+152 
+	`q60
+();
+
+153 
+	`q61
+();
+
+156 void
+	$r31
+(void)
+
+157 
+	`q62
+();
+
+158 
+	`q63
+();
+
+161 void
+	$r32
+(void)
+
+162 
+	`q64
+();
+
+163 
+	`q65
+();
+
+166 void
+	$r33
+(void)
+
+167 
+	`q66
+();
+
+168 
+	`q67
+();
+
+171 void
+	$r34
+(void)
+
+172 
+	`q68
+();
+
+173 
+	`q69
+();
+
+176 void
+	$r35
+(void)
+
+177 
+	`q70
+();
+
+178 
+	`q71
+();
+
+181 void
+	$r36
+(void)
+
+182 
+	`q72
+();
+
+183 
+	`q73
+();
+
+186 void
+	$r37
+(void)
+
+187 
+	`q74
+();
+
+188 
+	`q75
+();
+
+191 void
+	$r38
+(void)
+
+192 
+	`q76
+();
+
+193 
+	`q77
+();
+
+196 void
+	$r39
+(void)
+
+197 
+	`q78
+();
+
+198 
+	`q79
+();
+
+201 void
+	$r40
+(void)
+
+202 
+	`q80
+();
+
+203 
+	`q81
+();
+
+206 void
+	$r41
+(void)
+
+207 
+	`q82
+();
+
+208 
+	`q83
+();
+
+211 void
+	$r42
+(void)
+
+212 
+	`q84
+();
+
+213 
+	`q85
+();
+
+216 void
+	$r43
+(void)
+
+217 
+	`q86
+();
+
+218 
+	`q87
+();
+
+221 void
+	$r44
+(void)
+
+222 
+	`q88
+();
+
+223 
+	`q89
+();
+
+226 void
+	$r45
+(void)
+
+227 
+	`q90
+();
+
+228 
+	`q91
+();
+
+231 void
+	$r46
+(void)
+
+232 
+	`q92
+();
+
+233 
+	`q93
+();
+
+236 void
+	$r47
+(void)
+
+237 
+	`q94
+();
+
+238 
+	`q95
+();
+
+241 void
+	$r48
+(void)
+
+242 
+	`q96
+();
+
+243 
+	`q97
+();
+
+246 void
+	$r49
+(void)
+
+247 
+	`q98
+();
+
+248 
+	`q99
+();
+
+251 void
+	$r50
+(void)
+
+252 
+	`q100
+();
+
+253 
+	`q101
+();
+
+256 void
+	$r51
+(void)
+
+257 
+	`q102
+();
+
+258 
+	`q103
+();
+
+261 void
+	$r52
+(void)
+
+262 
+	`q104
+();
+
+263 
+	`q105
+();
+
+266 void
+	$r53
+(void)
+
+267 
+	`q106
+();
+
+268 
+	`q107
+();
+
+271 void
+	$r54
+(void)
+
+272 
+	`q108
+();
+
+273 
+	`q109
+();
+
+276 void
+	$r55
+(void)
+
+277 
+	`q110
+();
+
+278 
+	`q111
+();
+
+281 void
+	$r56
+(void)
+
+282 
+	`q112
+();
+
+283 
+	`q113
+();
+
+286 void
+	$r57
+(void)
+
+287 
+	`q114
+();
+
+288 
+	`q115
+();
+
+291 void
+	$r58
+(void)
+
+292 
+	`q116
+();
+
+293 
+	`q117
+();
+
+296 void
+	$r59
+(void)
+
+297 
+	`q118
+();
+
+298 
+	`q119
+();
+
+301 void
+	$r60
+(void)
+
+302 
+	`q120
+();
+
+303 
+	`q121
+();
+
+306 void
+	$r61
+(void)
+
+307 
+	`q122
+();
+
+308 
+	`q123
+();
+
+311 void
+	$r62
+(void)
+
+312 
+	`q124
+();
+
+313 
+	`q125
+();
+
+316 void
+	$r63
+(void)
+
+317 
+	`q126
+();
+
+318 
+	`q127
+();
+
+321 void
+	$r64
+(void)
+
+322 
+	`q128
+();
+
+323 
+	`q129
+();
+
+326 void
+	$r65
+(void)
+
+327 
+	`q130
+();
+
+328 
+	`q131
+();
+
+331 void
+	$r66
+(void)
+
+332 
+	`q132
+();
+
+333 
+	`q133
+();
+
+336 void
+	$r67
+(void)
+
+337 
+	`q134
+();
+
+338 
+	`q135
+();
+
+341 void
+	$r68
+(void)
+
+342 
+	`q136
+();
+
+343 
+	`q137
+();
+
+346 void
+	$r69
+(void)
+
+347 
+	`q138
+();
+
+348 
+	`q139
+();
+
+351 void
+	$r70
+(void)
+
+352 
+	`q140
+();
+
+353 
+	`q141
+();
+
+356 void
+	$r71
+(void)
+
+357 
+	`q142
+();
+
+358 
+	`q143
+();
+
+361 void
+	$r72
+(void)
+
+362 
+	`q144
+();
+
+363 
+	`q145
+();
+
+366 void
+	$r73
+(void)
+
+367 
+	`q146
+();
+
+368 
+	`q147
+();
+
+371 void
+	$r74
+(void)
+
+372 
+	`q148
+();
+
+373 
+	`q149
+();
+
+376 void
+	$r75
+(void)
+
+377 
+	`q150
+();
+
+378 
+	`q151
+();
+
+381 void
+	$r76
+(void)
+
+382 
+	`q152
+();
+
+383 
+	`q153
+();
+
+386 void
+	$r77
+(void)
+
+387 
+	`q154
+();
+
+388 
+	`q155
+();
+
+391 void
+	$r78
+(void)
+
+392 
+	`q156
+();
+
+393 
+	`q157
+();
+
+396 void
+	$r79
+(void)
+
+397 
+	`q158
+();
+
+398 
+	`q159
+();
+
+401 void
+	$r80
+(void)
+
+402 
+	`q160
+();
+
+403 
+	`q161
+();
+
+406 void
+	$r81
+(void)
+
+407 
+	`q162
+();
+
+408 
+	`q163
+();
+
+411 void
+	$r82
+(void)
+
+412 
+	`q164
+();
+
+413 
+	`q165
+();
+
+416 void
+	$r83
+(void)
+
+417 
+	`q166
+();
+
+418 
+	`q167
+();
+
+421 void
+	$r84
+(void)
+
+422 
+	`q168
+();
+
+423 
+	`q169
+();
+
+426 void
+	$r85
+(void)
+
+427 
+	`q170
+();
+
+428 
+	`q171
+();
+
+431 void
+	$r86
+(void)
+
+432 
+	`q172
+();
+
+433 
+	`q173
+();
+
+436 void
+	$r87
+(void)
+
+437 
+	`q174
+();
+
+438 
+	`q175
+();
+
+441 void
+	$r88
+(void)
+
+442 
+	`q176
+();
+
+443 
+	`q177
+();
+
+446 void
+	$r89
+(void)
+
+447 
+	`q178
+();
+
+448 
+	`q179
+();
+
+451 void
+	$r90
+(void)
+
+452 
+	`q180
+();
+
+453 
+	`q181
+();
+
+456 void
+	$r91
+(void)
+
+457 
+	`q182
+();
+
+458 
+	`q183
+();
+
+461 void
+	$r92
+(void)
+
+462 
+	`q184
+();
+
+463 
+	`q185
+();
+
+466 void
+	$r93
+(void)
+
+467 
+	`q186
+();
+
+468 
+	`q187
+();
+
+471 void
+	$r94
+(void)
+
+472 
+	`q188
+();
+
+473 
+	`q189
+();
+
+476 void
+	$r95
+(void)
+
+477 
+	`q190
+();
+
+478 
+	`q191
+();
+
+481 void
+	$r96
+(void)
+
+482 
+	`q192
+();
+
+483 
+	`q193
+();
+
+486 void
+	$r97
+(void)
+
+487 
+	`q194
+();
+
+488 
+	`q195
+();
+
+491 void
+	$r98
+(void)
+
+492 
+	`q196
+();
+
+493 
+	`q197
+();
+
+496 void
+	$r99
+(void)
+
+497 
+	`q198
+();
+
+498 
+	`q199
+();
+
+501 void
+	$r100
+(void)
+
+502 
+	`q200
+();
+
+503 
+	`q201
+();
+
+506 void
+	$r101
+(void)
+
+507 
+	`q202
+();
+
+508 
+	`q203
+();
+
+511 void
+	$r102
+(void)
+
+512 
+	`q204
+();
+
+513 
+	`q205
+();
+
+516 void
+	$r103
+(void)
+
+517 
+	`q206
+();
+
+518 
+	`q207
+();
+
+521 void
+	$r104
+(void)
+
+522 
+	`q208
+();
+
+523 
+	`q209
+();
+
+526 void
+	$r105
+(void)
+
+527 
+	`q210
+();
+
+528 
+	`q211
+();
+
+531 void
+	$r106
+(void)
+
+532 
+	`q212
+();
+
+533 
+	`q213
+();
+
+536 void
+	$r107
+(void)
+
+537 
+	`q214
+();
+
+538 
+	`q215
+();
+
+541 void
+	$r108
+(void)
+
+542 
+	`q216
+();
+
+543 
+	`q217
+();
+
+546 void
+	$r109
+(void)
+
+547 
+	`q218
+();
+
+548 
+	`q219
+();
+
+551 void
+	$r110
+(void)
+
+552 
+	`q220
+();
+
+553 
+	`q221
+();
+
+556 void
+	$r111
+(void)
+
+557 
+	`q222
+();
+
+558 
+	`q223
+();
+
+561 void
+	$r112
+(void)
+
+562 
+	`q224
+();
+
+563 
+	`q225
+();
+
+566 void
+	$r113
+(void)
+
+567 
+	`q226
+();
+
+568 
+	`q227
+();
+
+571 void
+	$r114
+(void)
+
+572 
+	`q228
+();
+
+573 
+	`q229
+();
+
+576 void
+	$r115
+(void)
+
+577 
+	`q230
+();
+
+578 
+	`q231
+();
+
+581 void
+	$r116
+(void)
+
+582 
+	`q232
+();
+
+583 
+	`q233
+();
+
+586 void
+	$r117
+(void)
+
+587 
+	`q234
+();
+
+588 
+	`q235
+();
+
+591 void
+	$r118
+(void)
+
+592 
+	`q236
+();
+
+593 
+	`q237
+();
+
+596 void
+	$r119
+(void)
+
+597 
+	`q238
+();
+
+598 
+	`q239
+();
+
+601 void
+	$r120
+(void)
+
+602 
+	`q240
+();
+
+603 
+	`q241
+();
+
+606 void
+	$r121
+(void)
+
+607 
+	`q242
+();
+
+608 
+	`q243
+();
+
+611 void
+	$r122
+(void)
+
+612 
+	`q244
+();
+
+613 
+	`q245
+();
+
+616 void
+	$r123
+(void)
+
+617 
+	`q246
+();
+
+618 
+	`q247
+();
+
+621 void
+	$r124
+(void)
+
+622 
+	`q248
+();
+
+623 
+	`q249
+();
+
+626 void
+	$r125
+(void)
+
+627 
+	`q250
+();
+
+628 
+	`q251
+();
+
+631 void
+	$r126
+(void)
+
+632 
+	`q252
+();
+
+633 
+	`q253
+();
+
+636 void
+	$r127
+(void)
+
+637 
+	`q254
+();
+
+638 
+	`q255
+();
+
+641 void
+	$r128
+(void)
+
+642 
+	`q256
+();
+
+643 
+	`q257
+();
+
+646 void
+	$r129
+(void)
+
+647 
+	`q258
+();
+
+648 
+	`q259
+();
+
+651 void
+	$r130
+(void)
+
+652 
+	`q260
+();
+
+653 
+	`q261
+();
+
+656 void
+	$r131
+(void)
+
+657 
+	`q262
+();
+
+658 
+	`q263
+();
+
+661 void
+	$r132
+(void)
+
+662 
+	`q264
+();
+
+663 
+	`q265
+();
+
+666 void
+	$r133
+(void)
+
+667 
+	`q266
+();
+
+668 
+	`q267
+();
+
+671 void
+	$r134
+(void)
+
+672 
+	`q268
+();
+
+673 
+	`q269
+();
+
+676 void
+	$r135
+(void)
+
+677 
+	`q270
+();
+
+678 
+	`q271
+();
+
+681 void
+	$r136
+(void)
+
+682 
+	`q272
+();
+
+683 
+	`q273
+();
+
+686 void
+	$r137
+(void)
+
+687 
+	`q274
+();
+
+688 
+	`q275
+();
+
+691 void
+	$r138
+(void)
+
+692 
+	`q276
+();
+
+693 
+	`q277
+();
+
+696 void
+	$r139
+(void)
+
+697 
+	`q278
+();
+
+698 
+	`q279
+();
+
+701 void
+	$r140
+(void)
+
+702 
+	`q280
+();
+
+703 
+	`q281
+();
+
+706 void
+	$r141
+(void)
+
+707 
+	`q282
+();
+
+708 
+	`q283
+();
+
+711 void
+	$r142
+(void)
+
+712 
+	`q284
+();
+
+713 
+	`q285
+();
+
+716 void
+	$r143
+(void)
+
+717 
+	`q286
+();
+
+718 
+	`q287
+();
+
+721 void
+	$r144
+(void)
+
+722 
+	`q288
+();
+
+723 
+	`q289
+();
+
+726 void
+	$r145
+(void)
+
+727 
+	`q290
+();
+
+728 
+	`q291
+();
+
+731 void
+	$r146
+(void)
+
+732 
+	`q292
+();
+
+733 
+	`q293
+();
+
+736 void
+	$r147
+(void)
+
+737 
+	`q294
+();
+
+738 
+	`q295
+();
+
+741 void
+	$r148
+(void)
+
+742 
+	`q296
+();
+
+743 
+	`q297
+();
+
+746 void
+	$r149
+(void)
+
+747 
+	`q298
+();
+
+748 
+	`q299
+();
+
+751 void
+	$r150
+(void)
+
+752 
+	`q300
+();
+
+753 
+	`q301
+();
+
+756 void
+	$r151
+(void)
+
+757 
+	`q302
+();
+
+758 
+	`q303
+();
+
+761 void
+	$r152
+(void)
+
+762 
+	`q304
+();
+
+763 
+	`q305
+();
+
+766 void
+	$r153
+(void)
+
+767 
+	`q306
+();
+
+768 
+	`q307
+();
+
+771 void
+	$r154
+(void)
+
+772 
+	`q308
+();
+
+773 
+	`q309
+();
+
+776 void
+	$r155
+(void)
+
+777 
+	`q310
+();
+
+778 
+	`q311
+();
+
+781 void
+	$r156
+(void)
+
+782 
+	`q312
+();
+
+783 
+	`q313
+();
+
+786 void
+	$r157
+(void)
+
+787 
+	`q314
+();
+
+788 
+	`q315
+();
+
+791 void
+	$r158
+(void)
+
+792 
+	`q316
+();
+
+793 
+	`q317
+();
+
+796 void
+	$r159
+(void)
+
+797 
+	`q318
+();
+
+798 
+	`q319
+();
+
+801 void
+	$r160
+(void)
+
+802 
+	`q320
+();
+
+803 
+	`q321
+();
+
+806 void
+	$r161
+(void)
+
+807 
+	`q322
+();
+
+808 
+	`q323
+();
+
+811 void
+	$r162
+(void)
+
+812 
+	`q324
+();
+
+813 
+	`q325
+();
+
+816 void
+	$r163
+(void)
+
+817 
+	`q326
+();
+
+818 
+	`q327
+();
+
+821 void
+	$r164
+(void)
+
+822 
+	`q328
+();
+
+823 
+	`q329
+();
+
+826 void
+	$r165
+(void)
+
+827 
+	`q330
+();
+
+828 
+	`q331
+();
+
+831 void
+	$r166
+(void)
+
+832 
+	`q332
+();
+
+833 
+	`q333
+();
+
+836 void
+	$r167
+(void)
+
+837 
+	`q334
+();
+
+838 
+	`q335
+();
+
+841 void
+	$r168
+(void)
+
+842 
+	`q336
+();
+
+843 
+	`q337
+();
+
+846 void
+	$r169
+(void)
+
+847 
+	`q338
+();
+
+848 
+	`q339
+();
+
+851 void
+	$r170
+(void)
+
+852 
+	`q340
+();
+
+853 
+	`q341
+();
+
+856 void
+	$r171
+(void)
+
+857 
+	`q342
+();
+
+858 
+	`q343
+();
+
+861 void
+	$r172
+(void)
+
+862 
+	`q344
+();
+
+863 
+	`q345
+();
+
+866 void
+	$r173
+(void)
+
+867 
+	`q346
+();
+
+868 
+	`q347
+();
+
+871 void
+	$r174
+(void)
+
+872 
+	`q348
+();
+
+873 
+	`q349
+();
+
+876 void
+	$r175
+(void)
+
+877 
+	`q350
+();
+
+878 
+	`q351
+();
+
+881 void
+	$r176
+(void)
+
+882 
+	`q352
+();
+
+883 
+	`q353
+();
+
+886 void
+	$r177
+(void)
+
+887 
+	`q354
+();
+
+888 
+	`q355
+();
+
+891 void
+	$r178
+(void)
+
+892 
+	`q356
+();
+
+893 
+	`q357
+();
+
+896 void
+	$r179
+(void)
+
+897 
+	`q358
+();
+
+898 
+	`q359
+();
+
+901 void
+	$r180
+(void)
+
+902 
+	`q360
+();
+
+903 
+	`q361
+();
+
+906 void
+	$r181
+(void)
+
+907 
+	`q362
+();
+
+908 
+	`q363
+();
+
+911 void
+	$r182
+(void)
+
+912 
+	`q364
+();
+
+913 
+	`q365
+();
+
+916 void
+	$r183
+(void)
+
+917 
+	`q366
+();
+
+918 
+	`q367
+();
+
+921 void
+	$r184
+(void)
+
+922 
+	`q368
+();
+
+923 
+	`q369
+();
+
+926 void
+	$r185
+(void)
+
+927 
+	`q370
+();
+
+928 
+	`q371
+();
+
+931 void
+	$r186
+(void)
+
+932 
+	`q372
+();
+
+933 
+	`q373
+();
+
+936 void
+	$r187
+(void)
+
+937 
+	`q374
+();
+
+938 
+	`q375
+();
+
+941 void
+	$r188
+(void)
+
+942 
+	`q376
+();
+
+943 
+	`q377
+();
+
+946 void
+	$r189
+(void)
+
+947 
+	`q378
+();
+
+948 
+	`q379
+();
+
+951 void
+	$r190
+(void)
+
+952 
+	`q380
+();
+
+953 
+	`q381
+();
+
+956 void
+	$r191
+(void)
+
+957 
+	`q382
+();
+
+958 
+	`q383
+();
+
+961 void
+	$r192
+(void)
+
+962 
+	`q384
+();
+
+963 
+	`q385
+();
+
+966 void
+	$r193
+(void)
+
+967 
+	`q386
+();
+
+968 
+	`q387
+();
+
+971 void
+	$r194
+(void)
+
+972 
+	`q388
+();
+
+973 
+	`q389
+();
+
+976 void
+	$r195
+(void)
+
+977 
+	`q390
+();
+
+978 
+	`q391
+();
+
+981 void
+	$r196
+(void)
+
+982 
+	`q392
+();
+
+983 
+	`q393
+();
+
+986 void
+	$r197
+(void)
+
+987 
+	`q394
+();
+
+988 
+	`q395
+();
+
+991 void
+	$r198
+(void)
+
+992 
+	`q396
+();
+
+993 
+	`q397
+();
+
+996 void
+	$r199
+(void)
+
+997 
+	`q398
+();
+
+998 
+	`q399
+();
+
+	@t.c
+
+1 void
+	$t0
+(void)
+
+2 
+	`r0
+();
+
+3 
+	`r1
+();
+
+4 
+	`r2
+();
+
+5 
+	`r3
+();
+
+6 
+	`r4
+();
+
+7 
+	`r5
+();
+
+8 
+	`r6
+();
+
+9 
+	`r7
+();
+
+10 
+	`r8
+();
+
+11 
+	`r9
+();
+
+12 
+	`r10
+();
+
+13 
+	`r11
+();
+
+14 
+	`r12
+();
+
+15 
+	`r13
+();
+
+16 
+	`r14
+();
+
+17 
+	`r15
+();
+
+18 
+	`r16
+();
+
+19 
+	`r17
+();
+
+20 
+	`r18
+();
+
+21 
+	`r19
+();
+
+24 void
+	$t1
+(void)
+
+25 
+	`r20
+();
+
+26 
+	`r21
+();
+
+27 
+	`r22
+();
+
+28 
+	`r23
+();
+
+29 
+	`r24
+();
+
+30 
+	`r25
+();
+
+31 
+	`r26
+();
+
+32 
+	`r27
+();
+
+33 
+	`r28
+();
+
+34 
+	`r29
+();
+
+35 
+	`r30
+();
+
+36 
+	`r31
+();
+
+37 
+	`r32
+();
+
+38 
+	`r33
+();
+
+39 
+	`r34
+();
+
+40 
+	`r35
+();
+
+41 
+	`r36
+();
+
+42 
+	`r37
+();
+
+43 
+	`r38
+();
+
+44 
+	`r39
+();
+
+47 void
+	$t2
+(void)
+
+48 
+	`r40
+();
+
+49 
+	`r41
+();
+
+50 
+	`r42
+();
+
+51 
+	`r43
+();
+
+52 
+	`r44
+();
+
+53 
+	`r45
+();
+
+54 
+	`r46
+();
+
+55 
+	`r47
+();
+
+56 
+	`r48
+();
+
+57 
+	`r49
+();
+
+58 
+	`r50
+();
+
+59 
+	`r51
+();
+
+60 
+	`r52
+();
+
+61 
+	`r53
+();
+
+62 
+	`r54
+();
+
+63 
+	`r55
+();
+
+64 
+	`r56
+();
+
+65 
+	`r57
+();
+
+66 
+	`r58
+();
+
+67 
+	`r59
+();
+
+70 void
+	$t3
+(void)
+
+71 
+	`r60
+();
+
+72 
+	`r61
+();
+
+73 
+	`r62
+();
+
+74 
+	`r63
+();
+
+75 
+	`r64
+();
+
+76 
+	`r65
+();
+
+77 
+	`r66
+();
+
+78 
+	`r67
+();
+
+79 
+	`r68
+();
+
+80 
+	`r69
+();
+
+81 
+	`r70
+();
+
+82 
+	`r71
+();
+
+83 
+	`r72
+();
+
+84 
+	`r73
+();
+
+85 
+	`r74
+();
+
+86 
+	`r75
+();
+
+87 
+	`r76
+();
+
+88 
+	`r77
+();
+
+89 
+	`r78
+();
+
+90 
+	`r79
+();
+
+93 void
+	$t4
+(void)
+
+94 
+	`r80
+();
+
+95 
+	`r81
+();
+
+96 
+	`r82
+();
+
+97 
+	`r83
+();
+
+98 
+	`r84
+();
+
+99 
+	`r85
+();
+
+100 
+	`r86
+();
+
+101 
+	`r87
+();
+
+102 
+	`r88
+();
+
+103 
+	`r89
+();
+
+104 
+	`r90
+();
+
+105 
+	`r91
+();
+
+106 
+	`r92
+();
+
+107 
+	`r93
+();
+
+108 
+	`r94
+();
+
+109 
+	`r95
+();
+
+110 
+	`r96
+();
+
+111 
+	`r97
+();
+
+112 
+	`r98
+();
+
+113 
+	`r99
+();
+
+116 void
+	$t5
+(void)
+
+117 
+	`r100
+();
+
+118 
+	`r101
+();
+
+119 
+	`r102
+();
+
+120 
+	`r103
+();
+
+121 
+	`r104
+();
+
+122 
+	`r105
+();
+
+123 
+	`r106
+();
+
+124 
+	`r107
+();
+
+125 
+	`r108
+();
+
+126 
+	`r109
+();
+
+127 
+	`r110
+();
+
+128 
+	`r111
+();
+
+129 
+	`r112
+();
+
+130 
+	`r113
+();
+
+131 
+	`r114
+();
+
+132 
+	`r115
+();
+
+133 
+	`r116
+();
+
+134 
+	`r117
+();
+
+135 
+	`r118
+();
+
+136 
+	`r119
+();
+
+139 void
+	$t6
+(void)
+
+140 
+	`r120
+();
+
+141 
+	`r121
+();
+
+142 
+	`r122
+();
+
+143 
+	`r123
+();
+
+144 
+	`r124
+();
+
+145 
+	`r125
+();
+
+146 
+	`r126
+();
+
+147 
+	`r127
+();
+
+148 
+	`r128
+();
+
+149 
+	`r129
+();
+
+150 
+	`r130
+();
+
+151 
+	`r131
+();
+
+152 
+	`r132
+();
+
+153 
+	`r133
+();
+
+154 
+	`r134
+();
+
+155 
+	`r135
+();
+
+156 
+	`r136
+();
+
+157 
+	`r137
+();
+
+158 
+	`r138
+();
+
+159 
+	`r139
+();
+
+162 void
+	$t7
+(void)
+
+163 
+	`r140
+();
+
+164 
+	`r141
+();
+
+165 
+	`r142
+();
+
+166 
+	`r143
+();
+
+167 
+	`r144
+();
+
+168 
+	`r145
+();
+
+169 
+	`r146
+();
+
+170 
+	`r147
+();
+
+171 
+	`r148
+();
+
+172 
+	`r149
+();
+
+173 
+	`r150
+();
+
+174 
+	`r151
+();
+
+175 
+	`r152
+();
+
+176 
+	`r153
+();
+
+177 
+	`r154
+();
+
+178 
+	`r155
+();
+
+179 
+	`r156
+();
+
+180 
+	`r157
+();
+
+181 
+	`r158
+();
+
+182 
+	`r159
+();
+
+185 void
+	$t8
+(void)
+
+186 
+	`r160
+();
+
+187 
+	`r161
+();
+
+188 
+	`r162
+();
+
+189 
+	`r163
+();
+
+190 
+	`r164
+();
+
+191 
+	`r165
+();
+
+192 
+	`r166
+();
+
+193 
+	`r167
+();
+
+194 
+	`r168
+();
+
+195 
+	`r169
+();
+
+196 
+	`r170
+();
+
+197 
+	`r171
+();
+
+198 
+	`r172
+();
+
+199 
+	`r173
+();
+
+200 
+	`r174
+();
+
+201 
+	`r175
+();
+
+202 
+	`r176
+();
+
+203 
+	`r177
+();
+
+204 
+	`r178
+();
+
+205 
+	`r179
+();
+
+208 void
+	$t9
+(void)
+
+209 
+	`r180
+();
+
+210 
+	`r181
+();
+
+211 
+	`r182
+();
+
+212 
+	`r183
+();
+
+213 
+	`r184
+();
+
+214 
+	`r185
+();
+
+215 
+	`r186
+();
+
+216 
+	`r187
+();
+
+217 
+	`r188
+();
+
+218 
+	`r189
+();
+
+219 
+	`r190
+();
+
+220 
+	`r191
+();
+
+221 
+	`r192
+();
+
+222 
+	`r193
+();
+
+223 
+	`r194
+();
+
+224 
+	`r195
+();
+
+225 
+	`r196
+();
+
+226 
+	`r197
+();
+
+227 
+	`r198
+();
+
+228 
+	`r199
+();
+
+231 void
+	$u
+(void)
+
+232 
+	`t0
+();
+
+233 
+	`t1
+();
+
+234 
+	`t2
+();
+
+235 
+	`t3
+();
+
+236 
+	`t4
+();
+
+237 
+	`t5
+();
+
+238 
+	`t6
+();
+
+239 
+	`t7
+();
+
+240 
+	`t8
+();
+
+241 
+	`t9
+();
+
+244 void
+	$v
+(void)
+
+245 
+	`u
+();
+
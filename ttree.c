@@ -23,7 +23,6 @@
  * THE SOFTWARE.
  */
 
-#include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -34,9 +33,7 @@
 #include "ttree.h"
 #endif // _ALL_IN_ONE
 
-#include <ccan/container_of/container_of.h>
 #include <ccan/likely/likely.h>
-#include <ccan/list/list.h>
 #include <ccan/str/str.h>
 #include <ccan/tal/tal.h>
 #include <ccan/tal/str/str.h>
@@ -51,8 +48,6 @@ ttree_t *ttreeinit(void)
 	strmap_init(&ptree->node_files);
 	strmap_init(&ptree->node_funcs);
 	strmap_init(&ptree->branch_exact);
-	strmap_init(&ptree->branch_callers);
-	strmap_init(&ptree->branch_callees);
 
 	return ptree;
 }
@@ -65,16 +60,13 @@ void ttreedestroy(ttree_t *ptree)
 
 	/* FIXME: Memory leak: Iterate to clear nested map */
 	strmap_clear(&ptree->branch_exact);
-	/* FIXME: Memory leak: Iterate to clear nested map */
-	strmap_clear(&ptree->branch_callers);
-	strmap_clear(&ptree->branch_callees);
 	tal_free(ptree);
 }
 
 // add a new node (function) to tree
 ttreenode_t *ttreeaddnode(ttree_t *ptree, char *funname, char *filename)
 {
-	ttreenode_t *pnode;
+	ttreenode_t *pnode, *pdef;
 	ttreefile_t *pfile;
 
 	if ((pnode = ttreefindnode(ptree, funname, filename)))
@@ -110,9 +102,16 @@ ttreenode_t *ttreeaddnode(ttree_t *ptree, char *funname, char *filename)
 			goto cleanup_pnode;
 	}
 
-	if (!strmap_get(&ptree->node_funcs, pnode->funname))
-		if (!strmap_add(&ptree->node_funcs, pnode->funname, pnode))
-			goto cleanup_pnode;
+	// the first definition of a name is in node_funcs, the others are
+	// chained to it in the order they are added, through its lastdef
+	pdef = strmap_get(&ptree->node_funcs, pnode->funname);
+	if (pdef) {
+		pdef->lastdef->nextdef = pnode;
+		pdef->lastdef = pnode;
+	} else if (!strmap_add(&ptree->node_funcs, pnode->funname, pnode))
+		goto cleanup_pnode;
+	else
+		pnode->lastdef = pnode;
 
 	if (unlikely(!ptree->firstnode))
 		ptree->firstnode = pnode;
@@ -121,6 +120,7 @@ ttreenode_t *ttreeaddnode(ttree_t *ptree, char *funname, char *filename)
 		ptree->lastnode->next = pnode;
 
 	ptree->lastnode = pnode;
+	pnode->id = ptree->nodeno++;
 
 	return pnode;
 
@@ -147,7 +147,7 @@ int ttreeaddbranch(ttree_t *ptree, ttreenode_t *caller, ttreenode_t *callee,
 		return -1;
 	}
 
-	if (ttreefindbranch(ptree, caller, callee, filename, NULL) != NULL)
+	if (ttreefindbranch(ptree, caller, callee, filename) != NULL)
 		return 0;
 
 	// only if branch does not exist yet
@@ -203,76 +203,221 @@ int ttreeaddbranch(ttree_t *ptree, ttreenode_t *caller, ttreenode_t *callee,
 			goto cleanup_pbranch; /* FIXME */
 	}
 
-	if (caller) {
-		/*
-		 * Illegal filename for key if file is NULL, that way we can
-		 * still enter the caller in the branch_callers map
-		 */
-		const char *key = filename ? parent->filename : "/";
-		struct list_head *head = NULL;
-		ttreebranchfile_t *pfile;
+	if (unlikely(!ptree->firstbranch))
+		ptree->firstbranch = pbranch;
 
-		pfile = strmap_get(&ptree->branch_callers, key);
-		if (!pfile) {
-			pfile = talz(ptree, ttreebranchfile_t);
-			if (!pfile)
-				goto cleanup_pbranch; /* FIXME */
+	if (likely(ptree->lastbranch))
+		ptree->lastbranch->next = pbranch;
 
-			strmap_init(&pfile->targets);
+	ptree->lastbranch = pbranch;
+	pbranch->id = ptree->branchno++;
 
-			if (!strmap_add(&ptree->branch_callers, key, pfile))
-				goto cleanup_pbranch; /* FIXME */
+	return iErr;
 
-		}
+cleanup_pbranch:
+	tal_free(pbranch);
 
-		head = strmap_get(&pfile->targets, caller->funname);
-		if (!head) {
-			head = talz(ptree, struct list_head);
-			if (!head)
-				goto cleanup_pbranch; /* FIXME */
+	return iErr;
+}
 
-			list_head_init(head);
-			if (!strmap_add(&pfile->targets, caller->funname, head))
-				goto cleanup_pbranch; /* FIXME */
-		}
+typedef struct ttreenames_st {
+	const char **names;
+	ttreenode_t **first;
+	unsigned nameno;
+} ttreenames_t;
+
+static bool ttreecollectname(const char *funname, ttreenode_t *pnode,
+			     ttreenames_t *pnames)
+{
+	pnames->names[pnames->nameno] = funname;
+	pnames->first[pnames->nameno++] = pnode;
+
+	return true;
+}
+
+// number the files, in name order, and their functions
+static bool ttreecollectfilefun(const char *funname, ttreenode_t *pnode,
+				ttree_t *ptree)
+{
+	pnode->fileid = ptree->fileno;
+
+	return true;
+}
 
-		list_add(head, &parent->elem);
+static bool ttreecollectfile(const char *filename, ttreefile_t *pfile,
+			     ttree_t *ptree)
+{
+	strmap_iterate(&pfile->nodes, ttreecollectfilefun, ptree);
+	ptree->files[ptree->fileno++] = filename;
+
+	return true;
+}
+
+// lay out the branches of every node contiguously, grouped by node id
+static int ttreeadjacency(ttree_t *ptree, unsigned **poff,
+			  ttreebranch_t ***pbranches, int bycallee)
+{
+	ttreebranch_t *pbranch;
+	unsigned *off, *fill;
+	unsigned i, id;
+
+	off = tal_arrz(ptree, unsigned, ptree->nodeno + 1);
+	fill = tal_arr(ptree, unsigned, ptree->nodeno);
+	*pbranches = tal_arr(ptree, ttreebranch_t *, ptree->branchno);
+	if (!off || !fill || !*pbranches) {
+		printf("\nMemory allocation error\n");
+		tal_free(fill);
+		return -1;
 	}
 
-	if (callee) {
-		struct list_head *head;
+	for (pbranch = ptree->firstbranch; pbranch; pbranch = pbranch->next) {
+		id = bycallee ? pbranch->child.node->id :
+				pbranch->parent.node->id;
+		off[id + 1]++;
+	}
+	for (i = 0; i < ptree->nodeno; i++) {
+		off[i + 1] += off[i];
+		fill[i] = off[i + 1];
+	}
 
-		head = strmap_get(&ptree->branch_callees, callee->funname);
-		if (!head) {
-			head = talz(ptree, struct list_head);
-			if (!head)
-				goto cleanup_pbranch; /* FIXME */
+	// filled from the end: the latest branch comes first, as it always
+	// did when scanning the tree
+	for (pbranch = ptree->firstbranch; pbranch; pbranch = pbranch->next) {
+		id = bycallee ? pbranch->child.node->id :
+				pbranch->parent.node->id;
+		(*pbranches)[--fill[id]] = pbranch;
+	}
 
-			list_head_init(head);
-			if (!strmap_add(&ptree->branch_callees, callee->funname,
-					head))
-				goto cleanup_pbranch; /* FIXME */
-		}
+	tal_free(fill);
+	*poff = off;
 
-		list_add(head, &child->elem);
+	return 0;
+}
+
+// freeze the tree once all nodes and branches have been added: fill the node,
+// branch and file tables, build the symbol index, a minimal perfect hash over the
+// function names, and the callee and caller adjacency of every node
+int ttreefreeze(ttree_t *ptree)
+{
+	ttreenames_t names;
+	ttreenode_t *pnode;
+	ttreebranch_t *pbranch;
+	unsigned i;
+	int iErr = 0;
+
+	ptree->nodes = tal_arr(ptree, ttreenode_t *, ptree->nodeno);
+	names.names = tal_arr(ptree, const char *, ptree->nodeno);
+	names.first = tal_arr(ptree, ttreenode_t *, ptree->nodeno);
+	if (!ptree->nodes || !names.names || !names.first) {
+		printf("\nMemory allocation error\n");
+		iErr = -1;
+		goto cleanup_names;
 	}
 
-	if (unlikely(!ptree->firstbranch))
-		ptree->firstbranch = pbranch;
+	for (pnode = ptree->firstnode; pnode != NULL; pnode = pnode->next) {
+		ptree->nodes[pnode->id] = pnode;
+		pnode->fileid = TTREE_NOFILE;
+	}
 
-	if (likely(ptree->lastbranch))
-		ptree->lastbranch->next = pbranch;
+	ptree->files = tal_arr(ptree, const char *, ptree->nodeno + 1);
+	if (!ptree->files) {
+		printf("\nMemory allocation error\n");
+		iErr = -1;
+		goto cleanup_names;
+	}
+	ptree->fileno = 0;
+	strmap_iterate(&ptree->node_files, ttreecollectfile, ptree);
 
-	ptree->lastbranch = pbranch;
+	ptree->branches = tal_arr(ptree, ttreebranch_t *, ptree->branchno);
+	if (!ptree->branches) {
+		printf("\nMemory allocation error\n");
+		iErr = -1;
+		goto cleanup_names;
+	}
 
-	return iErr;
+	for (pbranch = ptree->firstbranch; pbranch; pbranch = pbranch->next)
+		ptree->branches[pbranch->id] = pbranch;
 
-cleanup_pbranch:
-	tal_free(pbranch);
+	iErr = ttreeadjacency(ptree, &ptree->calleeoff, &ptree->calleebranch,
+			      0);
+	if (iErr == 0)
+		iErr = ttreeadjacency(ptree, &ptree->calleroff,
+				      &ptree->callerbranch, 1);
+	if (iErr != 0)
+		goto cleanup_names;
+
+	// node_funcs holds each function name once, with its first definition
+	names.nameno = 0;
+	strmap_iterate(&ptree->node_funcs, ttreecollectname, &names);
+
+	ptree->namemph = mphbuild(ptree, names.names, names.nameno);
+	ptree->namenode = tal_arr(ptree, ttreenode_t *, names.nameno);
+	if (!ptree->namemph || !ptree->namenode) {
+		iErr = -1;
+		goto cleanup_names;
+	}
+
+	for (i = 0; i < names.nameno; i++)
+		ptree->namenode[mphlookup(ptree->namemph, names.names[i])] =
+		    names.first[i];
+	ptree->nameno = names.nameno;
+
+	for (i = 0; i < ptree->nodeno; i++)
+		ptree->nodes[i]->nameid =
+		    mphlookup(ptree->namemph, ptree->nodes[i]->funname);
+
+cleanup_names:
+	tal_free(names.names);
+	tal_free(names.first);
 
 	return iErr;
 }
 
+// find a function name in the symbol index and return its name id or -1 if not
+// found; the tree must be frozen
+int ttreefindname(const ttree_t *ptree, const char *funname)
+{
+	uint32_t nameid;
+
+	if (!funname || !ptree->nameno)
+		return -1;
+
+	nameid = mphlookup(ptree->namemph, funname);
+	if (strcmp(ptree->namenode[nameid]->funname, funname) != 0)
+		return -1;
+
+	return nameid;
+}
+
+// find the definition of a function named by a build tool, e.g. a compiler or
+// nm: the one in the file and around the line given, else the first one in
+// the file; a function defined once matches by name alone, as the paths of
+// the build may differ from the ones of the database. Returns NULL if none
+ttreenode_t *ttreefinddef(const ttree_t *ptree, const char *funname,
+			  const char *filename, unsigned line)
+{
+	ttreenode_t *pnode, *pinfile = NULL;
+	int nameid = ttreefindname(ptree, funname);
+
+	if (nameid < 0)
+		return NULL;
+	pnode = ptree->namenode[nameid];
+	if (!pnode->nextdef)
+		return pnode->filename ? pnode : NULL;
+
+	for (; pnode; pnode = pnode->nextdef) {
+		if (!pnode->filename || !filename ||
+		    !slibpathmatch(pnode->filename, filename))
+			continue;
+		if (line >= pnode->line && line <= pnode->endline)
+			return pnode;
+		if (!pinfile)
+			pinfile = pnode;
+	}
+
+	return pinfile;
+}
+
 // find a node with specified function name and file name and return its pointer
 // or NULL if not found
 ttreenode_t *ttreefindnode(ttree_t *ptree, char *funname, char *filename)
@@ -291,6 +436,11 @@ ttreenode_t *ttreefindnode(ttree_t *ptree, char *funname, char *filename)
 			if (pnode)
 				return pnode;
 		}
+	} else if (ptree->namemph) {
+		int nameid = ttreefindname(ptree, funname);
+
+		if (nameid >= 0)
+			return ptree->namenode[nameid];
 	} else {
 		pnode = strmap_get(&ptree->node_funcs, funname);
 		if (pnode)
@@ -301,88 +451,45 @@ ttreenode_t *ttreefindnode(ttree_t *ptree, char *funname, char *filename)
 }
 
 // find a branch with specified caller, callee and file name and return its
-// pointer or NULL if not found;
-// if pstart == NULL search will be performed over all branches, otherwise it
-// will start from the specified branch
+// pointer or NULL if not found
 ttreebranch_t *ttreefindbranch(ttree_t *ptree, ttreenode_t *caller,
-			       ttreenode_t *callee, char *filename,
-			       ttreebranch_t *pstart)
+			       ttreenode_t *callee, char *filename)
 {
-	if (caller == NULL && callee == NULL)
-		return NULL;
-
-	if (filename && caller && callee) {
-		ttreebranchfile_t *pfile;
-		ttreebranchsource_t *psrc;
-
-		assert(!pstart);
-
-		pfile = strmap_get(&ptree->branch_exact, filename);
-		if (!pfile)
-			return NULL;
-
-		psrc = strmap_get(&pfile->sources, caller->funname);
-		if (!psrc)
-			return NULL;
-
-		return strmap_get(&psrc->targets, callee->funname);
-	}
-
-	if (caller && !callee) {
-		ttreebranch_t *pbranch;
-		/*
-		 * Illegal filename for key if file is NULL, that way we can
-		 * still enter the caller in the branch_callers map
-		 */
-		const char *key = filename ? filename : "/";
-		ttreebranchfile_t *pfile;
-		struct list_head *head;
-		ttreeparent_t *parent;
-
-		pfile = strmap_get(&ptree->branch_callers, key);
-		if (!pfile)
-			return NULL;
-
-		head = strmap_get(&pfile->targets, caller->funname);
-		if (!head)
-			return NULL;
+	ttreebranchfile_t *pfile;
+	ttreebranchsource_t *psrc;
 
-		parent = (pstart && pstart == ptree->lbranch) ?
-			list_next(head, &pstart->parent, elem) :
-			list_top(head, ttreeparent_t, elem);
-
-		if (!parent)
-			return NULL;
-
-		pbranch = container_of(parent, ttreebranch_t, parent);
-
-		ptree->lbranch = pbranch;
-
-		return pbranch;
-	}
-
-	if (!filename && !caller && callee) {
-		struct list_head *head;
-		ttreebranch_t *pbranch;
-		ttreechild_t *child;
-
-		head = strmap_get(&ptree->branch_callees, callee->funname);
-		if (!head)
-			return NULL;
+	if (caller == NULL || callee == NULL || filename == NULL)
+		return NULL;
 
-		child = (pstart && pstart == ptree->lbranch) ?
-			list_next(head, &pstart->child, elem) :
-			list_top(head, ttreechild_t, elem);
+	pfile = strmap_get(&ptree->branch_exact, filename);
+	if (!pfile)
+		return NULL;
 
-		if (!child)
-			return NULL;
+	psrc = strmap_get(&pfile->sources, caller->funname);
+	if (!psrc)
+		return NULL;
 
-		pbranch = container_of(child, ttreebranch_t, child);
+	return strmap_get(&psrc->targets, callee->funname);
+}
 
-		ptree->lbranch = pbranch;
+// init an iterator over all branches starting from pnode; the tree must be
+// frozen
+void ttreecallees(const ttree_t *ptree, const ttreenode_t *pnode,
+		  ttreeiter_t *piter)
+{
+	piter->next = &ptree->calleebranch[ptree->calleeoff[pnode->id]];
+	piter->end = &ptree->calleebranch[ptree->calleeoff[pnode->id + 1]];
+}
 
-		return pbranch;
-	}
+// init an iterator over all branches with pnode as destination; the tree must
+// be frozen
+void ttreecallers(const ttree_t *ptree, const ttreenode_t *pnode,
+		  ttreeiter_t *piter)
+{
+	// calls are bound to the first definition of a function name, see
+	// gettree(), so that is where the callers of every definition are
+	unsigned id = ptree->namenode[pnode->nameid]->id;
 
-	assert(false && "Unexpected filename/caller/callee combination");
+	piter->next = &ptree->callerbranch[ptree->calleroff[id]];
+	piter->end = &ptree->callerbranch[ptree->calleroff[id + 1]];
 }
@@ -26,38 +26,47 @@
 #ifndef _TTREE_H
 #define _TTREE_H
 
-#include <ccan/list/list.h>
 #include <ccan/strmap/strmap.h>
 
+#ifndef _ALL_IN_ONE
+#include "mph.h"
+#endif // _ALL_IN_ONE
+
+#define TTREE_NOFILE 0xffffffffu // fileid of library functions
+
+#define TTREE_DEFFUNC 1	 // defined as a function ($ in cscope output)
+#define TTREE_DEFMACRO 2 // defined as a macro (# in cscope output)
+
 typedef struct ttreenode_st *ttreenode_tp;
 typedef struct ttreebranch_st *ttreebranch_tp;
 
 typedef struct ttreenode_st {
 	char *funname;      // function name
 	char *filename;     // filename where the function definition is
-	int outdone;	// = 1 when node output is done
-	int subtreeoutdone; // = 1 when node subtree output is done
-	int isroot;	 // = 1 when node is one of the roots
-	int icolor;	 // color for node (0 = default)
+	unsigned id;	    // index in ttree_t.nodes
+	unsigned nameid;    // index of funname in ttree_t.namenode
+	unsigned fileid;    // index of filename in ttree_t.files or TTREE_NOFILE
+	unsigned line;	    // first line of the definition, 0 if unknown
+	unsigned endline;   // last line of the definition, 0 if unknown
+	unsigned defkind;   // TTREE_DEFxxx kinds of definition, 0 if library
+	ttreenode_tp nextdef; // Next definition of the same function name
+	ttreenode_tp lastdef; // Last definition of the name, first one only
 	ttreenode_tp next;  // Next node for linear list access
 } ttreenode_t;
 
 typedef struct ttreeparent_st {
 	char *filename;      // filename where the call is
 	ttreenode_t *node; // parent node (calling function)
-	struct list_node elem;
 } ttreeparent_t;
 
 typedef struct ttreechild_st {
 	ttreenode_t *node;  // child node (called function)
-	struct list_node elem;
 } ttreechild_t;
 
 typedef struct ttreebranch_st {
 	ttreeparent_t parent;
 	ttreechild_t child;
-	int outdone;	 // = 1 when branch output is done
-	int icolor;	  // color for branch (0 = default)
+	unsigned id;	     // index in ttree_t.branches
 	ttreebranch_tp next; // Next branch for linear list access
 } ttreebranch_t;
 
@@ -66,10 +75,7 @@ typedef struct ttreebranchsource_st {
 } ttreebranchsource_t;
 
 typedef struct ttreebranchfile_st {
-	union {
-		STRMAP(ttreebranchsource_t *) sources;
-		STRMAP(struct list_head *) targets;
-	};
+	STRMAP(ttreebranchsource_t *) sources;
 } ttreebranchfile_t;
 
 typedef struct ttreefile_st {
@@ -83,24 +89,58 @@ typedef struct ttree_st {
 	ttreenode_t *firstnode;     // first node of linear list
 	ttreenode_t *lastnode;
 	STRMAP(ttreefile_t *) node_files;
-	STRMAP(ttreenode_t *) node_funcs;
+	STRMAP(ttreenode_t *) node_funcs; // first definition, see nextdef
 
 	ttreebranch_t *firstbranch; // first branch of linear list
 	ttreebranch_t *lastbranch;
 	STRMAP(ttreebranchfile_t *) branch_exact;
-	STRMAP(ttreebranchfile_t *) branch_callers;
-	STRMAP(struct list_head *) branch_callees;
-	ttreebranch_t *lbranch;
+
+	// symbol index and adjacency, built by ttreefreeze() once the tree is
+	// complete: from then on the tree is only read, so any number of
+	// traversals (see ttreetrav.h) may run on it at the same time
+	unsigned nodeno;	// number of nodes
+	ttreenode_t **nodes;    // nodes by id
+	unsigned nameno;	// number of distinct function names
+	mph_t *namemph;		// function name -> name id
+	ttreenode_t **namenode; // first definition of each function name
+	unsigned fileno;	// number of files defining functions
+	const char **files;	// file names by file id, in name order
+	unsigned branchno;	// number of branches
+	ttreebranch_t **branches; // branches by id
+	unsigned *calleeoff;	// callees of node id i: calleebranch[calleeoff[i]]
+	ttreebranch_t **calleebranch; // ... up to calleebranch[calleeoff[i+1]]
+	unsigned *calleroff;	// callers of node id i, same layout
+	ttreebranch_t **callerbranch;
 } ttree_t;
 
+// explicit iterator over the branches of a node, see ttreecallees() and
+// ttreecallers()
+typedef struct ttreeiter_st {
+	ttreebranch_t **next; // next branch to return
+	ttreebranch_t **end;  // end of the branches
+} ttreeiter_t;
+
 ttree_t *ttreeinit(void);
 void ttreedestroy(ttree_t *);
 ttreenode_t *ttreeaddnode(ttree_t *ptree, char *funname, char *filename);
 int ttreeaddbranch(ttree_t *ptree, ttreenode_t *caller, ttreenode_t *callee,
 		   char *filename);
+int ttreefreeze(ttree_t *ptree);
 ttreenode_t *ttreefindnode(ttree_t *ptree, char *funname, char *filename);
+int ttreefindname(const ttree_t *ptree, const char *funname);
+ttreenode_t *ttreefinddef(const ttree_t *ptree, const char *funname,
+			  const char *filename, unsigned line);
 ttreebranch_t *ttreefindbranch(ttree_t *ptree, ttreenode_t *caller,
-			       ttreenode_t *callee, char *filename,
-			       ttreebranch_t *pstart);
+			       ttreenode_t *callee, char *filename);
+void ttreecallees(const ttree_t *ptree, const ttreenode_t *pnode,
+		  ttreeiter_t *piter);
+void ttreecallers(const ttree_t *ptree, const ttreenode_t *pnode,
+		  ttreeiter_t *piter);
+
+// next branch of an iterator or NULL at the end
+static inline ttreebranch_t *ttreeiternext(ttreeiter_t *piter)
+{
+	return piter->next < piter->end ? *piter->next++ : NULL;
+}
 
 #endif // #ifndef _TTREE_H
@@ -0,0 +1,304 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "ttreebetw.h"
+#endif // _ALL_IN_ONE
+
+#define BETW_NODIST 0xffffffffu // node not reached from the source
+#define BETW_ONE 65536.0 // fixed point unit of the dependencies summed
+
+// the calls followed, shared by the threads: callees of every node not
+// excluded, each one once, leaving out the calls of a function to itself
+// and to excluded functions, which are on no shortest chain
+typedef struct betwgraph_st {
+	unsigned *off;	     // callees of node i: succ[off[i]] up to
+	unsigned *succ;	     // succ[off[i+1]]
+	const unsigned *src; // sources of the shortest chains
+	unsigned srcno;
+	unsigned next; // next source to take, atomic
+} betwgraph_t;
+
+// state of a thread, which follows the shortest chains from one source at
+// a time
+typedef struct betwthread_st {
+	betwgraph_t *pgraph;
+	unsigned *dist;	  // calls from the source or BETW_NODIST
+	double *sigma;	  // shortest chains from the source
+	double *coef;	  // (1 + dependency of the source) / sigma
+	unsigned *order;  // nodes reached, by distance
+	uint64_t *sum;	  // dependencies summed over the sources, fixed point
+	pthread_t thread;
+} betwthread_t;
+
+// 64 bit generator, so that the sources drawn are the same on every run
+static uint64_t betwrandom(uint64_t *pstate)
+{
+	uint64_t z = (*pstate += 0x9e3779b97f4a7c15ULL);
+
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+
+	return z ^ (z >> 31);
+}
+
+// Brandes: a breadth first scan from the source counts the shortest chains
+// to each node, then the nodes in decreasing distance get the dependency of
+// the source on them from the nodes they call; the sums are fixed point, so
+// that they don't depend on how the sources are shared among the threads
+static void betwsource(betwthread_t *pthr, unsigned s)
+{
+	const betwgraph_t *pgraph = pthr->pgraph;
+	unsigned *dist = pthr->dist, *order = pthr->order;
+	double *sigma = pthr->sigma, *coef = pthr->coef;
+	unsigned i, j, v, w, head = 0, tail = 0;
+	double d;
+
+	dist[s] = 0;
+	sigma[s] = 1;
+	order[tail++] = s;
+	while (head < tail) {
+		v = order[head++];
+		for (j = pgraph->off[v]; j < pgraph->off[v + 1]; j++) {
+			w = pgraph->succ[j];
+			if (dist[w] == BETW_NODIST) {
+				dist[w] = dist[v] + 1;
+				sigma[w] = 0;
+				order[tail++] = w;
+			}
+			if (dist[w] == dist[v] + 1)
+				sigma[w] += sigma[v];
+		}
+	}
+
+	// the nodes one call farther are done before, as they come later; the
+	// dependency on v is sigma[v] * sum of (1 + dependency on w) / sigma[w]
+	// over the nodes w one call farther
+	for (i = tail; i-- > 0;) {
+		v = order[i];
+		d = 0;
+		for (j = pgraph->off[v]; j < pgraph->off[v + 1]; j++) {
+			w = pgraph->succ[j];
+			if (dist[w] == dist[v] + 1)
+				d += coef[w];
+		}
+		d *= sigma[v];
+		coef[v] = (1 + d) / sigma[v];
+		if (v != s)
+			pthr->sum[v] += (uint64_t)(d * BETW_ONE + 0.5);
+	}
+
+	for (i = 0; i < tail; i++)
+		dist[order[i]] = BETW_NODIST;
+}
+
+static void *betwworker(void *parg)
+{
+	betwthread_t *pthr = parg;
+	betwgraph_t *pgraph = pthr->pgraph;
+	unsigned i;
+
+	while ((i = __atomic_fetch_add(&pgraph->next, 1, __ATOMIC_RELAXED)) <
+	       pgraph->srcno)
+		betwsource(pthr, pgraph->src[i]);
+
+	return NULL;
+}
+
+static int betwthreadinit(betwthread_t *pthr, const ttree_t *ptree,
+			  betwgraph_t *pgraph)
+{
+	unsigned i;
+
+	pthr->pgraph = pgraph;
+	pthr->dist = malloc((ptree->nodeno + 1) * sizeof(unsigned));
+	pthr->sigma = malloc((ptree->nodeno + 1) * sizeof(double));
+	pthr->coef = malloc((ptree->nodeno + 1) * sizeof(double));
+	pthr->order = malloc((ptree->nodeno + 1) * sizeof(unsigned));
+	pthr->sum = calloc(ptree->nodeno + 1, sizeof(uint64_t));
+	if (!pthr->dist || !pthr->sigma || !pthr->coef || !pthr->order ||
+	    !pthr->sum)
+		return -1;
+
+	for (i = 0; i < ptree->nodeno; i++)
+		pthr->dist[i] = BETW_NODIST;
+
+	return 0;
+}
+
+static void betwthreadfree(betwthread_t *pthr)
+{
+	free(pthr->dist);
+	free(pthr->sigma);
+	free(pthr->coef);
+	free(pthr->order);
+	free(pthr->sum);
+}
+
+// deduplicated callees of the nodes not excluded, with the stamp of the
+// last node calling each one as in ttreemetricbuild()
+static int betwgraph(const ttree_t *ptree, const ttreeset_t *pexcluded,
+		     betwgraph_t *pgraph)
+{
+	unsigned *stamp;
+	unsigned i, c, n = 0;
+	ttreebranch_t *pbranch;
+	ttreeiter_t iter;
+
+	stamp = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	pgraph->off = malloc((ptree->nodeno + 1) * sizeof(unsigned));
+	pgraph->succ = malloc((ptree->branchno + 1) * sizeof(unsigned));
+	if (!stamp || !pgraph->off || !pgraph->succ) {
+		free(stamp);
+		return -1;
+	}
+
+	for (i = 0; i < ptree->nodeno; i++) {
+		pgraph->off[i] = n;
+		if (ttreesetisin(pexcluded, i))
+			continue;
+
+		// the stamp of node i is i + 1, so that 0 is no stamp
+		ttreecallees(ptree, ptree->nodes[i], &iter);
+		while ((pbranch = ttreeiternext(&iter)) != NULL) {
+			c = pbranch->child.node->id;
+			if (c == i || stamp[c] == i + 1 ||
+			    ttreesetisin(pexcluded, c))
+				continue;
+			stamp[c] = i + 1;
+			pgraph->succ[n++] = c;
+		}
+	}
+	pgraph->off[ptree->nodeno] = n;
+
+	free(stamp);
+
+	return 0;
+}
+
+// shortest call chains from samples functions drawn at random among those
+// not excluded (all of them if samples is 0 or more than there are), on
+// threadno threads; drawing k of n functions, the sums are scaled by n / k,
+// which makes them an unbiased estimate of the betweenness whose error
+// shrinks as 1 / sqrt(k)
+ttreebetw_t *ttreebetwbuild(const ttree_t *ptree, const ttreeset_t *pexcluded,
+			    unsigned samples, unsigned threadno)
+{
+	ttreebetw_t *pbetw;
+	betwgraph_t graph = {NULL, NULL, NULL, 0, 0};
+	betwthread_t *pthrs = NULL;
+	unsigned *src = NULL;
+	unsigned i, j, t, tmp, started = 0;
+	uint64_t sum, state = 0;
+	double scale;
+	int iErr = 0;
+
+	if (threadno < 1)
+		threadno = 1;
+
+	pbetw = calloc(1, sizeof(*pbetw));
+	if (pbetw)
+		pbetw->score = calloc(ptree->nodeno + 1, sizeof(double));
+	src = malloc((ptree->nodeno + 1) * sizeof(unsigned));
+	pthrs = calloc(threadno, sizeof(*pthrs));
+	if (!pbetw || !pbetw->score || !src || !pthrs ||
+	    betwgraph(ptree, pexcluded, &graph) != 0) {
+		iErr = -1;
+		goto cleanup;
+	}
+
+	for (i = 0; i < ptree->nodeno; i++)
+		if (!ttreesetisin(pexcluded, i))
+			src[pbetw->nodeno++] = i;
+
+	// the first samples of a partial Fisher-Yates shuffle
+	pbetw->sourceno = pbetw->nodeno;
+	if (samples > 0 && samples < pbetw->nodeno) {
+		for (i = 0; i < samples; i++) {
+			j = i + betwrandom(&state) % (pbetw->nodeno - i);
+			tmp = src[i];
+			src[i] = src[j];
+			src[j] = tmp;
+		}
+		pbetw->sourceno = samples;
+	}
+	graph.src = src;
+	graph.srcno = pbetw->sourceno;
+
+	for (t = 0; t < threadno; t++)
+		if (betwthreadinit(&pthrs[t], ptree, &graph) != 0) {
+			iErr = -1;
+			goto cleanup;
+		}
+
+	// if some thread couldn't start, the others take its sources
+	for (t = 1; t < threadno; t++)
+		if (pthread_create(&pthrs[t].thread, NULL, betwworker,
+				   &pthrs[t]) != 0)
+			break;
+	started = t;
+	betwworker(&pthrs[0]);
+	for (t = 1; t < started; t++)
+		pthread_join(pthrs[t].thread, NULL);
+
+	scale = pbetw->sourceno ?
+		    (double)pbetw->nodeno / pbetw->sourceno / BETW_ONE :
+		    0;
+	for (i = 0; i < ptree->nodeno; i++) {
+		for (sum = 0, t = 0; t < threadno; t++)
+			sum += pthrs[t].sum[i];
+		pbetw->score[i] = sum * scale;
+	}
+
+cleanup:
+	if (iErr != 0) {
+		printf("\nMemory allocation error\n");
+		ttreebetwfree(pbetw);
+		pbetw = NULL;
+	}
+	for (t = 0; pthrs && t < threadno; t++)
+		betwthreadfree(&pthrs[t]);
+	free(pthrs);
+	free(src);
+	free(graph.off);
+	free(graph.succ);
+
+	return pbetw;
+}
+
+void ttreebetwfree(ttreebetw_t *pbetw)
+{
+	if (!pbetw)
+		return;
+
+	free(pbetw->score);
+	free(pbetw);
+}
@@ -0,0 +1,48 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _TTREEBETW_H
+#define _TTREEBETW_H
+
+#ifndef _ALL_IN_ONE
+#include "ttree.h"
+#include "ttreesel.h"
+#endif // _ALL_IN_ONE
+
+// betweenness of every node of a frozen tree, leaving out the excluded
+// nodes: the shortest call chains between two other functions going
+// through the node, each counted as the fraction of the shortest chains
+// between the two functions that it is
+typedef struct ttreebetw_st {
+	double *score;	   // estimated betweenness of each node
+	unsigned sourceno; // functions the shortest chains were followed from
+	unsigned nodeno;   // functions they were drawn from
+} ttreebetw_t;
+
+ttreebetw_t *ttreebetwbuild(const ttree_t *ptree, const ttreeset_t *pexcluded,
+			    unsigned samples, unsigned threadno);
+void ttreebetwfree(ttreebetw_t *pbetw);
+
+#endif // #ifndef _TTREEBETW_H
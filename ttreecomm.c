@@ -0,0 +1,509 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "ttreecomm.h"
+#endif // _ALL_IN_ONE
+
+#define COMM_MAXPASSES 32 // passes of the local moves of a level at most
+#define COMM_MINGAIN 1e-9 // gain a node must get from a move
+
+// undirected graph of a level: the nodes of the level before merged by
+// community, with the calls between them summed
+typedef struct commgraph_st {
+	unsigned nodeno;
+	unsigned *off; // neighbours of node i: adj[off[i]] up to adj[off[i+1]]
+	unsigned *adj;
+	double *w;  // weight of each neighbour, the calls between the two
+	double *k;  // degree of each node, calls inside it included
+	double *in; // calls inside each node, counted at both ends
+} commgraph_t;
+
+// scratch space of the levels, sized for the first one
+typedef struct commwork_st {
+	unsigned *comm;	   // community of each node of the level
+	double *tot;	   // degree of each community
+	double *acc;	   // weight to each community from the node looked at
+	unsigned *touched; // communities with a weight in acc
+	unsigned *order;   // nodes by community, then communities to pair
+	unsigned *first;   // first node of each community in order
+	unsigned char *merged; // community merged in this round
+	double m2;	   // degrees summed, twice the calls
+} commwork_t;
+
+// merge of two communities proposed by the first one
+typedef struct commpair_st {
+	double gain;
+	unsigned c, d;
+} commpair_t;
+
+static void commgraphfree(commgraph_t *pg)
+{
+	free(pg->off);
+	free(pg->adj);
+	free(pg->w);
+	free(pg->k);
+	free(pg->in);
+	memset(pg, 0, sizeof(*pg));
+}
+
+static int commgraphalloc(commgraph_t *pg, unsigned nodeno, unsigned adjno)
+{
+	pg->nodeno = nodeno;
+	pg->off = calloc(nodeno + 1, sizeof(unsigned));
+	pg->adj = malloc((adjno + 1) * sizeof(unsigned));
+	pg->w = malloc((adjno + 1) * sizeof(double));
+	pg->k = calloc(nodeno + 1, sizeof(double));
+	pg->in = calloc(nodeno + 1, sizeof(double));
+	if (!pg->off || !pg->adj || !pg->w || !pg->k || !pg->in) {
+		commgraphfree(pg);
+		return -1;
+	}
+
+	return 0;
+}
+
+// the first level: the calls among the nodes given, leaving out those of a
+// function to itself, which tie it to no other
+static int commgraphinit(const ttree_t *ptree, const unsigned *pnodes,
+			 unsigned nodeno, const unsigned *pbranches,
+			 unsigned branchno, commgraph_t *pg)
+{
+	unsigned *local;
+	unsigned i, u, v, adjno = 0;
+	ttreebranch_t *pbranch;
+	int iErr = 0;
+
+	local = malloc((ptree->nodeno + 1) * sizeof(unsigned));
+	if (!local)
+		return -1;
+	memset(local, 0xff, (ptree->nodeno + 1) * sizeof(unsigned));
+	for (i = 0; i < nodeno; i++)
+		local[pnodes[i]] = i;
+
+	for (i = 0; i < branchno; i++) {
+		pbranch = ptree->branches[pbranches[i]];
+		u = local[pbranch->parent.node->id];
+		v = local[pbranch->child.node->id];
+		if (u != TTREECOMM_NONE && v != TTREECOMM_NONE && u != v)
+			adjno += 2;
+	}
+
+	iErr = commgraphalloc(pg, nodeno, adjno);
+	if (iErr == 0) {
+		for (i = 0; i < branchno; i++) {
+			pbranch = ptree->branches[pbranches[i]];
+			u = local[pbranch->parent.node->id];
+			v = local[pbranch->child.node->id];
+			if (u != TTREECOMM_NONE && v != TTREECOMM_NONE &&
+			    u != v) {
+				pg->off[u + 1]++;
+				pg->off[v + 1]++;
+			}
+		}
+		for (i = 0; i < nodeno; i++) {
+			pg->k[i] = pg->off[i + 1];
+			pg->off[i + 1] += pg->off[i];
+		}
+		// off[i] is the next free neighbour of node i meanwhile
+		for (i = 0; i < branchno; i++) {
+			pbranch = ptree->branches[pbranches[i]];
+			u = local[pbranch->parent.node->id];
+			v = local[pbranch->child.node->id];
+			if (u == TTREECOMM_NONE || v == TTREECOMM_NONE ||
+			    u == v)
+				continue;
+			pg->w[pg->off[u]] = 1;
+			pg->adj[pg->off[u]++] = v;
+			pg->w[pg->off[v]] = 1;
+			pg->adj[pg->off[v]++] = u;
+		}
+		for (i = nodeno; i > 0; i--)
+			pg->off[i] = pg->off[i - 1];
+		pg->off[0] = 0;
+	}
+
+	free(local);
+
+	return iErr;
+}
+
+// weights from node i to the communities of its neighbours, in pwork->acc;
+// returns how many communities have one, listed in pwork->touched
+static unsigned commweights(const commgraph_t *pg, commwork_t *pwork,
+			    unsigned i)
+{
+	unsigned j, c, n = 0;
+
+	for (j = pg->off[i]; j < pg->off[i + 1]; j++) {
+		c = pwork->comm[pg->adj[j]];
+		if (pwork->acc[c] == 0)
+			pwork->touched[n++] = c;
+		pwork->acc[c] += pg->w[j];
+	}
+
+	return n;
+}
+
+static void commclear(commwork_t *pwork, unsigned n)
+{
+	while (n-- > 0)
+		pwork->acc[pwork->touched[n]] = 0;
+}
+
+// local moves of Louvain: each node goes to the community of a neighbour if
+// that raises the modularity the most, until no node moves; the gain of
+// moving node i to community c is proportional to the calls between them
+// less those expected at random, tot[c] * k[i] / m2
+static void commlocal(const commgraph_t *pg, commwork_t *pwork)
+{
+	unsigned i, t, n, c, best, pass, moves;
+	double gain, bestgain;
+
+	for (i = 0; i < pg->nodeno; i++) {
+		pwork->comm[i] = i;
+		pwork->tot[i] = pg->k[i];
+	}
+
+	// with no calls at all, every node is alone
+	moves = pwork->m2 > 0;
+
+	for (pass = 0; moves > 0 && pass < COMM_MAXPASSES; pass++) {
+		moves = 0;
+		for (i = 0; i < pg->nodeno; i++) {
+			n = commweights(pg, pwork, i);
+			best = pwork->comm[i];
+			pwork->tot[best] -= pg->k[i];
+			bestgain = pwork->acc[best] -
+				   pwork->tot[best] * pg->k[i] / pwork->m2;
+			for (t = 0; t < n; t++) {
+				c = pwork->touched[t];
+				gain = pwork->acc[c] -
+				       pwork->tot[c] * pg->k[i] / pwork->m2;
+				if (gain > bestgain + COMM_MINGAIN) {
+					best = c;
+					bestgain = gain;
+				}
+			}
+			pwork->tot[best] += pg->k[i];
+			if (best != pwork->comm[i]) {
+				pwork->comm[i] = best;
+				moves++;
+			}
+			commclear(pwork, n);
+		}
+	}
+}
+
+static int commpairorder(const void *pa, const void *pb)
+{
+	const commpair_t *a = pa, *b = pb;
+
+	if (a->gain != b->gain)
+		return a->gain > b->gain ? -1 : 1;
+	if (a->c != b->c)
+		return a->c < b->c ? -1 : 1;
+
+	return a->d < b->d ? -1 : a->d > b->d;
+}
+
+// one round of merges towards target communities: each community proposes
+// the neighbour it would lose the least modularity merging with, the best
+// proposals are taken with each community in one merge at most, and the
+// communities with no neighbour are paired from the smallest
+static int commforce(const commgraph_t *pg, commwork_t *pwork,
+		     unsigned target)
+{
+	commpair_t *ppairs;
+	unsigned i, t, n, d, pairno = 0, isono = 0, left = pg->nodeno;
+	double gain;
+
+	ppairs = malloc((pg->nodeno + 1) * sizeof(*ppairs));
+	if (!ppairs)
+		return -1;
+
+	for (i = 0; i < pg->nodeno; i++) {
+		pwork->comm[i] = i;
+		pwork->merged[i] = 0;
+	}
+
+	for (i = 0; i < pg->nodeno; i++) {
+		if (pg->off[i] == pg->off[i + 1]) {
+			pwork->order[isono++] = i;
+			continue;
+		}
+		n = commweights(pg, pwork, i);
+		ppairs[pairno].gain = 0;
+		ppairs[pairno].c = i;
+		ppairs[pairno].d = TTREECOMM_NONE;
+		for (t = 0; t < n; t++) {
+			d = pwork->touched[t];
+			gain = pwork->acc[d] - pg->k[i] * pg->k[d] / pwork->m2;
+			if (ppairs[pairno].d == TTREECOMM_NONE ||
+			    gain > ppairs[pairno].gain ||
+			    (gain == ppairs[pairno].gain &&
+			     d < ppairs[pairno].d)) {
+				ppairs[pairno].gain = gain;
+				ppairs[pairno].d = d;
+			}
+		}
+		commclear(pwork, n);
+		pairno++;
+	}
+	qsort(ppairs, pairno, sizeof(*ppairs), commpairorder);
+
+	for (i = 0; i < pairno && left > target; i++) {
+		if (pwork->merged[ppairs[i].c] || pwork->merged[ppairs[i].d])
+			continue;
+		pwork->merged[ppairs[i].c] = pwork->merged[ppairs[i].d] = 1;
+		pwork->comm[ppairs[i].d] = ppairs[i].c;
+		left--;
+	}
+
+	// the smallest first, by insertion as they are few
+	for (i = 1; i < isono; i++)
+		for (t = i; t > 0 && pg->k[pwork->order[t]] <
+					 pg->k[pwork->order[t - 1]];
+		     t--) {
+			d = pwork->order[t];
+			pwork->order[t] = pwork->order[t - 1];
+			pwork->order[t - 1] = d;
+		}
+	for (i = 0; i + 1 < isono && left > target; i += 2) {
+		pwork->comm[pwork->order[i + 1]] = pwork->order[i];
+		left--;
+	}
+
+	free(ppairs);
+
+	return 0;
+}
+
+// number the communities of pwork->comm by their first node; returns how
+// many there are
+static unsigned commrenumber(commwork_t *pwork, unsigned nodeno)
+{
+	unsigned i, c, commno = 0;
+
+	// first[] maps an old number to the new one meanwhile
+	for (i = 0; i < nodeno; i++)
+		pwork->first[i] = TTREECOMM_NONE;
+	for (i = 0; i < nodeno; i++) {
+		c = pwork->comm[i];
+		if (pwork->first[c] == TTREECOMM_NONE)
+			pwork->first[c] = commno++;
+		pwork->comm[i] = pwork->first[c];
+	}
+
+	return commno;
+}
+
+// the next level: a node per community of pwork->comm
+static int commaggregate(const commgraph_t *pg, commwork_t *pwork,
+			 unsigned commno, commgraph_t *pnew)
+{
+	unsigned i, j, t, n, c, d, x, adjno = 0;
+
+	if (commgraphalloc(pnew, commno, pg->off[pg->nodeno]) != 0)
+		return -1;
+
+	// nodes by community, from pwork->first[c]
+	memset(pwork->first, 0, (commno + 1) * sizeof(unsigned));
+	for (i = 0; i < pg->nodeno; i++)
+		pwork->first[pwork->comm[i] + 1]++;
+	for (c = 0; c < commno; c++)
+		pwork->first[c + 1] += pwork->first[c];
+	for (i = 0; i < pg->nodeno; i++)
+		pwork->order[pwork->first[pwork->comm[i]]++] = i;
+	for (c = commno; c > 0; c--)
+		pwork->first[c] = pwork->first[c - 1];
+	pwork->first[0] = 0;
+
+	for (c = 0; c < commno; c++) {
+		n = 0;
+		for (j = pwork->first[c]; j < pwork->first[c + 1]; j++) {
+			x = pwork->order[j];
+			pnew->k[c] += pg->k[x];
+			pnew->in[c] += pg->in[x];
+			for (i = pg->off[x]; i < pg->off[x + 1]; i++) {
+				d = pwork->comm[pg->adj[i]];
+				if (d == c) {
+					pnew->in[c] += pg->w[i];
+					continue;
+				}
+				if (pwork->acc[d] == 0)
+					pwork->touched[n++] = d;
+				pwork->acc[d] += pg->w[i];
+			}
+		}
+		for (t = 0; t < n; t++) {
+			d = pwork->touched[t];
+			pnew->adj[adjno] = d;
+			pnew->w[adjno++] = pwork->acc[d];
+		}
+		commclear(pwork, n);
+		pnew->off[c + 1] = adjno;
+	}
+
+	return 0;
+}
+
+// Louvain: local moves, then a level made of the communities found, until
+// a level has no move; then, if there are more communities than target
+// (0 = no target), rounds of merges of the closest ones down to target
+ttreecomm_t *ttreecommbuild(const ttree_t *ptree, const unsigned *pnodes,
+			    unsigned nodeno, const unsigned *pbranches,
+			    unsigned branchno, unsigned target)
+{
+	ttreecomm_t *pcomm;
+	commgraph_t graph = {0}, next = {0}, *pg = &graph;
+	commwork_t work = {0};
+	unsigned *map = NULL;
+	double *deg = NULL;
+	unsigned i, c, commno;
+	int iErr = 0, force = 0;
+
+	pcomm = calloc(1, sizeof(*pcomm));
+	if (pcomm)
+		pcomm->nodecomm =
+		    malloc((ptree->nodeno + 1) * sizeof(unsigned));
+	map = malloc((nodeno + 1) * sizeof(unsigned));
+	deg = malloc((nodeno + 1) * sizeof(double));
+	work.comm = malloc((nodeno + 1) * sizeof(unsigned));
+	work.tot = malloc((nodeno + 1) * sizeof(double));
+	work.acc = calloc(nodeno + 1, sizeof(double));
+	work.touched = malloc((nodeno + 1) * sizeof(unsigned));
+	work.order = malloc((nodeno + 1) * sizeof(unsigned));
+	work.first = malloc((nodeno + 2) * sizeof(unsigned));
+	work.merged = malloc(nodeno + 1);
+	if (!pcomm || !pcomm->nodecomm || !map || !deg || !work.comm || !work.tot ||
+	    !work.acc || !work.touched || !work.order || !work.first ||
+	    !work.merged ||
+	    commgraphinit(ptree, pnodes, nodeno, pbranches, branchno, pg) !=
+		0) {
+		iErr = -1;
+		goto cleanup;
+	}
+
+	for (i = 0; i < nodeno; i++) {
+		map[i] = i;
+		deg[i] = pg->k[i];
+		work.m2 += pg->k[i];
+	}
+
+	for (;;) {
+		if (!force)
+			commlocal(pg, &work);
+		else if (commforce(pg, &work, target) != 0) {
+			iErr = -1;
+			break;
+		}
+		commno = commrenumber(&work, pg->nodeno);
+		if (commno == pg->nodeno) {
+			// no move: stop, or merge down to target
+			if (force || target == 0 || commno <= target)
+				break;
+			force = 1;
+			continue;
+		}
+		for (i = 0; i < nodeno; i++)
+			map[i] = work.comm[map[i]];
+		iErr = commaggregate(pg, &work, commno, &next);
+		if (iErr != 0)
+			break;
+		commgraphfree(pg);
+		graph = next;
+		memset(&next, 0, sizeof(next));
+		if (force && commno <= target)
+			break;
+	}
+	if (iErr != 0)
+		goto cleanup;
+
+	pcomm->commno = pg->nodeno;
+	pcomm->hub = malloc((pcomm->commno + 1) * sizeof(unsigned));
+	pcomm->size = calloc(pcomm->commno + 1, sizeof(unsigned));
+	if (!pcomm->hub || !pcomm->size) {
+		iErr = -1;
+		goto cleanup;
+	}
+
+	memset(pcomm->nodecomm, 0xff, (ptree->nodeno + 1) * sizeof(unsigned));
+	for (c = 0; c < pcomm->commno; c++) {
+		pcomm->hub[c] = TTREECOMM_NONE;
+		if (work.m2 > 0)
+			pcomm->modularity +=
+			    pg->in[c] / work.m2 -
+			    (pg->k[c] / work.m2) * (pg->k[c] / work.m2);
+	}
+
+	// the hub is the first node with the most calls among those given
+	for (i = 0; i < nodeno; i++) {
+		c = map[i];
+		pcomm->nodecomm[pnodes[i]] = c;
+		pcomm->size[c]++;
+		if (pcomm->hub[c] == TTREECOMM_NONE ||
+		    deg[i] > deg[pcomm->hub[c]])
+			pcomm->hub[c] = i;
+	}
+	for (c = 0; c < pcomm->commno; c++)
+		pcomm->hub[c] = pnodes[pcomm->hub[c]];
+
+cleanup:
+	if (iErr != 0) {
+		printf("\nMemory allocation error\n");
+		ttreecommfree(pcomm);
+		pcomm = NULL;
+	}
+	commgraphfree(&graph);
+	commgraphfree(&next);
+	free(map);
+	free(deg);
+	free(work.comm);
+	free(work.tot);
+	free(work.acc);
+	free(work.touched);
+	free(work.order);
+	free(work.first);
+	free(work.merged);
+
+	return pcomm;
+}
+
+void ttreecommfree(ttreecomm_t *pcomm)
+{
+	if (!pcomm)
+		return;
+
+	free(pcomm->nodecomm);
+	free(pcomm->hub);
+	free(pcomm->size);
+	free(pcomm);
+}
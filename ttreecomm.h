@@ -0,0 +1,51 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _TTREECOMM_H
+#define _TTREECOMM_H
+
+#ifndef _ALL_IN_ONE
+#include "ttree.h"
+#endif // _ALL_IN_ONE
+
+#define TTREECOMM_NONE 0xffffffffu // community of a node left out
+
+// communities of some nodes of a frozen tree: groups of functions calling
+// each other more than they call the rest, found on the calls among those
+// nodes taken in both directions
+typedef struct ttreecomm_st {
+	unsigned commno;      // number of communities
+	unsigned *nodecomm;   // community of each node or TTREECOMM_NONE
+	unsigned *hub;	      // node with the most calls, by community
+	unsigned *size;	      // nodes of each community
+	double modularity;    // of the communities found, in [-0.5, 1]
+} ttreecomm_t;
+
+ttreecomm_t *ttreecommbuild(const ttree_t *ptree, const unsigned *pnodes,
+			    unsigned nodeno, const unsigned *pbranches,
+			    unsigned branchno, unsigned target);
+void ttreecommfree(ttreecomm_t *pcomm);
+
+#endif // #ifndef _TTREECOMM_H
@@ -0,0 +1,235 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "ttreedom.h"
+#endif // _ALL_IN_ONE
+
+// the arrays of the algorithm are indexed by depth first number: 0 is the
+// virtual root, the nodes reached are numbered from 1
+typedef struct domstate_st {
+	unsigned *num;	    // depth first number of node id, 0 = not reached
+	unsigned *vertex;   // node id of number
+	unsigned *parent;   // parent in the depth first tree
+	unsigned *semi;	    // semidominator
+	unsigned *idom;	    // immediate dominator, when known
+	unsigned *ancestor; // forest of the vertices linked, TTREEDOM_NONE = root
+	unsigned *label;    // vertex with the lowest semi on the forest path
+	unsigned *bucket;   // first vertex of the bucket of vertex
+	unsigned *next;	    // next vertex in the same bucket
+	unsigned *path;	    // path compressed by domeval()
+} domstate_t;
+
+// number the nodes reached from the roots with a depth first scan, without
+// going through excluded nodes; returns the number of nodes reached
+static unsigned domnumber(const ttree_t *ptree, const ttreeset_t *proots,
+			  const ttreeset_t *pexcluded, domstate_t *pds,
+			  ttreeiter_t *iters)
+{
+	unsigned r, n = 0, top, v;
+	ttreenode_t *pnode;
+	ttreebranch_t *pbranch;
+
+	for (r = 0; r < proots->nodeno; r++) {
+		pnode = proots->nodes[r];
+		if (pds->num[pnode->id] != 0 ||
+		    ttreesetisin(pexcluded, pnode->id))
+			continue;
+
+		pds->num[pnode->id] = ++n;
+		pds->vertex[n] = pnode->id;
+		pds->parent[n] = 0;
+		ttreecallees(ptree, pnode, &iters[0]);
+		pds->path[0] = n;
+		top = 1;
+
+		// path is the stack of the scan here
+		while (top > 0) {
+			pbranch = ttreeiternext(&iters[top - 1]);
+			if (pbranch == NULL) {
+				top--;
+				continue;
+			}
+
+			pnode = pbranch->child.node;
+			if (pds->num[pnode->id] != 0 ||
+			    ttreesetisin(pexcluded, pnode->id))
+				continue;
+
+			v = ++n;
+			pds->num[pnode->id] = v;
+			pds->vertex[v] = pnode->id;
+			pds->parent[v] = pds->path[top - 1];
+			ttreecallees(ptree, pnode, &iters[top]);
+			pds->path[top++] = v;
+		}
+	}
+
+	return n;
+}
+
+// vertex with the lowest semidominator on the forest path from v, with path
+// compression; iterative, the path is first collected bottom up
+static unsigned domeval(domstate_t *pds, unsigned v)
+{
+	unsigned n = 0, u, a;
+
+	if (pds->ancestor[v] == TTREEDOM_NONE)
+		return v;
+
+	for (u = v; pds->ancestor[pds->ancestor[u]] != TTREEDOM_NONE;
+	     u = pds->ancestor[u])
+		pds->path[n++] = u;
+
+	// compress from the top of the path
+	while (n > 0) {
+		u = pds->path[--n];
+		a = pds->ancestor[u];
+		if (pds->semi[pds->label[a]] < pds->semi[pds->label[u]])
+			pds->label[u] = pds->label[a];
+		pds->ancestor[u] = pds->ancestor[a];
+	}
+
+	return pds->label[v];
+}
+
+// Lengauer-Tarjan algorithm, simple version with path compression only:
+// O(E log V), with no recursion
+ttreedom_t *ttreedombuild(const ttree_t *ptree, const ttreeset_t *proots,
+			  const ttreeset_t *pexcluded)
+{
+	ttreedom_t *pdom;
+	domstate_t ds;
+	ttreeiter_t *iters;
+	ttreebranch_t *pbranch;
+	ttreeiter_t iter;
+	unsigned n, i, w, v, u, p, size = ptree->nodeno + 2;
+
+	pdom = calloc(1, sizeof(*pdom));
+	iters = calloc(size, sizeof(*iters));
+	ds.num = calloc(size, sizeof(unsigned));
+	ds.vertex = calloc(size, sizeof(unsigned));
+	ds.parent = calloc(size, sizeof(unsigned));
+	ds.semi = calloc(size, sizeof(unsigned));
+	ds.idom = calloc(size, sizeof(unsigned));
+	ds.ancestor = calloc(size, sizeof(unsigned));
+	ds.label = calloc(size, sizeof(unsigned));
+	ds.bucket = calloc(size, sizeof(unsigned));
+	ds.next = calloc(size, sizeof(unsigned));
+	ds.path = calloc(size, sizeof(unsigned));
+	if (pdom) {
+		pdom->idom = malloc(size * sizeof(unsigned));
+		pdom->reached = bitsetalloc(ptree->nodeno);
+		pdom->order = calloc(size, sizeof(unsigned));
+	}
+	if (!pdom || !iters || !ds.num || !ds.vertex || !ds.parent ||
+	    !ds.semi || !ds.idom || !ds.ancestor || !ds.label || !ds.bucket ||
+	    !ds.next || !ds.path || !pdom->idom || !pdom->reached ||
+	    !pdom->order) {
+		printf("\nMemory allocation error\n");
+		ttreedomfree(pdom);
+		pdom = NULL;
+		goto cleanup;
+	}
+
+	n = domnumber(ptree, proots, pexcluded, &ds, iters);
+
+	for (v = 0; v <= n; v++) {
+		ds.semi[v] = ds.label[v] = v;
+		ds.ancestor[v] = ds.bucket[v] = TTREEDOM_NONE;
+	}
+
+	for (w = n; w >= 1; w--) {
+		// semidominator: the lowest vertex reaching w through
+		// vertices numbered above w
+		if (ttreesetisin(proots, ds.vertex[w]))
+			ds.semi[w] = 0; // called by the virtual root
+		ttreecallers(ptree, ptree->nodes[ds.vertex[w]], &iter);
+		while ((pbranch = ttreeiternext(&iter)) != NULL) {
+			v = ds.num[pbranch->parent.node->id];
+			if (v == 0)
+				continue; // not reached or excluded
+			u = domeval(&ds, v);
+			if (ds.semi[u] < ds.semi[w])
+				ds.semi[w] = ds.semi[u];
+		}
+		ds.next[w] = ds.bucket[ds.semi[w]];
+		ds.bucket[ds.semi[w]] = w;
+
+		// link w to its parent, then settle the bucket of the parent
+		p = ds.parent[w];
+		ds.ancestor[w] = p;
+		for (v = ds.bucket[p]; v != TTREEDOM_NONE; v = ds.next[v]) {
+			u = domeval(&ds, v);
+			ds.idom[v] = ds.semi[u] < ds.semi[v] ? u : p;
+		}
+		ds.bucket[p] = TTREEDOM_NONE;
+	}
+
+	for (w = 1; w <= n; w++)
+		if (ds.idom[w] != ds.semi[w])
+			ds.idom[w] = ds.idom[ds.idom[w]];
+
+	memset(pdom->idom, 0xff, size * sizeof(unsigned));
+	for (w = 1; w <= n; w++) {
+		i = ds.vertex[w];
+		bitsetset(pdom->reached, i);
+		pdom->order[w - 1] = i;
+		if (ds.idom[w] != 0)
+			pdom->idom[i] = ds.vertex[ds.idom[w]];
+	}
+	pdom->reachedno = n;
+
+cleanup:
+	free(iters);
+	free(ds.num);
+	free(ds.vertex);
+	free(ds.parent);
+	free(ds.semi);
+	free(ds.idom);
+	free(ds.ancestor);
+	free(ds.label);
+	free(ds.bucket);
+	free(ds.next);
+	free(ds.path);
+
+	return pdom;
+}
+
+void ttreedomfree(ttreedom_t *pdom)
+{
+	if (!pdom)
+		return;
+
+	free(pdom->idom);
+	free(pdom->reached);
+	free(pdom->order);
+	free(pdom);
+}
@@ -0,0 +1,52 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _TTREEDOM_H
+#define _TTREEDOM_H
+
+#ifndef _ALL_IN_ONE
+#include "bitset.h"
+#include "ttree.h"
+#include "ttreesel.h"
+#endif // _ALL_IN_ONE
+
+#define TTREEDOM_NONE 0xffffffffu // no immediate dominator
+
+// dominator tree of the nodes reached from a set of roots: a node dominates
+// another one if every call path from the roots to the other one goes
+// through it; the roots hang from a virtual node calling all of them, so the
+// nodes dominated by no single function have no immediate dominator
+typedef struct ttreedom_st {
+	unsigned *idom;	    // immediate dominator of node id
+	bitset_t *reached;  // node reached from the roots
+	unsigned reachedno; // number of nodes reached
+	unsigned *order;    // nodes reached, in depth first order
+} ttreedom_t;
+
+ttreedom_t *ttreedombuild(const ttree_t *ptree, const ttreeset_t *proots,
+			  const ttreeset_t *pexcluded);
+void ttreedomfree(ttreedom_t *pdom);
+
+#endif // #ifndef _TTREEDOM_H
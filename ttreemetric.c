@@ -0,0 +1,395 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "ttreemetric.h"
+#include "ttreescc.h"
+#endif // _ALL_IN_ONE
+
+#include <ccan/ilog/ilog.h>
+
+// HyperLogLog sketches of sets of nodes: a node goes to the register picked
+// by the first bits of its hash, which keeps the most leading zeros seen in
+// the other bits; the standard error of the estimates is 1.04 / sqrt(regs),
+// 3.3% with 1024 registers of one byte
+#define METRIC_HLLBITS 10
+#define METRIC_HLLREGS (1u << METRIC_HLLBITS)
+
+// small sets are kept as the sorted list of their node ids instead, in the
+// same memory as the registers, so that their size is exact
+#define METRIC_SPARSEMAX (METRIC_HLLREGS / sizeof(unsigned))
+#define METRIC_DENSE 0xffffffffu // idno of a set sketched in registers
+
+typedef struct metricset_st {
+	unsigned idno; // node ids listed or METRIC_DENSE
+	union {
+		unsigned ids[METRIC_SPARSEMAX]; // sorted, while sparse
+		uint8_t regs[METRIC_HLLREGS];	// once dense
+	};
+} metricset_t;
+
+// 64 bit finalizer, so that close node ids have unrelated hashes
+static uint64_t metrichash(unsigned id)
+{
+	uint64_t z = id + 0x9e3779b97f4a7c15ULL;
+
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+
+	return z ^ (z >> 31);
+}
+
+static void metrichlladd(uint8_t *pregs, unsigned id)
+{
+	uint64_t h = metrichash(id);
+	unsigned r = h >> (64 - METRIC_HLLBITS);
+	// the bit set below the others bounds the rank
+	uint8_t rank = 65 - ilog64(h << METRIC_HLLBITS |
+				   1ULL << (METRIC_HLLBITS - 1));
+
+	if (rank > pregs[r])
+		pregs[r] = rank;
+}
+
+static void metrichllmerge(uint8_t *restrict pto,
+			   const uint8_t *restrict pfrom)
+{
+	unsigned r;
+
+	for (r = 0; r < METRIC_HLLREGS; r++)
+		if (pfrom[r] > pto[r])
+			pto[r] = pfrom[r];
+}
+
+// estimated size of the set, counting the empty registers for small sets;
+// ppow[r] is 2^-r
+static double metrichllcount(const uint8_t *pregs, const double *ppow)
+{
+	double m = METRIC_HLLREGS, sum = 0, e;
+	unsigned r, zeros = 0;
+
+	for (r = 0; r < METRIC_HLLREGS; r++) {
+		sum += ppow[pregs[r]];
+		zeros += pregs[r] == 0;
+	}
+
+	e = 0.7213 / (1 + 1.079 / m) * m * m / sum;
+	if (e <= 2.5 * m && zeros > 0)
+		e = m * log(m / zeros);
+
+	return e;
+}
+
+// turn a list of ids into registers
+static void metricsetdense(metricset_t *pset)
+{
+	unsigned ids[METRIC_SPARSEMAX];
+	unsigned i, idno = pset->idno;
+
+	if (idno == METRIC_DENSE)
+		return;
+
+	memcpy(ids, pset->ids, idno * sizeof(unsigned));
+	memset(pset->regs, 0, METRIC_HLLREGS);
+	for (i = 0; i < idno; i++)
+		metrichlladd(pset->regs, ids[i]);
+	pset->idno = METRIC_DENSE;
+}
+
+// add the ids of a sorted list to a set, which gets dense once the union
+// is past METRIC_SPARSEMAX ids
+static void metricsetaddids(metricset_t *pset, const unsigned *pids,
+			    unsigned idno)
+{
+	unsigned ids[2 * METRIC_SPARSEMAX];
+	unsigned i = 0, j = 0, n = 0;
+
+	if (pset->idno == METRIC_DENSE) {
+		for (j = 0; j < idno; j++)
+			metrichlladd(pset->regs, pids[j]);
+		return;
+	}
+
+	// union of the two sorted lists
+	while (i < pset->idno || j < idno) {
+		if (j == idno || (i < pset->idno && pset->ids[i] < pids[j]))
+			ids[n++] = pset->ids[i++];
+		else if (i == pset->idno || pids[j] < pset->ids[i])
+			ids[n++] = pids[j++];
+		else {
+			ids[n++] = pset->ids[i++];
+			j++;
+		}
+	}
+	if (n <= METRIC_SPARSEMAX) {
+		memcpy(pset->ids, ids, n * sizeof(unsigned));
+		pset->idno = n;
+		return;
+	}
+
+	memset(pset->regs, 0, METRIC_HLLREGS);
+	for (i = 0; i < n; i++)
+		metrichlladd(pset->regs, ids[i]);
+	pset->idno = METRIC_DENSE;
+}
+
+static void metricsetadd(metricset_t *pset, unsigned id)
+{
+	metricsetaddids(pset, &id, 1);
+}
+
+static void metricsetmerge(metricset_t *pto, const metricset_t *pfrom)
+{
+	if (pfrom->idno != METRIC_DENSE) {
+		metricsetaddids(pto, pfrom->ids, pfrom->idno);
+	} else {
+		metricsetdense(pto);
+		metrichllmerge(pto->regs, pfrom->regs);
+	}
+}
+
+// exact size of a list, estimated one of registers
+static double metricsetcount(const metricset_t *pset, const double *ppow)
+{
+	if (pset->idno != METRIC_DENSE)
+		return pset->idno;
+
+	return metrichllcount(pset->regs, ppow);
+}
+
+// functions reached by the calls of every node (callees) or reaching it
+// (callers): each component sketches its own nodes and the sketches of the
+// components it calls (or is called by), in one pass over the components in
+// topological order; a sketch is freed as soon as the last component using
+// it is done, so only the ones still needed are kept. Counts up to
+// METRIC_SPARSEMAX are exact
+static int metricclosure(const ttreescc_t *pscc, const ttreeset_t *pexcluded,
+			 int callees, unsigned *pcount)
+{
+	metricset_t **psketch;
+	unsigned *prefs = NULL;
+	unsigned c, s, i, d, x;
+	double e, pow[66];
+	int iErr = 0;
+
+	// ranks go up to 65 - METRIC_HLLBITS
+	for (pow[0] = 1, i = 1; i < 66; i++)
+		pow[i] = pow[i - 1] / 2;
+
+	psketch = calloc(pscc->sccno + 1, sizeof(*psketch));
+	if (callees)
+		prefs = calloc(pscc->sccno + 1, sizeof(unsigned));
+	if (!psketch || (callees && !prefs)) {
+		free(psketch);
+		return -1;
+	}
+
+	// callees need the components they call done first, the lower ids;
+	// prefs counts the callers still to use a sketch
+	for (c = 0; callees && c < pscc->succoff[pscc->sccno]; c++)
+		prefs[pscc->succ[c]]++;
+
+	for (s = 0; s < pscc->sccno; s++) {
+		c = callees ? s : pscc->sccno - 1 - s;
+		x = pscc->sccnodes[pscc->sccoff[c]];
+		if (ttreesetisin(pexcluded, x))
+			continue; // alone in its component, with no calls
+
+		if (!psketch[c])
+			psketch[c] = calloc(1, sizeof(metricset_t));
+		if (!psketch[c]) {
+			iErr = -1;
+			break;
+		}
+		for (i = pscc->sccoff[c]; i < pscc->sccoff[c + 1]; i++)
+			metricsetadd(psketch[c], pscc->sccnodes[i]);
+
+		for (i = pscc->succoff[c]; callees && i < pscc->succoff[c + 1];
+		     i++) {
+			d = pscc->succ[i];
+			metricsetmerge(psketch[c], psketch[d]);
+			if (--prefs[d] == 0) {
+				free(psketch[d]);
+				psketch[d] = NULL;
+			}
+		}
+
+		// a function is among its callees and callers only if
+		// recursive
+		e = metricsetcount(psketch[c], pow) -
+		    !ttreesccrecursive(pscc, c) + 0.5;
+		for (i = pscc->sccoff[c]; i < pscc->sccoff[c + 1]; i++)
+			pcount[pscc->sccnodes[i]] = e > 0 ? (unsigned)e : 0;
+
+		// callers are pushed to the components called, the lower
+		// ids
+		for (i = pscc->succoff[c]; !callees && i < pscc->succoff[c + 1];
+		     i++) {
+			d = pscc->succ[i];
+			if (!psketch[d])
+				psketch[d] = calloc(1, sizeof(metricset_t));
+			if (!psketch[d]) {
+				iErr = -1;
+				break;
+			}
+			metricsetmerge(psketch[d], psketch[c]);
+		}
+		if (!callees || prefs[c] == 0) {
+			free(psketch[c]);
+			psketch[c] = NULL;
+		}
+		if (iErr != 0)
+			break;
+	}
+
+	for (c = 0; c < pscc->sccno; c++)
+		free(psketch[c]);
+	free(psketch);
+	free(prefs);
+
+	return iErr;
+}
+
+// one pass over the callees of every node for the counts, where a call is
+// counted once per pair of functions thanks to the stamps of the last node
+// counting it; then a breadth first scan from the roots for the depths and
+// a pass in each direction over the recursive groups for the callees and
+// callers
+ttreemetric_t *ttreemetricbuild(const ttree_t *ptree, const ttreeset_t *proots,
+				const ttreeset_t *pexcluded)
+{
+	ttreemetric_t *pmetric;
+	ttreescc_t *pscc = NULL;
+	unsigned *calleestamp, *filestamp, *queue;
+	unsigned i, c, f, head = 0, tail = 0;
+	ttreebranch_t *pbranch;
+	ttreenode_t *pnode;
+	ttreeiter_t iter;
+
+	pmetric = calloc(1, sizeof(*pmetric));
+	calleestamp = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	filestamp = calloc(ptree->fileno + 1, sizeof(unsigned));
+	queue = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	if (pmetric) {
+		pmetric->fanin = calloc(ptree->nodeno + 1, sizeof(unsigned));
+		pmetric->fanout = calloc(ptree->nodeno + 1, sizeof(unsigned));
+		pmetric->files = calloc(ptree->nodeno + 1, sizeof(unsigned));
+		pmetric->depth = malloc((ptree->nodeno + 1) * sizeof(unsigned));
+		pmetric->callees = calloc(ptree->nodeno + 1, sizeof(unsigned));
+		pmetric->callers = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	}
+	if (!pmetric || !calleestamp || !filestamp || !queue ||
+	    !pmetric->fanin || !pmetric->fanout || !pmetric->files ||
+	    !pmetric->depth || !pmetric->callees || !pmetric->callers) {
+		printf("\nMemory allocation error\n");
+		ttreemetricfree(pmetric);
+		pmetric = NULL;
+		goto cleanup;
+	}
+
+	for (i = 0; i < ptree->nodeno; i++) {
+		if (ttreesetisin(pexcluded, i))
+			continue;
+
+		// the stamp of node i is i + 1, so that 0 is no stamp
+		ttreecallees(ptree, ptree->nodes[i], &iter);
+		while ((pbranch = ttreeiternext(&iter)) != NULL) {
+			pnode = pbranch->child.node;
+			c = pnode->id;
+			if (calleestamp[c] == i + 1 ||
+			    ttreesetisin(pexcluded, c))
+				continue;
+			calleestamp[c] = i + 1;
+			pmetric->fanout[i]++;
+			pmetric->fanin[c]++;
+
+			f = pnode->fileid;
+			if (f != TTREE_NOFILE && filestamp[f] != i + 1) {
+				filestamp[f] = i + 1;
+				pmetric->files[i]++;
+			}
+		}
+	}
+
+	memset(pmetric->depth, 0xff, (ptree->nodeno + 1) * sizeof(unsigned));
+	for (i = 0; i < proots->nodeno; i++) {
+		c = proots->nodes[i]->id;
+		if (pmetric->depth[c] != TTREEMETRIC_NODEPTH ||
+		    ttreesetisin(pexcluded, c))
+			continue;
+		pmetric->depth[c] = 0;
+		queue[tail++] = c;
+	}
+	while (head < tail) {
+		i = queue[head++];
+		ttreecallees(ptree, ptree->nodes[i], &iter);
+		while ((pbranch = ttreeiternext(&iter)) != NULL) {
+			c = pbranch->child.node->id;
+			if (pmetric->depth[c] != TTREEMETRIC_NODEPTH ||
+			    ttreesetisin(pexcluded, c))
+				continue;
+			pmetric->depth[c] = pmetric->depth[i] + 1;
+			queue[tail++] = c;
+		}
+	}
+
+	pscc = ttreesccbuild(ptree, pexcluded);
+	if (!pscc || metricclosure(pscc, pexcluded, 1, pmetric->callees) != 0 ||
+	    metricclosure(pscc, pexcluded, 0, pmetric->callers) != 0) {
+		if (pscc)
+			printf("\nMemory allocation error\n");
+		ttreemetricfree(pmetric);
+		pmetric = NULL;
+	}
+
+cleanup:
+	ttreesccfree(pscc);
+	free(calleestamp);
+	free(filestamp);
+	free(queue);
+
+	return pmetric;
+}
+
+void ttreemetricfree(ttreemetric_t *pmetric)
+{
+	if (!pmetric)
+		return;
+
+	free(pmetric->fanin);
+	free(pmetric->fanout);
+	free(pmetric->files);
+	free(pmetric->depth);
+	free(pmetric->callees);
+	free(pmetric->callers);
+	free(pmetric);
+}
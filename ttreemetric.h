@@ -0,0 +1,50 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _TTREEMETRIC_H
+#define _TTREEMETRIC_H
+
+#ifndef _ALL_IN_ONE
+#include "ttree.h"
+#include "ttreesel.h"
+#endif // _ALL_IN_ONE
+
+#define TTREEMETRIC_NODEPTH 0xffffffffu // depth of a node not reached
+
+// metrics of every node of a frozen tree, leaving out the excluded nodes
+typedef struct ttreemetric_st {
+	unsigned *fanin;  // distinct functions calling the node
+	unsigned *fanout; // distinct functions called by the node
+	unsigned *files;  // distinct files defining the functions called
+	unsigned *depth;  // fewest calls from a root or TTREEMETRIC_NODEPTH
+	unsigned *callees; // functions called directly or not, estimated
+	unsigned *callers; // functions calling directly or not, estimated
+} ttreemetric_t;
+
+ttreemetric_t *ttreemetricbuild(const ttree_t *ptree, const ttreeset_t *proots,
+				const ttreeset_t *pexcluded);
+void ttreemetricfree(ttreemetric_t *pmetric);
+
+#endif // #ifndef _TTREEMETRIC_H
@@ -26,35 +26,88 @@
 #ifndef _TTREEPARAM_H
 #define _TTREEPARAM_H
 
-#define TT_MAXROOTS 5  // maximum number of roots
 #define TT_MAXSTYLES 6 // maximum number of styles + colors
-#define TT_MAXEXCLUDF                                                          \
-	20 // maximum number of functions that can be excluded from tree
 
 #define TT_LIBRARY "LIBRARY" // name for library functions cluster
 
 // maybe in the future we will have output for tools different from graphviz:
 typedef enum treeouttype_e {
 	TREEOUT_GRAPHVIZ, // graphviz output file
+	TREEOUT_TEXT,	  // plain text, for queries
+	TREEOUT_JSON,	  // JSON, for queries
+	TREEOUT_CSV,	  // comma separated values, for reports
+	TREEOUT_BINARY,	  // packed binary, for the reachability matrix
 	TREEOUT_MAXNUM    // valid values below this
 } treeouttype_t;
 
+// what is made of the tree
+typedef enum treemode_e {
+	TREEMODE_TREE,	// call tree (default)
+	TREEMODE_PATHS, // call paths from roots to call path ends
+	TREEMODE_RECURSION, // report of the recursive function groups
+	TREEMODE_REACH,	    // answers to reachability queries
+	TREEMODE_DOMINATORS, // dominator tree from the roots
+	TREEMODE_METRICS,    // metrics of every function
+	TREEMODE_DEAD,	     // functions not reached from the roots
+	TREEMODE_MATRIX,     // roots reaching each function
+	TREEMODE_BETWEENNESS, // functions on the most shortest call chains
+	TREEMODE_DIFF,	      // calls added and removed since another database
+	TREEMODE_IMPACT,      // functions and roots reached by changed lines
+	TREEMODE_STACK,	      // worst stack usage from the roots
+	TREEMODE_SIZES,	      // code size reached from the roots
+	TREEMODE_PROFILE,     // hot call graph of a runtime profile
+} treemode_t;
+
+// how the recursive function groups are shown in the call tree
+typedef enum treecondense_e {
+	TREECONDENSE_NONE,    // as any other function (default)
+	TREECONDENSE_CLUSTER, // each group in a cluster
+	TREECONDENSE_NODE,    // each group as one node
+} treecondense_t;
+
+// kind of call paths listed in TREEMODE_PATHS
+typedef enum treepaths_e {
+	TREEPATHS_SHORTEST,  // the shortest one
+	TREEPATHS_KSHORTEST, // the pathno shortest ones
+	TREEPATHS_ALL,	     // all simple paths up to pathlen calls
+} treepaths_t;
+
 typedef struct treeparam_st {
+	treemode_t mode;       // what is made of the tree
 	treeouttype_t outtype; // type of output file
 	int printfile;	 // print filename of call near to branch if != 0
 	int doclusters; // group functions into a cluster for each source file
+	int autoclusters; // group functions into a cluster per community
+	int clusterno;	  // communities wanted at most, 0 = as found
 	int fdepth;     // depth of callees tree (-1 = maximum)
 	int bdepth;     // depth of callers tree (-1 = maximum)
+	int threadno;   // threads of the breadth first scan (0 = depth first)
 	char *infile;   // input file (not compressed cscope output file)
 	char *outfile;  // output file to use as input for graphviz-dot
 	char *shortdbfile;	    // shortened cscope output file
-	char *root[TT_MAXROOTS];      // root function names
+	char **root;		      // root function names
 	int rootno;		      // number of root functions
-	char *callp;		      // highlighted call path function name
-	int hlstyle;		      // highlight style
-	char *excludf[TT_MAXEXCLUDF]; // functions to be excluded from tree
+	char **callp;		      // highlighted call path function names
+	int callpno;		      // number of highlighted call paths
+	int *hlstyle;		      // highlight style of each call path
+	int hlstyleno;		      // number of highlight styles
+	char **excludf;		      // functions to be excluded from tree
 	int excludfno; // number of functions to be excluded from tree
 	int verbose;   // verbose output
+	treepaths_t paths; // kind of call paths listed
+	int pathno;	   // number of call paths listed (kshortest)
+	int pathlen;	   // maximum calls in a call path (all)
+	treecondense_t condense; // how recursive groups are shown in the tree
+	char *reachfile;	 // reachability queries file, - = stdin
+	char *domsel;		 // functions whose dominators are output
+	int topno;		 // functions in each table of metrics
+	int betwsamples; // sources of the betweenness (0 = all functions)
+	char *difffile;	 // old cscope output file compared with infile
+	char *impactfile; // changed lines file, - = stdin
+	char *stackfile;  // stack usage file of gcc, - = stdin
+	char *sizefile;	  // symbol size file of nm, - = stdin
+	char *proffile;	  // folded stacks file of a profiler, - = stdin
+	double profpct;	  // percent of the samples of hot functions, calls
 } treeparam_t;
 
 #endif // #ifndef _TTREEPARAM_H
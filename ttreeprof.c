@@ -0,0 +1,131 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "ttreeprof.h"
+#endif // _ALL_IN_ONE
+
+ttreeprof_t *ttreeprofinit(const ttree_t *ptree)
+{
+	ttreeprof_t *pprof;
+
+	pprof = calloc(1, sizeof(ttreeprof_t));
+	if (!pprof) {
+		printf("\nMemory allocation error\n");
+		return NULL;
+	}
+
+	pprof->incl = calloc(ptree->nodeno + 1, sizeof(unsigned long));
+	pprof->self = calloc(ptree->nodeno + 1, sizeof(unsigned long));
+	pprof->calls = calloc(ptree->branchno + 1, sizeof(unsigned long));
+	pprof->nodestamp = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	pprof->branchstamp = calloc(ptree->branchno + 1, sizeof(unsigned));
+	if (!pprof->incl || !pprof->self || !pprof->calls ||
+	    !pprof->nodestamp || !pprof->branchstamp) {
+		printf("\nMemory allocation error\n");
+		ttreeproffree(pprof);
+		return NULL;
+	}
+
+	return pprof;
+}
+
+// the branch of a call from any definition of the caller name to the callee
+// name: a sampled frame only has the name of its function
+static ttreebranch_t *proffindcall(const ttree_t *ptree,
+				   const ttreenode_t *pcaller,
+				   const ttreenode_t *pcallee)
+{
+	const ttreenode_t *pdef;
+	ttreebranch_t *pbranch;
+	ttreeiter_t iter;
+
+	for (pdef = ptree->namenode[pcaller->nameid]; pdef;
+	     pdef = pdef->nextdef) {
+		ttreecallees(ptree, pdef, &iter);
+		while ((pbranch = ttreeiternext(&iter)) != NULL)
+			if (pbranch->child.node->nameid == pcallee->nameid)
+				return pbranch;
+	}
+
+	return NULL;
+}
+
+// add count samples of a stack, from its outermost frame to the top one; a
+// NULL frame, matching no function, breaks the calls around it
+void ttreeprofstack(ttreeprof_t *pprof, const ttree_t *ptree,
+		    ttreenode_t *const *pframes, unsigned frameno,
+		    unsigned long count)
+{
+	ttreebranch_t *pbranch;
+	unsigned f, stamp = ++pprof->stackno;
+	int missed = 0;
+
+	pprof->total += count;
+	if (frameno && pframes[frameno - 1])
+		pprof->self[pframes[frameno - 1]->id] += count;
+
+	for (f = 0; f < frameno; f++) {
+		if (!pframes[f])
+			continue;
+		if (pprof->nodestamp[pframes[f]->id] != stamp) {
+			pprof->nodestamp[pframes[f]->id] = stamp;
+			pprof->incl[pframes[f]->id] += count;
+		}
+		if (f == 0 || !pframes[f - 1])
+			continue;
+
+		// calls through a function pointer or an inlined function
+		// are not in the tree
+		pbranch = proffindcall(ptree, pframes[f - 1], pframes[f]);
+		if (!pbranch) {
+			missed = 1;
+			continue;
+		}
+		if (pprof->branchstamp[pbranch->id] != stamp) {
+			pprof->branchstamp[pbranch->id] = stamp;
+			pprof->calls[pbranch->id] += count;
+		}
+	}
+	if (missed)
+		pprof->missed += count;
+}
+
+void ttreeproffree(ttreeprof_t *pprof)
+{
+	if (!pprof)
+		return;
+
+	free(pprof->incl);
+	free(pprof->self);
+	free(pprof->calls);
+	free(pprof->nodestamp);
+	free(pprof->branchstamp);
+	free(pprof);
+}
@@ -0,0 +1,52 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _TTREEPROF_H
+#define _TTREEPROF_H
+
+#ifndef _ALL_IN_ONE
+#include "ttree.h"
+#endif // _ALL_IN_ONE
+
+// samples of a runtime profile mapped on a frozen tree: each sampled stack
+// counts once for every function and call on it, even when recursive
+typedef struct ttreeprof_st {
+	unsigned long *incl;  // samples with the node on the stack
+	unsigned long *self;  // samples with the node on top of the stack
+	unsigned long *calls; // samples with the branch on the stack
+	unsigned long total;  // samples
+	unsigned long missed; // samples of calls not in the tree
+	unsigned *nodestamp;  // last stack counting the node
+	unsigned *branchstamp; // last stack counting the branch
+	unsigned stackno;      // stacks added
+} ttreeprof_t;
+
+ttreeprof_t *ttreeprofinit(const ttree_t *ptree);
+void ttreeprofstack(ttreeprof_t *pprof, const ttree_t *ptree,
+		    ttreenode_t *const *pframes, unsigned frameno,
+		    unsigned long count);
+void ttreeproffree(ttreeprof_t *pprof);
+
+#endif // #ifndef _TTREEPROF_H
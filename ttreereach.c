@@ -0,0 +1,253 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "ttreereach.h"
+#endif // _ALL_IN_ONE
+
+#define LABELS TTREEREACH_LABELS
+
+// frame of the explicit stack of reachlabel()
+typedef struct reachframe_st {
+	unsigned scc;	// component
+	unsigned first; // first successor visited, different for each label
+	unsigned next;	// successors visited so far
+} reachframe_t;
+
+// longest call chain from each component: callees have lower ids, so their
+// level is known
+static void reachlevel(ttreereach_t *preach)
+{
+	const ttreescc_t *pscc = preach->pscc;
+	unsigned c, i, n;
+
+	for (c = 0; c < pscc->sccno; c++) {
+		for (n = 0, i = pscc->succoff[c]; i < pscc->succoff[c + 1]; i++)
+			if (preach->level[pscc->succ[i]] + 1 > n)
+				n = preach->level[pscc->succ[i]] + 1;
+		preach->level[c] = n;
+	}
+}
+
+// label l of every component, from a depth first scan visiting the
+// successors of each component from a different one for each label, so
+// that the intervals are as independent as possible
+static void reachlabel(ttreereach_t *preach, reachframe_t *frames,
+		       unsigned l)
+{
+	const ttreescc_t *pscc = preach->pscc;
+	unsigned sccno = pscc->sccno;
+	unsigned s, c, d, deg, frameno, rank = 0, prerank = 0;
+	reachframe_t *pframe;
+
+	// mark: scan started from the component
+	preach->epoch++;
+
+	for (s = 0; s < sccno; s++) {
+		// sources have the highest ids: start from them first, in a
+		// different order for odd labels
+		c = l % 2 ? s : sccno - 1 - s;
+		if (preach->mark[c] == preach->epoch)
+			continue;
+
+		preach->mark[c] = preach->epoch;
+		if (l == 0)
+			preach->pre[c] = prerank++;
+		deg = pscc->succoff[c + 1] - pscc->succoff[c];
+		frames[0].scc = c;
+		frames[0].first = deg ? (c * 2654435761u + l) % deg : 0;
+		frames[0].next = 0;
+		preach->low[c * LABELS + l] = UINT32_MAX;
+		frameno = 1;
+
+		while (frameno > 0) {
+			pframe = &frames[frameno - 1];
+			c = pframe->scc;
+			deg = pscc->succoff[c + 1] - pscc->succoff[c];
+			if (pframe->next < deg) {
+				d = pscc->succ[pscc->succoff[c] +
+						 (pframe->first + pframe->next++) %
+						     deg];
+				if (preach->mark[d] != preach->epoch) {
+					preach->mark[d] = preach->epoch;
+					if (l == 0)
+						preach->pre[d] = prerank++;
+					deg = pscc->succoff[d + 1] -
+					      pscc->succoff[d];
+					frames[frameno].scc = d;
+					frames[frameno].first =
+					    deg ? (d * 2654435761u + l) % deg : 0;
+					frames[frameno].next = 0;
+					preach->low[d * LABELS + l] = UINT32_MAX;
+					frameno++;
+				} else if (preach->low[d * LABELS + l] <
+					   preach->low[c * LABELS + l])
+					preach->low[c * LABELS + l] =
+					    preach->low[d * LABELS + l];
+				continue;
+			}
+
+			// all successors done: c gets its post order rank
+			preach->post[c * LABELS + l] = rank;
+			if (rank < preach->low[c * LABELS + l])
+				preach->low[c * LABELS + l] = rank;
+			rank++;
+			frameno--;
+			if (frameno > 0 &&
+			    preach->low[c * LABELS + l] <
+				preach->low[frames[frameno - 1].scc * LABELS + l])
+				preach->low[frames[frameno - 1].scc * LABELS + l] =
+				    preach->low[c * LABELS + l];
+		}
+	}
+}
+
+ttreereach_t *ttreereachbuild(const ttree_t *ptree, const ttreescc_t *pscc)
+{
+	ttreereach_t *preach;
+	reachframe_t *frames;
+	unsigned l, n = pscc->sccno + 1;
+
+	preach = calloc(1, sizeof(*preach));
+	if (!preach) {
+		printf("\nMemory allocation error\n");
+		return NULL;
+	}
+
+	preach->ptree = ptree;
+	preach->pscc = pscc;
+	preach->level = calloc(n, sizeof(unsigned));
+	preach->low = calloc(n * LABELS, sizeof(unsigned));
+	preach->post = calloc(n * LABELS, sizeof(unsigned));
+	preach->pre = calloc(n, sizeof(unsigned));
+	preach->mark = calloc(n, sizeof(unsigned));
+	preach->stack = calloc(n, sizeof(unsigned));
+	frames = calloc(n, sizeof(*frames));
+	if (!preach->level || !preach->low ||
+	    !preach->post || !preach->pre || !preach->mark || !preach->stack ||
+	    !frames) {
+		printf("\nMemory allocation error\n");
+		free(frames);
+		ttreereachfree(preach);
+		return NULL;
+	}
+
+	reachlevel(preach);
+	for (l = 0; l < LABELS; l++)
+		reachlabel(preach, frames, l);
+
+	free(frames);
+
+	return preach;
+}
+
+void ttreereachfree(ttreereach_t *preach)
+{
+	if (!preach)
+		return;
+
+	free(preach->level);
+	free(preach->low);
+	free(preach->post);
+	free(preach->pre);
+	free(preach->mark);
+	free(preach->stack);
+	free(preach);
+}
+
+// 0 if the labels prove that component c can't reach component d, 1 if they
+// prove it can, -1 if they can't tell
+static int reachlabels(const ttreereach_t *preach, unsigned c, unsigned d)
+{
+	unsigned l;
+
+	if (preach->level[c] <= preach->level[d])
+		return 0;
+
+	for (l = 0; l < LABELS; l++)
+		if (preach->low[d * LABELS + l] < preach->low[c * LABELS + l] ||
+		    preach->post[d * LABELS + l] > preach->post[c * LABELS + l])
+			return 0;
+
+	// d in the subtree of c in the first scan
+	if (preach->pre[c] <= preach->pre[d] && preach->post[d * LABELS] <= preach->post[c * LABELS])
+		return 1;
+
+	return -1;
+}
+
+// 1 if the function of node id from calls the one of node id to, directly
+// or not, else 0; a function reaches itself
+int ttreereach(ttreereach_t *preach, unsigned from, unsigned to)
+{
+	const ttreescc_t *pscc = preach->pscc;
+	unsigned c = pscc->nodescc[from];
+	unsigned d = pscc->nodescc[to];
+	unsigned i, e, stackno = 0;
+	int r;
+
+	preach->queryno++;
+
+	if (c == d)
+		return 1;
+
+	r = reachlabels(preach, c, d);
+	if (r >= 0)
+		return r;
+
+	// search the components the labels can't rule out
+	preach->searchno++;
+	if (++preach->epoch == 0) {
+		memset(preach->mark, 0,
+		       pscc->sccno * sizeof(unsigned));
+		preach->epoch = 1;
+	}
+
+	preach->mark[c] = preach->epoch;
+	preach->stack[stackno++] = c;
+	while (stackno > 0) {
+		c = preach->stack[--stackno];
+		for (i = pscc->succoff[c]; i < pscc->succoff[c + 1]; i++) {
+			e = pscc->succ[i];
+			if (e == d)
+				return 1;
+			if (preach->mark[e] == preach->epoch)
+				continue;
+			preach->mark[e] = preach->epoch;
+			r = reachlabels(preach, e, d);
+			if (r == 1)
+				return 1;
+			if (r < 0)
+				preach->stack[stackno++] = e;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,69 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _TTREEREACH_H
+#define _TTREEREACH_H
+
+#ifndef _ALL_IN_ONE
+#include "ttree.h"
+#include "ttreescc.h"
+#endif // _ALL_IN_ONE
+
+#define TTREEREACH_LABELS 3 // interval labels per component
+
+// reachability index over the DAG of the strongly connected components of a
+// frozen tree: two functions of the same component reach each other, else
+// the labels below answer most questions and a pruned depth first search the
+// others
+//
+// each label is the interval [low, post] of a depth first scan of the DAG,
+// with post the rank of a component in post order and low the lowest rank
+// among the components it reaches: if a reaches b, the interval of b is
+// within the one of a for every label (GRAIL); the first scan also gives the
+// pre order rank, so b in the scan subtree of a proves that a reaches b
+//
+// level is the length of the longest call chain from a component, so a can
+// only reach b if its level is higher
+//
+// the search state makes queries on one index sequential
+typedef struct ttreereach_st {
+	const ttree_t *ptree;	  // tree indexed
+	const ttreescc_t *pscc;	  // its components
+	unsigned *level;	  // longest call chain from component
+	unsigned *low;		  // label l of c: low[c * LABELS + l] ...
+	unsigned *post;		  // ... up to post[c * LABELS + l]
+	unsigned *pre;		  // pre order rank in the first scan
+	unsigned *mark;		  // component searched in query epoch
+	unsigned epoch;		  // current query
+	unsigned *stack;	  // components to search
+	unsigned long queryno;	  // queries answered
+	unsigned long searchno;	  // queries needing a search
+} ttreereach_t;
+
+ttreereach_t *ttreereachbuild(const ttree_t *ptree, const ttreescc_t *pscc);
+void ttreereachfree(ttreereach_t *preach);
+int ttreereach(ttreereach_t *preach, unsigned from, unsigned to);
+
+#endif // #ifndef _TTREEREACH_H
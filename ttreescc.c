@@ -0,0 +1,277 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "ttreescc.h"
+#endif // _ALL_IN_ONE
+
+// frame of the explicit stack used by ttreesccbuild() instead of recursion
+typedef struct sccframe_st {
+	unsigned node;	    // node id
+	ttreeiter_t iter;   // callees still to visit
+} sccframe_t;
+
+// callees of a node, none if excluded
+static void sccenter(const ttree_t *ptree, const ttreeset_t *pexcluded,
+		     unsigned node, ttreeiter_t *piter)
+{
+	ttreecallees(ptree, ptree->nodes[node], piter);
+	if (pexcluded && ttreesetisin(pexcluded, node))
+		piter->next = piter->end;
+}
+
+// calls between components, without repetitions
+static int sccdag(const ttree_t *ptree, const ttreeset_t *pexcluded,
+		  ttreescc_t *pscc)
+{
+	unsigned *last;
+	unsigned c, d, i, no = 0, size = 64;
+	ttreeiter_t iter;
+	ttreebranch_t *pbranch;
+
+	// last[d]: last component calling d, to skip repeated calls
+	last = malloc((pscc->sccno + 1) * sizeof(unsigned));
+	pscc->succoff = calloc(pscc->sccno + 1, sizeof(unsigned));
+	pscc->succ = malloc(size * sizeof(unsigned));
+	if (!last || !pscc->succoff || !pscc->succ) {
+		free(last);
+		return -1;
+	}
+	memset(last, 0xff, (pscc->sccno + 1) * sizeof(unsigned));
+
+	for (c = 0; c < pscc->sccno; c++) {
+		pscc->succoff[c] = no;
+		for (i = pscc->sccoff[c]; i < pscc->sccoff[c + 1]; i++) {
+			sccenter(ptree, pexcluded, pscc->sccnodes[i], &iter);
+			while ((pbranch = ttreeiternext(&iter)) != NULL) {
+				if (pexcluded &&
+				    ttreesetisin(pexcluded,
+						 pbranch->child.node->id))
+					continue;
+				d = pscc->nodescc[pbranch->child.node->id];
+				if (d == c || last[d] == c)
+					continue;
+				last[d] = c;
+				if (no == size) {
+					unsigned *psucc =
+					    realloc(pscc->succ,
+						    2 * size * sizeof(unsigned));
+					if (!psucc) {
+						free(last);
+						return -1;
+					}
+					pscc->succ = psucc;
+					size *= 2;
+				}
+				pscc->succ[no++] = d;
+			}
+		}
+	}
+	pscc->succoff[pscc->sccno] = no;
+
+	free(last);
+
+	return 0;
+}
+
+// Tarjan's algorithm, with an explicit stack of frames for the depth first
+// scan so that long call chains can't overflow the C stack; a component is
+// complete when its first node is left, after all the components it calls,
+// hence the reverse topological numbering; pexcluded may be NULL
+ttreescc_t *ttreesccbuild(const ttree_t *ptree, const ttreeset_t *pexcluded)
+{
+	ttreescc_t *pscc;
+	sccframe_t *frames = NULL;
+	unsigned *order = NULL, *low = NULL, *stack = NULL;
+	bitset_t *onstack = NULL;
+	unsigned frameno, stackno = 0, count = 0;
+	unsigned i, s, u, v, c;
+	ttreebranch_t *pbranch;
+
+	pscc = calloc(1, sizeof(*pscc));
+	if (!pscc) {
+		printf("\nMemory allocation error\n");
+		return NULL;
+	}
+
+	// order: 1 + order of the first visit, 0 = not visited yet
+	pscc->nodescc = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	pscc->sccoff = calloc(ptree->nodeno + 2, sizeof(unsigned));
+	pscc->sccnodes = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	pscc->recursive = bitsetalloc(ptree->nodeno);
+	order = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	low = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	stack = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	onstack = bitsetalloc(ptree->nodeno);
+	frames = calloc(ptree->nodeno + 1, sizeof(*frames));
+	if (!pscc->nodescc || !pscc->sccoff || !pscc->sccnodes ||
+	    !pscc->recursive || !order || !low || !stack || !onstack ||
+	    !frames) {
+		printf("\nMemory allocation error\n");
+		ttreesccfree(pscc);
+		pscc = NULL;
+		goto cleanup;
+	}
+
+	for (s = 0; s < ptree->nodeno; s++) {
+		if (order[s] != 0)
+			continue;
+
+		order[s] = low[s] = ++count;
+		stack[stackno++] = s;
+		bitsetset(onstack, s);
+		frames[0].node = s;
+		sccenter(ptree, pexcluded, s, &frames[0].iter);
+		frameno = 1;
+
+		while (frameno > 0) {
+			u = frames[frameno - 1].node;
+			pbranch = ttreeiternext(&frames[frameno - 1].iter);
+			if (pbranch != NULL) {
+				v = pbranch->child.node->id;
+				if (pexcluded && ttreesetisin(pexcluded, v))
+					continue;
+				if (order[v] == 0) {
+					// first visit: go down
+					order[v] = low[v] = ++count;
+					stack[stackno++] = v;
+					bitsetset(onstack, v);
+					frames[frameno].node = v;
+					sccenter(ptree, pexcluded, v,
+						 &frames[frameno].iter);
+					frameno++;
+				} else if (bitsettest(onstack, v) &&
+					   order[v] < low[u])
+					low[u] = order[v];
+				continue;
+			}
+
+			// all callees visited: u closes a component if none of
+			// them reaches a node visited before u
+			frameno--;
+			if (low[u] == order[u]) {
+				c = pscc->sccno++;
+				do {
+					v = stack[--stackno];
+					bitsetclear(onstack, v);
+					pscc->nodescc[v] = c;
+					pscc->sccoff[c + 1]++;
+				} while (v != u);
+			}
+			if (frameno > 0 && low[u] < low[frames[frameno - 1].node])
+				low[frames[frameno - 1].node] = low[u];
+		}
+	}
+
+	// nodes by component, in node id order within each
+	for (c = 0; c < pscc->sccno; c++)
+		pscc->sccoff[c + 1] += pscc->sccoff[c];
+	memset(low, 0, ptree->nodeno * sizeof(unsigned));
+	for (i = 0; i < ptree->nodeno; i++) {
+		c = pscc->nodescc[i];
+		pscc->sccnodes[pscc->sccoff[c] + low[c]++] = i;
+	}
+
+	for (c = 0; c < pscc->sccno; c++)
+		if (ttreesccsize(pscc, c) > 1)
+			bitsetset(pscc->recursive, c);
+	for (i = 0; i < ptree->branchno; i++) {
+		pbranch = ptree->branches[i];
+		if (pbranch->parent.node == pbranch->child.node &&
+		    !(pexcluded &&
+		      ttreesetisin(pexcluded, pbranch->parent.node->id)))
+			bitsetset(pscc->recursive,
+				  pscc->nodescc[pbranch->parent.node->id]);
+	}
+
+	if (sccdag(ptree, pexcluded, pscc) != 0) {
+		printf("\nMemory allocation error\n");
+		ttreesccfree(pscc);
+		pscc = NULL;
+	}
+
+cleanup:
+	free(order);
+	free(low);
+	free(stack);
+	free(onstack);
+	free(frames);
+
+	return pscc;
+}
+
+static int sccempty(const uint64_t *pmask, unsigned wordno)
+{
+	unsigned w;
+
+	for (w = 0; w < wordno; w++)
+		if (pmask[w])
+			return 0;
+
+	return 1;
+}
+
+// propagate masks of wordno words, one per component, from each component to
+// the components it calls: callers have higher ids than their callees, so a
+// single sweep from the highest id down completes them, e.g. the roots
+// reaching each component, 64 roots per word
+void ttreesccsweep(const ttreescc_t *pscc, uint64_t *pmasks,
+		   unsigned wordno)
+{
+	const uint64_t *pfrom;
+	uint64_t *pto;
+	unsigned c, i, w;
+
+	for (c = pscc->sccno; c-- > 0;) {
+		pfrom = &pmasks[(size_t)c * wordno];
+		if (sccempty(pfrom, wordno))
+			continue;
+		for (i = pscc->succoff[c]; i < pscc->succoff[c + 1]; i++) {
+			pto = &pmasks[(size_t)pscc->succ[i] * wordno];
+			for (w = 0; w < wordno; w++)
+				pto[w] |= pfrom[w];
+		}
+	}
+}
+
+void ttreesccfree(ttreescc_t *pscc)
+{
+	if (!pscc)
+		return;
+
+	free(pscc->nodescc);
+	free(pscc->sccoff);
+	free(pscc->sccnodes);
+	free(pscc->recursive);
+	free(pscc->succoff);
+	free(pscc->succ);
+	free(pscc);
+}
@@ -0,0 +1,70 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _TTREESCC_H
+#define _TTREESCC_H
+
+#include <stdint.h>
+
+#ifndef _ALL_IN_ONE
+#include "bitset.h"
+#include "ttree.h"
+#include "ttreesel.h"
+#endif // _ALL_IN_ONE
+
+// strongly connected components of a frozen tree, i.e. the groups of
+// functions calling each other, directly or not
+//
+// components are numbered in reverse topological order: every call goes from
+// a component to one with the same or a lower id, so the components with the
+// calls between them form a DAG, given as adjacency too
+//
+// excluded nodes are left out of the calls, so each is a component alone
+typedef struct ttreescc_st {
+	unsigned sccno;	     // number of components
+	unsigned *nodescc;   // component of node id
+	unsigned *sccoff;    // nodes of component c: sccnodes[sccoff[c]] ...
+	unsigned *sccnodes;  // ... up to sccnodes[sccoff[c+1]], by node id
+	bitset_t *recursive; // component has more than one node or a self call
+	unsigned *succoff;   // components called by component c, once each:
+	unsigned *succ;	     // succ[succoff[c]] up to succ[succoff[c+1]]
+} ttreescc_t;
+
+ttreescc_t *ttreesccbuild(const ttree_t *ptree, const ttreeset_t *pexcluded);
+void ttreesccsweep(const ttreescc_t *pscc, uint64_t *pmasks,
+		   unsigned wordno);
+void ttreesccfree(ttreescc_t *pscc);
+
+static inline unsigned ttreesccsize(const ttreescc_t *pscc, unsigned scc)
+{
+	return pscc->sccoff[scc + 1] - pscc->sccoff[scc];
+}
+
+static inline int ttreesccrecursive(const ttreescc_t *pscc, unsigned scc)
+{
+	return bitsettest(pscc->recursive, scc);
+}
+
+#endif // #ifndef _TTREESCC_H
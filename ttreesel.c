@@ -0,0 +1,244 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <fnmatch.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "ttreesel.h"
+#endif // _ALL_IN_ONE
+
+#define SEL_GLOBCHARS "*?[\\" // characters starting a glob pattern
+#define SEL_FILESEP ':'	      // separates file and function patterns
+
+// state of a selection while iterating over the symbol maps
+typedef struct ttreeselctx_st {
+	const char *funpat;  // function name glob pattern
+	const char *filepat; // file name glob pattern or NULL for any file
+	const char *funprefix; // literal prefix of funpat
+	ttreeset_t *pset;    // set receiving the selected nodes
+	int count;	     // number of nodes selected or -1 on error
+} ttreeselctx_t;
+
+// allocate an empty set for the nodes of a frozen tree
+int ttreesetinit(ttreeset_t *pset, const ttree_t *ptree)
+{
+	memset(pset, 0, sizeof(*pset));
+
+	pset->member = bitsetalloc(ptree->nodeno);
+	if (!pset->member) {
+		printf("\nMemory allocation error\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+void ttreesetfree(ttreeset_t *pset)
+{
+	free(pset->member);
+	free(pset->nodes);
+	memset(pset, 0, sizeof(*pset));
+}
+
+// remove all the nodes from a set, in time proportional to their number
+void ttreesetclear(ttreeset_t *pset)
+{
+	unsigned i;
+
+	for (i = 0; i < pset->nodeno; i++)
+		bitsetclear(pset->member, pset->nodes[i]->id);
+	pset->nodeno = 0;
+}
+
+// add a node to a set, if not already there; returns 1 if added, 0 if already
+// in the set or -1 on error
+int ttreesetadd(ttreeset_t *pset, ttreenode_t *pnode)
+{
+	ttreenode_t **pnodes;
+	unsigned size = pset->nodeno;
+
+	if (bitsettest(pset->member, pnode->id))
+		return 0;
+
+	// grow the list each time its size reaches a power of two
+	if ((size & (size - 1)) == 0) {
+		pnodes = realloc(pset->nodes,
+				 (size ? 2 * size : 1) * sizeof(*pnodes));
+		if (!pnodes) {
+			printf("\nMemory allocation error\n");
+			return -1;
+		}
+		pset->nodes = pnodes;
+	}
+
+	bitsetset(pset->member, pnode->id);
+	pset->nodes[pset->nodeno++] = pnode;
+
+	return 1;
+}
+
+static int ttreesetcmpid(const void *a, const void *b)
+{
+	const ttreenode_t *na = *(ttreenode_t *const *)a;
+	const ttreenode_t *nb = *(ttreenode_t *const *)b;
+
+	return (na->id > nb->id) - (na->id < nb->id);
+}
+
+// sort the nodes of a set in tree order
+void ttreesetsort(ttreeset_t *pset)
+{
+	if (pset->nodeno > 1)
+		qsort(pset->nodes, pset->nodeno, sizeof(*pset->nodes),
+		      ttreesetcmpid);
+}
+
+// literal part of a glob pattern, before its first special character
+static size_t ttreeselprefix(const char *pat)
+{
+	return strcspn(pat, SEL_GLOBCHARS);
+}
+
+static int ttreeseladd(ttreeselctx_t *pctx, ttreenode_t *pnode)
+{
+	int iErr = ttreesetadd(pctx->pset, pnode);
+
+	if (iErr < 0)
+		pctx->count = -1;
+	else
+		pctx->count += iErr;
+
+	return iErr >= 0;
+}
+
+// a function name matching the pattern: select all of its definitions
+static bool ttreeselfun(const char *funname, ttreenode_t *pnode,
+			ttreeselctx_t *pctx)
+{
+	if (fnmatch(pctx->funpat, funname, 0) != 0)
+		return true;
+
+	for (; pnode != NULL; pnode = pnode->nextdef)
+		if (!ttreeseladd(pctx, pnode))
+			return false;
+
+	return true;
+}
+
+// a function defined in a file matching the pattern
+static bool ttreeselfilefun(const char *funname, ttreenode_t *pnode,
+			    ttreeselctx_t *pctx)
+{
+	if (fnmatch(pctx->funpat, funname, 0) != 0)
+		return true;
+
+	return ttreeseladd(pctx, pnode);
+}
+
+// a file matching the pattern: select its functions matching the function
+// pattern, scanning only those sharing its literal prefix
+static bool ttreeselfile(const char *filename, ttreefile_t *pfile,
+			 ttreeselctx_t *pctx)
+{
+	if (fnmatch(pctx->filepat, filename, 0) != 0)
+		return true;
+
+	strmap_iterate(strmap_prefix(&pfile->nodes, pctx->funprefix),
+		       ttreeselfilefun, pctx);
+
+	return pctx->count >= 0;
+}
+
+// add to a set the nodes matching a selector:
+//   name            all definitions of a function name
+//   glob            all definitions of the function names matching a glob
+//                   pattern (*, ? and [...], as in the shell)
+//   fileglob:glob   functions matching glob defined in files matching
+//                   fileglob; an empty function pattern stands for *
+// only the names sharing the literal prefix of a pattern are scanned, as a
+// range of the sorted symbol maps; returns the number of nodes added or -1 on
+// error
+int ttreeselect(const ttree_t *ptree, const char *sel, ttreeset_t *pset)
+{
+	ttreeselctx_t ctx;
+	const char *psep;
+	char *filepat = NULL, *fileprefix = NULL, *funprefix = NULL;
+	int nameid;
+
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.pset = pset;
+	ctx.funpat = sel;
+
+	psep = strrchr(sel, SEL_FILESEP);
+	if (psep) {
+		filepat = strndup(sel, psep - sel);
+		if (!filepat)
+			goto cleanup_nomem;
+		ctx.filepat = filepat;
+		ctx.funpat = psep[1] != '\0' ? psep + 1 : "*";
+	}
+
+	if (!ctx.filepat && ctx.funpat[ttreeselprefix(ctx.funpat)] == '\0') {
+		// plain function name: straight from the symbol index
+		nameid = ttreefindname(ptree, ctx.funpat);
+		if (nameid >= 0)
+			ttreeselfun(ctx.funpat, ptree->namenode[nameid], &ctx);
+
+		return ctx.count;
+	}
+
+	funprefix = strndup(ctx.funpat, ttreeselprefix(ctx.funpat));
+	if (!funprefix)
+		goto cleanup_nomem;
+	ctx.funprefix = funprefix;
+
+	if (ctx.filepat) {
+		fileprefix = strndup(ctx.filepat, ttreeselprefix(ctx.filepat));
+		if (!fileprefix)
+			goto cleanup_nomem;
+		strmap_iterate(strmap_prefix(&ptree->node_files, fileprefix),
+			       ttreeselfile, &ctx);
+	} else
+		strmap_iterate(strmap_prefix(&ptree->node_funcs, funprefix),
+			       ttreeselfun, &ctx);
+
+	free(fileprefix);
+	free(funprefix);
+	free(filepat);
+
+	return ctx.count;
+
+cleanup_nomem:
+	printf("\nMemory allocation error\n");
+	free(fileprefix);
+	free(funprefix);
+	free(filepat);
+
+	return -1;
+}
@@ -0,0 +1,54 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _TTREESEL_H
+#define _TTREESEL_H
+
+#ifndef _ALL_IN_ONE
+#include "bitset.h"
+#include "ttree.h"
+#endif // _ALL_IN_ONE
+
+// set of nodes of a frozen tree: a bitset for membership tests plus the list
+// of its nodes, in tree order once sorted with ttreesetsort()
+typedef struct ttreeset_st {
+	bitset_t *member;    // node id is in the set
+	ttreenode_t **nodes; // nodes of the set
+	unsigned nodeno;     // number of nodes
+} ttreeset_t;
+
+int ttreesetinit(ttreeset_t *pset, const ttree_t *ptree);
+void ttreesetfree(ttreeset_t *pset);
+void ttreesetclear(ttreeset_t *pset);
+int ttreesetadd(ttreeset_t *pset, ttreenode_t *pnode);
+void ttreesetsort(ttreeset_t *pset);
+int ttreeselect(const ttree_t *ptree, const char *sel, ttreeset_t *pset);
+
+static inline int ttreesetisin(const ttreeset_t *pset, unsigned id)
+{
+	return bitsettest(pset->member, id);
+}
+
+#endif // #ifndef _TTREESEL_H
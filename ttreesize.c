@@ -0,0 +1,145 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "ttreescc.h"
+#include "ttreesize.h"
+#endif // _ALL_IN_ONE
+
+#include <ccan/ilog/ilog.h>
+
+ttreesize_t *ttreesizeinit(const ttree_t *ptree)
+{
+	ttreesize_t *psize;
+
+	psize = calloc(1, sizeof(ttreesize_t));
+	if (!psize) {
+		printf("\nMemory allocation error\n");
+		return NULL;
+	}
+
+	psize->bytes = calloc(ptree->nodeno + 1, sizeof(unsigned long));
+	if (!psize->bytes) {
+		printf("\nMemory allocation error\n");
+		ttreesizefree(psize);
+		return NULL;
+	}
+
+	return psize;
+}
+
+// add bytes of code to a node: the parts of a function split by the
+// compiler, e.g. foo.cold, and the copies of a static inline one add up
+void ttreesizeadd(ttreesize_t *psize, const ttreenode_t *pnode,
+		  unsigned long bytes)
+{
+	if (psize->bytes[pnode->id] == 0 && bytes)
+		psize->sizedno++;
+	psize->bytes[pnode->id] += bytes;
+}
+
+// sizes reached from each root, once all the node sizes are added: the
+// roots reaching each recursive group are swept down the groups 64 at a time
+// as with the reachability matrix, then each group adds its size to the
+// roots reaching it, and to the exclusive size of a root reaching it alone
+int ttreesizebuild(ttreesize_t *psize, const ttree_t *ptree,
+		   const ttreeset_t *proots, const ttreeset_t *pexcluded)
+{
+	ttreescc_t *pscc;
+	uint64_t *pmasks = NULL, *pmask, v;
+	unsigned long bytes;
+	unsigned c, i, r, w, n, wordno, rootno = proots->nodeno;
+	unsigned reachno, ronly = 0; // roots reaching a group, the last one
+	int iErr = 0;
+
+	wordno = (rootno + 63) / 64;
+	psize->total = calloc(rootno + 1, sizeof(unsigned long));
+	psize->exclusive = calloc(rootno + 1, sizeof(unsigned long));
+	psize->functions = calloc(rootno + 1, sizeof(unsigned));
+	pscc = ttreesccbuild(ptree, pexcluded);
+	if (pscc)
+		pmasks = calloc((size_t)pscc->sccno * wordno + 1,
+				sizeof(uint64_t));
+	if (!psize->total || !psize->exclusive || !psize->functions ||
+	    (pscc && !pmasks)) {
+		printf("\nMemory allocation error\n");
+		iErr = -1;
+	}
+	if (!pscc)
+		iErr = -1;
+	if (iErr != 0)
+		goto cleanup;
+
+	for (r = 0; r < rootno; r++) {
+		n = proots->nodes[r]->id;
+		if (!ttreesetisin(pexcluded, n))
+			pmasks[(size_t)pscc->nodescc[n] * wordno + r / 64] |=
+			    1ULL << (r % 64);
+	}
+	ttreesccsweep(pscc, pmasks, wordno);
+
+	for (c = 0; c < pscc->sccno; c++) {
+		pmask = &pmasks[(size_t)c * wordno];
+		bytes = 0;
+		for (i = pscc->sccoff[c]; i < pscc->sccoff[c + 1]; i++)
+			bytes += psize->bytes[pscc->sccnodes[i]];
+
+		reachno = 0;
+		for (w = 0; w < wordno; w++)
+			for (v = pmask[w]; v; v &= v - 1) {
+				// lowest root left in the word
+				r = w * 64 + ilog64_nz(v & -v) - 1;
+				psize->total[r] += bytes;
+				psize->functions[r] += ttreesccsize(pscc, c);
+				reachno++;
+				ronly = r;
+			}
+		if (reachno == 1)
+			psize->exclusive[ronly] += bytes;
+	}
+
+cleanup:
+	free(pmasks);
+	ttreesccfree(pscc);
+
+	return iErr;
+}
+
+void ttreesizefree(ttreesize_t *psize)
+{
+	if (!psize)
+		return;
+
+	free(psize->bytes);
+	free(psize->total);
+	free(psize->exclusive);
+	free(psize->functions);
+	free(psize);
+}
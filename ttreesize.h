@@ -0,0 +1,52 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _TTREESIZE_H
+#define _TTREESIZE_H
+
+#ifndef _ALL_IN_ONE
+#include "ttree.h"
+#include "ttreesel.h"
+#endif // _ALL_IN_ONE
+
+// code size of every node of a frozen tree and of what each root reaches,
+// leaving out the excluded nodes: the total of the functions reached from
+// the root and the exclusive part, reached from no other root
+typedef struct ttreesize_st {
+	unsigned long *bytes;	  // bytes of code of each node, 0 if unknown
+	unsigned sizedno;	  // nodes with a size
+	unsigned long *total;	  // bytes reached from each root
+	unsigned long *exclusive; // bytes reached from that root only
+	unsigned *functions;	  // functions reached from each root
+} ttreesize_t;
+
+ttreesize_t *ttreesizeinit(const ttree_t *ptree);
+void ttreesizeadd(ttreesize_t *psize, const ttreenode_t *pnode,
+		  unsigned long bytes);
+int ttreesizebuild(ttreesize_t *psize, const ttree_t *ptree,
+		   const ttreeset_t *proots, const ttreeset_t *pexcluded);
+void ttreesizefree(ttreesize_t *psize);
+
+#endif // #ifndef _TTREESIZE_H
@@ -0,0 +1,144 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "ttreescc.h"
+#include "ttreestack.h"
+#endif // _ALL_IN_ONE
+
+ttreestack_t *ttreestackinit(const ttree_t *ptree)
+{
+	ttreestack_t *pstack;
+	unsigned n = ptree->nodeno + 1;
+
+	pstack = calloc(1, sizeof(ttreestack_t));
+	if (!pstack) {
+		printf("\nMemory allocation error\n");
+		return NULL;
+	}
+
+	pstack->frame = calloc(n, sizeof(unsigned long));
+	pstack->flags = calloc(n, sizeof(unsigned char));
+	pstack->worst = calloc(n, sizeof(unsigned long));
+	pstack->next = malloc(n * sizeof(unsigned));
+	if (!pstack->frame || !pstack->flags || !pstack->worst ||
+	    !pstack->next) {
+		printf("\nMemory allocation error\n");
+		ttreestackfree(pstack);
+		return NULL;
+	}
+
+	return pstack;
+}
+
+// set the frame of a node; a node given more than once, e.g. built in two
+// configurations, keeps the largest
+void ttreestackframe(ttreestack_t *pstack, const ttreenode_t *pnode,
+		     unsigned long bytes, int dynamic)
+{
+	if (!(pstack->flags[pnode->id] & TTREESTACK_FRAME)) {
+		pstack->flags[pnode->id] |= TTREESTACK_FRAME;
+		pstack->frameno++;
+	}
+	if (bytes > pstack->frame[pnode->id])
+		pstack->frame[pnode->id] = bytes;
+	if (dynamic)
+		pstack->flags[pnode->id] |= TTREESTACK_DYNAMIC;
+}
+
+// worst stack of every node, once all the frames are set: the components
+// are in reverse topological order, so the callees of a node not recursive
+// are done before it. A node not bounded follows a callee not bounded, so
+// that its worst path ends where the stack stops being bounded
+int ttreestackbuild(ttreestack_t *pstack, const ttree_t *ptree,
+		    const ttreeset_t *pexcluded)
+{
+	ttreescc_t *pscc;
+	ttreebranch_t *pbranch;
+	ttreeiter_t iter;
+	unsigned c, i, n, callee;
+	unsigned char *flags = pstack->flags;
+
+	pscc = ttreesccbuild(ptree, pexcluded);
+	if (!pscc)
+		return -1;
+
+	for (c = 0; c < pscc->sccno; c++)
+		for (i = pscc->sccoff[c]; i < pscc->sccoff[c + 1]; i++) {
+			n = pscc->sccnodes[i];
+			pstack->next[n] = TTREESTACK_END;
+			pstack->worst[n] = pstack->frame[n];
+			if (ttreesetisin(pexcluded, n))
+				continue;
+			if (ttreesccrecursive(pscc, c)) {
+				flags[n] |= TTREESTACK_RECURSIVE |
+					    TTREESTACK_UNBOUNDED;
+				continue;
+			}
+			if (flags[n] & TTREESTACK_DYNAMIC) {
+				flags[n] |= TTREESTACK_UNBOUNDED;
+				continue;
+			}
+
+			ttreecallees(ptree, ptree->nodes[n], &iter);
+			while ((pbranch = ttreeiternext(&iter)) != NULL) {
+				callee = pbranch->child.node->id;
+				if (ttreesetisin(pexcluded, callee))
+					continue;
+				if (flags[callee] & TTREESTACK_UNBOUNDED) {
+					flags[n] |= TTREESTACK_UNBOUNDED;
+					pstack->next[n] = callee;
+					break;
+				}
+				if (pstack->next[n] == TTREESTACK_END ||
+				    pstack->frame[n] + pstack->worst[callee] >
+					pstack->worst[n]) {
+					pstack->worst[n] = pstack->frame[n] +
+							   pstack->worst[callee];
+					pstack->next[n] = callee;
+				}
+			}
+		}
+
+	ttreesccfree(pscc);
+
+	return 0;
+}
+
+void ttreestackfree(ttreestack_t *pstack)
+{
+	if (!pstack)
+		return;
+
+	free(pstack->frame);
+	free(pstack->flags);
+	free(pstack->worst);
+	free(pstack->next);
+	free(pstack);
+}
@@ -0,0 +1,61 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _TTREESTACK_H
+#define _TTREESTACK_H
+
+#ifndef _ALL_IN_ONE
+#include "ttree.h"
+#include "ttreesel.h"
+#endif // _ALL_IN_ONE
+
+#define TTREESTACK_END 0xffffffffu // next of the last node of a worst path
+
+// flags of a node
+#define TTREESTACK_FRAME 1     // frame size known
+#define TTREESTACK_DYNAMIC 2   // frame not bounded, e.g. alloca or VLAs
+#define TTREESTACK_RECURSIVE 4 // in a recursive group
+#define TTREESTACK_UNBOUNDED 8 // worst stack not bounded
+
+// worst case stack usage of every node of a frozen tree, leaving out the
+// excluded nodes: the largest sum of frames along a call chain from the node,
+// which is not bounded when the chain reaches a recursive group or a dynamic
+// frame; nodes with no frame size count as 0
+typedef struct ttreestack_st {
+	unsigned long *frame; // bytes of the frame of each node
+	unsigned char *flags; // TTREESTACK_* of each node
+	unsigned long *worst; // worst stack from each node, its frame included
+	unsigned *next;	      // callee on the worst path or TTREESTACK_END
+	unsigned frameno;     // nodes with a frame size
+} ttreestack_t;
+
+ttreestack_t *ttreestackinit(const ttree_t *ptree);
+void ttreestackframe(ttreestack_t *pstack, const ttreenode_t *pnode,
+		     unsigned long bytes, int dynamic);
+int ttreestackbuild(ttreestack_t *pstack, const ttree_t *ptree,
+		    const ttreeset_t *pexcluded);
+void ttreestackfree(ttreestack_t *pstack);
+
+#endif // #ifndef _TTREESTACK_H
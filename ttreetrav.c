@@ -0,0 +1,99 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _ALL_IN_ONE
+#include "defines.h"
+#include "ttreetrav.h"
+#endif // _ALL_IN_ONE
+
+// allocate the state for scanning a frozen tree; plain malloc() is used here,
+// as the tal allocator of the tree is not thread safe
+ttreetrav_t *ttreetravinit(const ttree_t *ptree)
+{
+	ttreetrav_t *ptrav;
+
+	ptrav = calloc(1, sizeof(*ptrav));
+	if (!ptrav) {
+		printf("\nMemory allocation error\n");
+		return NULL;
+	}
+
+	ptrav->ptree = ptree;
+	ptrav->nodeout = bitsetalloc(ptree->nodeno);
+	ptrav->subtreeout = bitsetalloc(ptree->nodeno);
+	ptrav->branchout = bitsetalloc(ptree->branchno);
+	ptrav->nodeseen = bitsetalloc(ptree->nodeno);
+	ptrav->nodedist = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	ptrav->queue = calloc(ptree->nodeno + 1, sizeof(unsigned));
+	ptrav->outlist = calloc(ptree->nodeno + ptree->branchno + 1,
+				sizeof(unsigned));
+	ptrav->fromroots = bitsetalloc(ptree->nodeno);
+	ptrav->toroots = bitsetalloc(ptree->nodeno);
+	ptrav->fromtarget = bitsetalloc(ptree->nodeno);
+	ptrav->totarget = bitsetalloc(ptree->nodeno);
+	ptrav->nodecolor = calloc(ptree->nodeno + 1, sizeof(int));
+	ptrav->branchcolor = calloc(ptree->branchno + 1, sizeof(int));
+	if (!ptrav->nodeout || !ptrav->subtreeout || !ptrav->branchout ||
+	    !ptrav->nodeseen || !ptrav->nodedist || !ptrav->queue ||
+	    !ptrav->outlist || !ptrav->fromroots || !ptrav->toroots ||
+	    !ptrav->fromtarget || !ptrav->totarget || !ptrav->nodecolor ||
+	    !ptrav->branchcolor ||
+	    ttreesetinit(&ptrav->roots, ptree) != 0 ||
+	    ttreesetinit(&ptrav->targets, ptree) != 0 ||
+	    ttreesetinit(&ptrav->excluded, ptree) != 0) {
+		printf("\nMemory allocation error\n");
+		ttreetravfree(ptrav);
+		return NULL;
+	}
+
+	return ptrav;
+}
+
+void ttreetravfree(ttreetrav_t *ptrav)
+{
+	if (!ptrav)
+		return;
+
+	free(ptrav->nodeout);
+	free(ptrav->subtreeout);
+	free(ptrav->branchout);
+	ttreesetfree(&ptrav->roots);
+	ttreesetfree(&ptrav->targets);
+	ttreesetfree(&ptrav->excluded);
+	free(ptrav->nodeseen);
+	free(ptrav->nodedist);
+	free(ptrav->queue);
+	free(ptrav->outlist);
+	free(ptrav->fromroots);
+	free(ptrav->toroots);
+	free(ptrav->fromtarget);
+	free(ptrav->totarget);
+	free(ptrav->nodecolor);
+	free(ptrav->branchcolor);
+	free(ptrav);
+}
@@ -0,0 +1,78 @@
+/*
+ * This source code is released for free distribution under the terms of the MIT
+ * License (MIT):
+ *
+ * Copyright (c) 2014, Fabio Visona'
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _TTREETRAV_H
+#define _TTREETRAV_H
+
+#include <stdio.h>
+
+#ifndef _ALL_IN_ONE
+#include "ttree.h"
+#include "ttreecomm.h"
+#include "ttreemetric.h"
+#include "ttreeprof.h"
+#include "ttreescc.h"
+#include "ttreesel.h"
+#include "ttreesize.h"
+#endif // _ALL_IN_ONE
+
+// state of one scan of a frozen tree: the tree itself is only read, so
+// several traversals, each with its own context, can share it
+//
+// outlist entries are node ids or branch ids, shifted left by one bit and
+// tagged with TTREETRAV_BRANCH for branches
+#define TTREETRAV_BRANCH 1 // outlist entry is a branch
+
+typedef struct ttreetrav_st {
+	const ttree_t *ptree; // tree being scanned
+	bitset_t *nodeout;    // node output done
+	bitset_t *subtreeout; // node subtree output done
+	bitset_t *branchout;  // branch output done
+	ttreeset_t roots;     // root nodes, in tree order
+	ttreeset_t targets;   // last nodes of a highlighted call path
+	ttreeset_t excluded;  // nodes excluded from the tree
+	bitset_t *nodeseen;   // node reached by a breadth first scan
+	unsigned *nodedist;   // distance from the roots in that scan
+	unsigned *queue;      // node ids queued by that scan
+	unsigned *outlist;    // nodes and branches output, in scan order
+	unsigned outno;	      // number of entries in outlist
+	bitset_t *fromroots;  // node reached from the roots over output calls
+	bitset_t *toroots;    // node reaching the roots over output calls
+	bitset_t *fromtarget; // node reached from a call path end, same way
+	bitset_t *totarget;   // node reaching a call path end, same way
+	int *nodecolor;	      // highlight style + 1 for node (0 = default)
+	int *branchcolor;     // highlight style + 1 for branch (0 = default)
+	FILE *outfile;	      // output file of this traversal
+	const ttreescc_t *pscc; // recursive groups condensed in output or NULL
+	const ttreemetric_t *pmetric; // metrics output as attributes or NULL
+	const ttreecomm_t *pcomm; // communities output as clusters or NULL
+	const ttreesize_t *psize; // code sizes output as labels or NULL
+	const ttreeprof_t *pprof; // profile samples output as heat or NULL
+} ttreetrav_t;
+
+ttreetrav_t *ttreetravinit(const ttree_t *ptree);
+void ttreetravfree(ttreetrav_t *ptrav);
+
+#endif // #ifndef _TTREETRAV_H